@@ -0,0 +1,94 @@
+#include <benchmark/benchmark.h>
+#include "AnimationState.hpp"
+#include "Sprite.hpp"
+
+#include <vector>
+
+// Per-step fish animation cost over N fish, as the game runs it: the idle sway loop of
+// GameSimulation::updateAnimations (Animation::sway per active fish, added to its scroll
+// position) and RhythmGame::renderFish placing a variant sprite on the shared swim column.
+// Sprites use a region with no texture - placement only touches positions and frames, so no
+// window is needed.
+namespace {
+
+constexpr float kStepSeconds = 1.0f / 120.0f;
+
+// The fields of GameSimulation's fish that the sway loop reads and writes
+struct Fish {
+    float baseX = 0.0f;
+    float baseY = 0.0f;
+    float x = 0.0f;
+    float y = 0.0f;
+    bool active = false;
+};
+
+std::vector<Fish> makeFish(int count, int activeEvery) {
+    std::vector<Fish> fish(count);
+    for (int i = 0; i < count; ++i) {
+        fish[i].baseX = fish[i].x = static_cast<float>(i * 37 % 1920);
+        fish[i].baseY = fish[i].y = 720.0f;
+        fish[i].active = i % activeEvery == 0;
+    }
+    return fish;
+}
+
+void swayFish(std::vector<Fish>& fish, float timeSeconds) {
+    for (size_t i = 0; i < fish.size(); ++i) {
+        Fish& one = fish[i];
+        if (one.active) {
+            SwayOffset fishSway = Animation::sway(timeSeconds, static_cast<float>(i));
+            one.x = one.baseX + fishSway.x;
+            one.y = one.baseY + fishSway.y;
+        }
+    }
+}
+
+} // namespace
+
+// Every fish on screen and swayed
+static void BM_SwayAllFish(benchmark::State& state) {
+    std::vector<Fish> fish = makeFish(static_cast<int>(state.range(0)), 1);
+    float timeSeconds = 0.0f;
+    for (auto _ : state) {
+        swayFish(fish, timeSeconds);
+        benchmark::ClobberMemory();
+        timeSeconds += kStepSeconds;
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SwayAllFish)->Arg(100)->Arg(1000)->Arg(10000);
+
+// Only the on-screen quarter swayed, as gameplay does after culling
+static void BM_SwayActiveFish(benchmark::State& state) {
+    std::vector<Fish> fish = makeFish(static_cast<int>(state.range(0)), 4);
+    float timeSeconds = 0.0f;
+    for (auto _ : state) {
+        swayFish(fish, timeSeconds);
+        benchmark::ClobberMemory();
+        timeSeconds += kStepSeconds;
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SwayActiveFish)->Arg(100)->Arg(1000)->Arg(10000);
+
+// RhythmGame::renderFish: each swimming fish moves its variant's sprite and sets the swim column
+static void BM_FishSpritePlacement(benchmark::State& state) {
+    TextureRegion sheet;
+    sheet.texture = nullptr;
+    sheet.rect = {0, 0, 768, 128};
+    std::vector<Sprite> variants(3, Sprite(0.0f, 0.0f, sheet, 1, 6));
+
+    std::vector<Fish> fish = makeFish(static_cast<int>(state.range(0)), 1);
+    int column = 1;
+    for (auto _ : state) {
+        for (size_t i = 0; i < fish.size(); ++i) {
+            Sprite& sprite = variants[i % variants.size()];
+            sprite.setLoc(fish[i].x, fish[i].y);
+            sprite.setFrame(1, column);
+            benchmark::DoNotOptimize(sprite);
+        }
+        column = column % 3 + 1;
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_FishSpritePlacement)->Arg(100)->Arg(1000)->Arg(10000);
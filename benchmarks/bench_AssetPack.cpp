@@ -0,0 +1,109 @@
+#include <benchmark/benchmark.h>
+#include <SDL.h>
+#include <SDL_image.h>
+#include "AssetPack.hpp"
+#include "RenderWindow.hpp"
+#include "ResourceManager.hpp"
+
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Loading the gameplay images (same sizes as assets/images) with a fresh ResourceManager,
+// once by decoding PNG files and once from a mapped asset pack. This is the image part of
+// cold start; the game also logs its real time to first menu frame for both modes.
+namespace {
+
+struct BenchImage {
+    std::string path;
+    int width;
+    int height;
+};
+
+const std::vector<BenchImage> kImages = {
+    {"bench_ocean.png", 1920, 1080}, {"bench_blue_fish.png", 768, 128}, {"bench_green_fish.png", 768, 128},
+    {"bench_gold_fish.png", 768, 128}, {"bench_boat.png", 512, 256}, {"bench_fisher.png", 384, 256},
+    {"bench_hook.png", 106, 200}, {"bench_menu_cat.png", 584, 349}, {"bench_select_cat.png", 400, 147}
+};
+
+const char* kPackPath = "bench_assets.mwpk";
+
+class LoadFixture {
+public:
+    LoadFixture() {
+        SDL_Init(SDL_INIT_VIDEO);
+        IMG_Init(IMG_INIT_PNG);
+        window = std::make_unique<RenderWindow>("Pack Benchmark", 100, 100, SDL_WINDOW_HIDDEN);
+
+        // Gradient with noise so PNG compression is closer to real art than a flat fill
+        AssetPackWriter writer;
+        Uint32 seed = 12345;
+        for (const auto& image : kImages) {
+            SDL_Surface* surface = SDL_CreateRGBSurfaceWithFormat(0, image.width, image.height, 32, SDL_PIXELFORMAT_RGBA32);
+            Uint8* pixels = static_cast<Uint8*>(surface->pixels);
+            for (int y = 0; y < image.height; ++y) {
+                for (int x = 0; x < image.width; ++x) {
+                    seed = seed * 1664525u + 1013904223u;
+                    Uint8* pixel = pixels + y * surface->pitch + x * 4;
+                    pixel[0] = static_cast<Uint8>(x + (seed >> 28));
+                    pixel[1] = static_cast<Uint8>(y + (seed >> 29));
+                    pixel[2] = static_cast<Uint8>(x + y);
+                    pixel[3] = 255;
+                }
+            }
+            IMG_SavePNG(surface, image.path.c_str());
+            writer.addImage(image.path, image.width, image.height, surface->pixels);
+            SDL_FreeSurface(surface);
+        }
+        writer.write(kPackPath);
+    }
+
+    ~LoadFixture() {
+        for (const auto& image : kImages) {
+            std::remove(image.path.c_str());
+        }
+        std::remove(kPackPath);
+        window.reset();
+        IMG_Quit();
+        SDL_Quit();
+    }
+
+    std::unique_ptr<RenderWindow> window;
+};
+
+LoadFixture& fixture() {
+    static LoadFixture instance;
+    return instance;
+}
+
+void loadAll(benchmark::State& state, bool usePack) {
+    LoadFixture& loader = fixture();
+    if (!loader.window->isValid()) {
+        state.SkipWithError("Failed to create render window");
+        return;
+    }
+
+    for (auto _ : state) {
+        ResourceManager resourceManager(loader.window->getRenderer());
+        if (usePack && !resourceManager.mountAssetPack(kPackPath)) {
+            state.SkipWithError("Failed to map asset pack");
+            return;
+        }
+        for (const auto& image : kImages) {
+            benchmark::DoNotOptimize(resourceManager.loadTexture(image.path));
+        }
+    }
+}
+
+} // namespace
+
+static void BM_ColdLoadPNG(benchmark::State& state) {
+    loadAll(state, false);
+}
+BENCHMARK(BM_ColdLoadPNG)->Unit(benchmark::kMillisecond);
+
+static void BM_ColdLoadAssetPack(benchmark::State& state) {
+    loadAll(state, true);
+}
+BENCHMARK(BM_ColdLoadAssetPack)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,108 @@
+#include <benchmark/benchmark.h>
+#include "Chart.hpp"
+#include "CompiledChart.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+// Song-start cost of a 1M-note chart: parsing the text file versus mapping the compiled
+// one. Counters report file size and the memory each path holds once loaded.
+namespace {
+
+const char* kTextPath = "bench_chart.chart";
+const char* kCompiledPath = "bench_chart.mwch";
+constexpr int kNoteCount = 1000000;
+
+// Writes both files on first use
+void prepareCharts() {
+    static bool prepared = false;
+    if (prepared) {
+        return;
+    }
+    prepared = true;
+
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> gap(20, 400);
+    std::uniform_int_distribution<int> lane(0, 3);
+
+    std::ofstream text(kTextPath, std::ios::trunc);
+    text << "version 1\ntitle Benchmark\nbpm 180\ncount " << kNoteCount << "\n[notes]\n";
+    long long time = 1000;
+    for (int i = 0; i < kNoteCount; ++i) {
+        time += gap(rng);
+        text << time << ' ' << lane(rng) << (i % 8 == 0 ? " hold\n" : " tap\n");
+    }
+    text.close();
+
+    Chart chart;
+    chart.loadFromFile(kTextPath);
+    CompiledChartWriter().write(chart, kCompiledPath);
+}
+
+double fileSize(const char* path) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    return static_cast<double>(file.tellg());
+}
+
+} // namespace
+
+// Full parse of the text chart into a Chart
+static void BM_ChartLoadText(benchmark::State& state) {
+    prepareCharts();
+    Chart chart;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(chart.loadFromFile(kTextPath));
+    }
+    state.counters["notes"] = static_cast<double>(chart.getNoteCount());
+    state.counters["file_bytes"] = fileSize(kTextPath);
+    state.counters["heap_bytes"] = static_cast<double>(chart.getNotes().capacity() * sizeof(ChartNote));
+}
+BENCHMARK(BM_ChartLoadText)->Unit(benchmark::kMillisecond);
+
+// Map the compiled chart and decode every note into a Chart (what the game does today)
+static void BM_ChartLoadCompiled(benchmark::State& state) {
+    prepareCharts();
+    Chart chart;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(chart.loadFromFile(kCompiledPath));
+    }
+    state.counters["notes"] = static_cast<double>(chart.getNoteCount());
+    state.counters["file_bytes"] = fileSize(kCompiledPath);
+    state.counters["heap_bytes"] = static_cast<double>(chart.getNotes().capacity() * sizeof(ChartNote));
+}
+BENCHMARK(BM_ChartLoadCompiled)->Unit(benchmark::kMillisecond);
+
+// Map the compiled chart and validate its index without decoding any notes
+static void BM_CompiledChartOpen(benchmark::State& state) {
+    prepareCharts();
+    CompiledChart compiled;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(compiled.open(kCompiledPath));
+    }
+    state.counters["notes"] = static_cast<double>(compiled.getNoteCount());
+    state.counters["file_bytes"] = static_cast<double>(compiled.getFileSize());
+    state.counters["heap_bytes"] = 0.0; // Notes stay in the mapping
+}
+BENCHMARK(BM_CompiledChartOpen)->Unit(benchmark::kMicrosecond);
+
+// Jump to a random song position and decode the next 64 notes (practice mode / scrubbing)
+static void BM_CompiledChartSeek(benchmark::State& state) {
+    prepareCharts();
+    CompiledChart compiled;
+    compiled.open(kCompiledPath);
+    const double songLength = compiled.getNoteTimes().back();
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<double> position(0.0, songLength);
+    std::vector<ChartNote> notes;
+
+    for (auto _ : state) {
+        size_t first = compiled.findNote(position(rng));
+        notes.clear();
+        compiled.decodeNotes(first, std::min<size_t>(64, compiled.getNoteCount() - first), notes);
+        benchmark::DoNotOptimize(notes.data());
+    }
+}
+BENCHMARK(BM_CompiledChartSeek);
@@ -0,0 +1,117 @@
+#include <benchmark/benchmark.h>
+#include "GameSimulation.hpp"
+#include "RhythmGame.hpp"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+// Gameplay frames through GameSimulation, which now holds what RhythmGame::handleRhythmInput and
+// checkMissedNotes did: each iteration is one 60 FPS frame with its presses judged, a miss sweep
+// and the fixed simulation steps. Chart size grows to show that nothing per frame scales with the
+// note count: judgement and fish work only touch the notes near the current time. Runs headless on
+// a ManualClock.
+namespace {
+
+constexpr double kFrameMs = 1000.0 / 60.0;
+
+struct Song {
+    SimulationConfig config;
+    std::vector<double> presses;    // Sorted; roughly 90% of notes are pressed, with timing jitter
+};
+
+Song makeSong(int noteCount) {
+    Song song;
+    std::mt19937 rng(1234);
+    std::uniform_real_distribution<double> gap(20.0, 200.0);
+    std::normal_distribution<double> jitter(0.0, 40.0);
+    std::uniform_real_distribution<double> chance(0.0, 1.0);
+
+    double time = 2000.0;
+    for (int i = 0; i < noteCount; ++i) {
+        time += gap(rng);
+        song.config.noteTimesMs.push_back(time);
+        if (chance(rng) < 0.9) {
+            song.presses.push_back(time + jitter(rng));
+        }
+    }
+    std::sort(song.presses.begin(), song.presses.end());
+
+    song.config.seed = 1234u;
+    song.config.fishFrameSizes.assign(3, {128, 128});
+    song.config.culler = ViewportCuller(1920, 1080, 128);
+    return song;
+}
+
+} // namespace
+
+static void BM_SimulationFrame(benchmark::State& state) {
+    const Song song = makeSong(static_cast<int>(state.range(0)));
+    const double endMs = song.config.noteTimesMs.back() + 1000.0;
+
+    GameSimulation simulation;
+    simulation.reset(song.config);
+    double timeMs = 0.0;
+    size_t nextPress = 0;
+    std::vector<double> framePresses;
+
+    for (auto _ : state) {
+        // Wrap around at the end of the song, outside the timed region
+        if (timeMs >= endMs) {
+            state.PauseTiming();
+            simulation.reset(song.config);
+            timeMs = 0.0;
+            nextPress = 0;
+            state.ResumeTiming();
+        }
+
+        timeMs += kFrameMs;
+        framePresses.clear();
+        while (nextPress < song.presses.size() && song.presses[nextPress] <= timeMs) {
+            framePresses.push_back(song.presses[nextPress++]);
+        }
+        const RenderSnapshot& snapshot = simulation.step(timeMs, framePresses);
+        benchmark::DoNotOptimize(snapshot.score);
+    }
+
+    state.counters["notes"] = static_cast<double>(state.range(0));
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SimulationFrame)->Arg(100)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond);
+
+// A whole song stepped as fast as possible, as a bot or replay would
+static void BM_SimulationSong(benchmark::State& state) {
+    const Song song = makeSong(static_cast<int>(state.range(0)));
+    const double endMs = song.config.noteTimesMs.back() + 1000.0;
+
+    GameSimulation simulation;
+    std::vector<double> framePresses;
+    for (auto _ : state) {
+        simulation.reset(song.config);
+        size_t nextPress = 0;
+        for (double timeMs = kFrameMs; timeMs < endMs; timeMs += kFrameMs) {
+            framePresses.clear();
+            while (nextPress < song.presses.size() && song.presses[nextPress] <= timeMs) {
+                framePresses.push_back(song.presses[nextPress++]);
+            }
+            simulation.step(timeMs, framePresses);
+        }
+        benchmark::DoNotOptimize(simulation.getStats().getScore());
+    }
+
+    state.counters["song_seconds"] = endMs / 1000.0;
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SimulationSong)->Arg(100)->Arg(1000)->Unit(benchmark::kMillisecond);
+
+// Score string rebuilt by RhythmGame::updateScore whenever the score changes
+static void BM_FormatScore(benchmark::State& state) {
+    int score = 0;
+    for (auto _ : state) {
+        std::string text = RhythmGame::formatScore(score);
+        benchmark::DoNotOptimize(text.data());
+        score = (score + 500) % 1000000;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_FormatScore);
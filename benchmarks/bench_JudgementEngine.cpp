@@ -0,0 +1,143 @@
+#include <benchmark/benchmark.h>
+#include "JudgementEngine.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+// Plays a generated chart at 60 FPS: each iteration is one frame with a miss check and any
+// presses that fall inside it. The linear variant is the per-frame full scan RhythmGame used
+// before the judgement engine, kept here as the baseline.
+namespace {
+
+constexpr double kFrameMs = 1000.0 / 60.0;
+constexpr double kPerfectMs = 60.0;
+constexpr double kGoodMs = 120.0;
+
+struct Chart {
+    std::vector<double> notes;
+    std::vector<double> presses;    // Sorted; roughly 90% of notes are pressed, with timing jitter
+};
+
+Chart makeChart(int noteCount) {
+    Chart chart;
+    std::mt19937 rng(1234);
+    std::uniform_real_distribution<double> gap(20.0, 200.0);
+    std::normal_distribution<double> jitter(0.0, 40.0);
+    std::uniform_real_distribution<double> chance(0.0, 1.0);
+
+    double time = 2000.0;
+    for (int i = 0; i < noteCount; ++i) {
+        time += gap(rng);
+        chart.notes.push_back(time);
+        if (chance(rng) < 0.9) {
+            chart.presses.push_back(time + jitter(rng));
+        }
+    }
+    std::sort(chart.presses.begin(), chart.presses.end());
+    return chart;
+}
+
+class LinearJudge {
+public:
+    explicit LinearJudge(const std::vector<double>& notes) : m_notes(notes), m_hit(notes.size(), false) {}
+
+    void reset() { m_hit.assign(m_notes.size(), false); }
+
+    int judgeHit(double time) {
+        for (size_t i = 0; i < m_notes.size(); ++i) {
+            if (m_hit[i]) continue;
+            if (std::fabs(time - m_notes[i]) <= kGoodMs) {
+                m_hit[i] = true;
+                return static_cast<int>(i);
+            }
+        }
+        return -1;
+    }
+
+    int resolveMisses(double time) {
+        int misses = 0;
+        for (size_t i = 0; i < m_notes.size(); ++i) {
+            if (m_hit[i]) continue;
+            if (time > m_notes[i] + kGoodMs) {
+                m_hit[i] = true;
+                ++misses;
+            }
+        }
+        return misses;
+    }
+
+private:
+    const std::vector<double>& m_notes;
+    std::vector<bool> m_hit;
+};
+
+template <typename Judge>
+void playChart(benchmark::State& state, Judge& judge, const Chart& chart) {
+    double time = 0.0;
+    size_t nextPress = 0;
+    const double endTime = chart.notes.back() + kGoodMs + kFrameMs;
+    int hits = 0;
+
+    for (auto _ : state) {
+        time += kFrameMs;
+        while (nextPress < chart.presses.size() && chart.presses[nextPress] <= time) {
+            hits += judge.judgeHit(chart.presses[nextPress]) >= 0;
+            ++nextPress;
+        }
+        benchmark::DoNotOptimize(judge.resolveMisses(time));
+
+        if (time > endTime) {
+            // Loop the song
+            time = 0.0;
+            nextPress = 0;
+            judge.reset();
+        }
+    }
+    benchmark::DoNotOptimize(hits);
+    state.counters["notes"] = static_cast<double>(chart.notes.size());
+}
+
+// Adapts JudgementEngine to the int-returning interface used by playChart
+class EngineJudge {
+public:
+    explicit EngineJudge(const std::vector<double>& notes) : m_engine(kPerfectMs, kGoodMs) { m_engine.load(notes); }
+    void reset() { m_engine.reset(); }
+    int judgeHit(double time) { return m_engine.judgeHit(time).noteIndex; }
+    int resolveMisses(double time) { return m_engine.resolveMisses(time); }
+
+private:
+    JudgementEngine m_engine;
+};
+
+} // namespace
+
+static void BM_JudgeFrameLinear(benchmark::State& state) {
+    Chart chart = makeChart(static_cast<int>(state.range(0)));
+    LinearJudge judge(chart.notes);
+    playChart(state, judge, chart);
+}
+BENCHMARK(BM_JudgeFrameLinear)->Arg(1000)->Arg(10000)->Arg(100000);
+
+static void BM_JudgeFrameEngine(benchmark::State& state) {
+    Chart chart = makeChart(static_cast<int>(state.range(0)));
+    EngineJudge judge(chart.notes);
+    playChart(state, judge, chart);
+}
+BENCHMARK(BM_JudgeFrameEngine)->Arg(1000)->Arg(10000)->Arg(100000);
+
+// Seeking into a 100k-note chart (practice mode / replay scrubbing)
+static void BM_JudgeSeek(benchmark::State& state) {
+    Chart chart = makeChart(100000);
+    JudgementEngine engine(kPerfectMs, kGoodMs);
+    engine.load(chart.notes);
+    std::mt19937 rng(99);
+    std::uniform_real_distribution<double> position(0.0, chart.notes.back());
+
+    for (auto _ : state) {
+        engine.seek(position(rng));
+        benchmark::DoNotOptimize(engine.getCursor());
+    }
+}
+BENCHMARK(BM_JudgeSeek);
@@ -0,0 +1,147 @@
+#include <benchmark/benchmark.h>
+#include <SDL.h>
+#include <SDL_mixer.h>
+#include "PcmMusic.hpp"
+#include "SongClock.hpp"
+
+#include <cmath>
+#include <fstream>
+#include <string>
+
+// Streaming (Mix_LoadMUS) versus pre-decoded (PcmMusic) playback of the game's song, on SDL's
+// dummy audio driver: song-start cost, memory held, and how closely the position read each
+// millisecond follows a line fitted through it (SongClock prediction error at each audio step).
+namespace {
+
+constexpr int kBufferSamples = 512;
+constexpr double kPlayMs = 3000.0;
+
+// Benchmarks run from the build tree; look upwards for the song
+std::string findSong() {
+    static const char* candidates[] = {
+        "assets/audio/meowstro_short_ver.mp3",
+        "../assets/audio/meowstro_short_ver.mp3",
+        "../../assets/audio/meowstro_short_ver.mp3",
+        "../../../assets/audio/meowstro_short_ver.mp3"
+    };
+    for (const char* path : candidates) {
+        if (std::ifstream(path).good()) {
+            return path;
+        }
+    }
+    return std::string();
+}
+
+double fileSize(const std::string& path) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    return static_cast<double>(file.tellg());
+}
+
+bool openDevice() {
+    static bool opened = false;
+    if (!opened) {
+        SDL_setenv("SDL_AUDIODRIVER", "dummy", 1);
+        opened = SDL_InitSubSystem(SDL_INIT_AUDIO) == 0 &&
+                 Mix_OpenAudio(44100, MIX_DEFAULT_FORMAT, 2, kBufferSamples) == 0;
+    }
+    return opened;
+}
+
+// Feeds the position into a SongClock every millisecond for kPlayMs
+SongClockStats measureClock(MusicPosition (*position)(void*), void* source) {
+    SongClock clock;
+    const double startMs = SongClock::hostTimeMs();
+    clock.start(startMs);
+    for (double nowMs = startMs; nowMs - startMs < kPlayMs; nowMs = SongClock::hostTimeMs()) {
+        const MusicPosition sample = position(source);
+        clock.update(nowMs, sample.positionMs, sample.hostMs);
+        SDL_Delay(1);
+    }
+    return clock.getStats();
+}
+
+void reportClock(benchmark::State& state, const SongClockStats& stats) {
+    state.counters["steps"] = static_cast<double>(stats.samples);
+    state.counters["mean_error_ms"] = stats.meanErrorMs;
+    state.counters["max_error_ms"] = stats.maxErrorMs;
+    state.counters["resyncs"] = static_cast<double>(stats.resyncs);
+}
+
+} // namespace
+
+// Streaming start: open the MP3; decoding then happens on the audio thread during play
+static void BM_MusicOpenStream(benchmark::State& state) {
+    const std::string song = findSong();
+    if (song.empty() || !openDevice()) {
+        state.SkipWithError("Song or audio device not available");
+        return;
+    }
+    for (auto _ : state) {
+        Mix_Music* music = Mix_LoadMUS(song.c_str());
+        benchmark::DoNotOptimize(music);
+        Mix_FreeMusic(music);
+    }
+    state.counters["resident_bytes"] = fileSize(song); // The compressed file is what stays in memory
+}
+BENCHMARK(BM_MusicOpenStream)->Unit(benchmark::kMillisecond);
+
+// Pre-decoded start: the whole song to PCM (done on a worker while the menu is shown)
+static void BM_MusicDecodePcm(benchmark::State& state) {
+    const std::string song = findSong();
+    if (song.empty() || !openDevice()) {
+        state.SkipWithError("Song or audio device not available");
+        return;
+    }
+    PcmMusicStats stats;
+    for (auto _ : state) {
+        PcmMusic music;
+        music.startDecode(song);
+        benchmark::DoNotOptimize(music.waitForDecode());
+        stats = music.getStats();
+    }
+    state.counters["resident_bytes"] = static_cast<double>(stats.bytes);
+    state.counters["song_ms"] = stats.durationMs;
+}
+BENCHMARK(BM_MusicDecodePcm)->Unit(benchmark::kMillisecond);
+
+// Position jitter while streaming: Mix_GetMusicPosition, sampled when read
+static void BM_MusicClockStream(benchmark::State& state) {
+    const std::string song = findSong();
+    if (song.empty() || !openDevice()) {
+        state.SkipWithError("Song or audio device not available");
+        return;
+    }
+    Mix_Music* music = Mix_LoadMUS(song.c_str());
+    SongClockStats stats;
+    for (auto _ : state) {
+        Mix_PlayMusic(music, 0);
+        stats = measureClock([](void* source) {
+            MusicPosition position;
+            position.positionMs = Mix_GetMusicPosition(static_cast<Mix_Music*>(source)) * 1000.0;
+            return position;
+        }, music);
+        Mix_HaltMusic();
+    }
+    Mix_FreeMusic(music);
+    reportClock(state, stats);
+}
+BENCHMARK(BM_MusicClockStream)->Iterations(1)->Unit(benchmark::kMillisecond);
+
+// Position jitter from the PCM play cursor, stamped in the mixer callback
+static void BM_MusicClockPcm(benchmark::State& state) {
+    const std::string song = findSong();
+    if (song.empty() || !openDevice()) {
+        state.SkipWithError("Song or audio device not available");
+        return;
+    }
+    PcmMusic music;
+    music.startDecode(song);
+    SongClockStats stats;
+    for (auto _ : state) {
+        music.play();
+        stats = measureClock([](void* source) { return static_cast<PcmMusic*>(source)->getPosition(); }, &music);
+        music.stop();
+    }
+    reportClock(state, stats);
+}
+BENCHMARK(BM_MusicClockPcm)->Iterations(1)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,91 @@
+#include <benchmark/benchmark.h>
+#include <SDL.h>
+#include "RenderWindow.hpp"
+#include "Sprite.hpp"
+
+#include <memory>
+#include <vector>
+
+// RenderWindow::render (one SDL_RenderCopy per sprite) and the batched submit path on SDL's
+// software renderer, which does the blending on the CPU: a stable baseline that CI machines
+// without a GPU can run. Fish-sized sprites spread over the three fish textures.
+namespace {
+
+constexpr int kTextureCount = 3;
+
+class SoftwareFixture {
+public:
+    SoftwareFixture() {
+        SDL_Init(SDL_INIT_VIDEO);
+
+        SDL_SetHint(SDL_HINT_RENDER_DRIVER, "software");
+        window = std::make_unique<RenderWindow>("Software Render Benchmark", 1920, 1080, SDL_WINDOW_HIDDEN);
+        SDL_ResetHint(SDL_HINT_RENDER_DRIVER);
+
+        if (window->isValid()) {
+            for (int i = 0; i < kTextureCount; ++i) {
+                textures.push_back(SDL_CreateTexture(window->getRenderer(), SDL_PIXELFORMAT_RGBA32,
+                                                     SDL_TEXTUREACCESS_STATIC, 768, 128));
+            }
+        }
+    }
+
+    ~SoftwareFixture() {
+        for (SDL_Texture* texture : textures) {
+            SDL_DestroyTexture(texture);
+        }
+        window.reset();
+        SDL_Quit();
+    }
+
+    std::unique_ptr<RenderWindow> window;
+    std::vector<SDL_Texture*> textures;
+};
+
+SoftwareFixture& fixture() {
+    static SoftwareFixture instance;
+    return instance;
+}
+
+void renderFrame(benchmark::State& state, bool batched) {
+    SoftwareFixture& software = fixture();
+    if (!software.window->isValid()) {
+        state.SkipWithError("Failed to create software renderer");
+        return;
+    }
+
+    std::vector<Sprite> sprites;
+    for (int i = 0; i < state.range(0); ++i) {
+        sprites.emplace_back(Sprite(static_cast<float>((i * 37) % 1800), static_cast<float>(600 + (i * 13) % 400),
+                                    software.textures[i % kTextureCount], 1, 6));
+    }
+
+    for (auto _ : state) {
+        software.window->clear();
+        for (auto& sprite : sprites) {
+            if (batched) {
+                software.window->submit(sprite);
+            } else {
+                software.window->render(sprite);
+            }
+        }
+        software.window->display();
+    }
+
+    const RenderStats& stats = software.window->getFrameStats();
+    state.counters["draw_calls_per_frame"] = stats.drawCalls;
+    state.counters["texture_binds_per_frame"] = stats.textureBinds;
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} // namespace
+
+static void BM_SoftwareRender(benchmark::State& state) {
+    renderFrame(state, false);
+}
+BENCHMARK(BM_SoftwareRender)->Arg(25)->Arg(100)->Arg(500)->Unit(benchmark::kMicrosecond);
+
+static void BM_SoftwareSubmit(benchmark::State& state) {
+    renderFrame(state, true);
+}
+BENCHMARK(BM_SoftwareSubmit)->Arg(25)->Arg(100)->Arg(500)->Unit(benchmark::kMicrosecond);
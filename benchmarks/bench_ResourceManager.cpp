@@ -0,0 +1,138 @@
+#include <benchmark/benchmark.h>
+#include <SDL.h>
+#include <SDL_ttf.h>
+#include "RenderWindow.hpp"
+#include "ResourceManager.hpp"
+
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Cache hits for text textures, which menus and the end screen look up every frame: the string
+// API (createTextTexture - font key string plus interned text lookup) against resolving a handle
+// kept from acquireTextTexture. Every string is created before timing, so nothing rasterizes.
+// The range is how many distinct strings are cycled through.
+namespace {
+
+// Benchmarks run from the build tree; look upwards for the game font
+std::string findFont() {
+    static const char* candidates[] = {
+        "assets/fonts/Comic Sans MS.ttf",
+        "../assets/fonts/Comic Sans MS.ttf",
+        "../../assets/fonts/Comic Sans MS.ttf",
+        "../../../assets/fonts/Comic Sans MS.ttf"
+    };
+    for (const char* path : candidates) {
+        if (std::ifstream(path).good()) {
+            return path;
+        }
+    }
+    return std::string();
+}
+
+constexpr int kFontSize = 55;
+constexpr SDL_Color kColor = {255, 255, 100, 255};
+
+class TextFixture {
+public:
+    TextFixture() : fontPath(findFont()) {
+        SDL_Init(SDL_INIT_VIDEO);
+        TTF_Init();
+
+        // Software renderer, so results do not depend on the GPU driver of the machine running them
+        SDL_SetHint(SDL_HINT_RENDER_DRIVER, "software");
+        window = std::make_unique<RenderWindow>("Text Cache Benchmark", 640, 360, SDL_WINDOW_HIDDEN);
+        SDL_ResetHint(SDL_HINT_RENDER_DRIVER);
+
+        if (window->isValid()) {
+            resources = std::make_unique<ResourceManager>(window->getRenderer());
+            resources->setTextureBudget(256 * 1024 * 1024); // Keep every string resident
+        }
+    }
+
+    ~TextFixture() {
+        resources.reset();
+        window.reset();
+        TTF_Quit();
+        SDL_Quit();
+    }
+
+    std::string fontPath;
+    std::unique_ptr<RenderWindow> window;
+    std::unique_ptr<ResourceManager> resources;
+};
+
+TextFixture& fixture() {
+    static TextFixture instance;
+    return instance;
+}
+
+std::vector<std::string> makeStrings(int count) {
+    std::vector<std::string> strings;
+    for (int i = 0; i < count; ++i) {
+        strings.push_back("SCORE " + std::to_string(i * 500));
+    }
+    return strings;
+}
+
+bool ready(benchmark::State& state, TextFixture& text) {
+    if (!text.resources || !text.resources->isValid()) {
+        state.SkipWithError("Failed to create render window");
+        return false;
+    }
+    if (text.fontPath.empty()) {
+        state.SkipWithError("Font asset not available");
+        return false;
+    }
+    return true;
+}
+
+} // namespace
+
+static void BM_TextTextureStringHit(benchmark::State& state) {
+    TextFixture& text = fixture();
+    if (!ready(state, text)) {
+        return;
+    }
+
+    const std::vector<std::string> strings = makeStrings(static_cast<int>(state.range(0)));
+    for (const std::string& string : strings) {
+        text.resources->createTextTexture(text.fontPath, kFontSize, string, kColor);
+    }
+
+    const TextureCacheStats before = text.resources->getTextureCacheStats();
+    size_t next = 0;
+    for (auto _ : state) {
+        SDL_Texture* texture = text.resources->createTextTexture(text.fontPath, kFontSize, strings[next], kColor);
+        benchmark::DoNotOptimize(texture);
+        next = (next + 1) % strings.size();
+    }
+
+    state.counters["misses"] = static_cast<double>(text.resources->getTextureCacheStats().misses - before.misses);
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TextTextureStringHit)->Arg(1)->Arg(64)->Arg(1024);
+
+static void BM_TextTextureHandleHit(benchmark::State& state) {
+    TextFixture& text = fixture();
+    if (!ready(state, text)) {
+        return;
+    }
+
+    const std::vector<std::string> strings = makeStrings(static_cast<int>(state.range(0)));
+    FontHandle font = text.resources->acquireFont(text.fontPath, kFontSize);
+    std::vector<TextureHandle> handles;
+    for (const std::string& string : strings) {
+        handles.push_back(text.resources->acquireTextTexture(font, string, kColor));
+    }
+
+    size_t next = 0;
+    for (auto _ : state) {
+        SDL_Texture* texture = text.resources->getTexture(handles[next]);
+        benchmark::DoNotOptimize(texture);
+        next = (next + 1) % handles.size();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TextTextureHandleHit)->Arg(1)->Arg(64)->Arg(1024);
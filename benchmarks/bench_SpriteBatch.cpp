@@ -0,0 +1,85 @@
+#include <benchmark/benchmark.h>
+#include <SDL.h>
+#include "RenderWindow.hpp"
+#include "Sprite.hpp"
+
+#include <memory>
+#include <vector>
+
+// Many fish and hit-text popups spread over five standalone textures, drawn either with
+// one RenderCopy per sprite or through the sprite batch. The batched frame should cost
+// roughly the same per sprite count as long as the texture count stays fixed.
+namespace {
+
+constexpr int kTextureCount = 5; // Three fish colours plus the two hit-text popups
+
+class BatchFixture {
+public:
+    BatchFixture() {
+        SDL_Init(SDL_INIT_VIDEO);
+        window = std::make_unique<RenderWindow>("Batch Benchmark", 1920, 1080, SDL_WINDOW_HIDDEN);
+        for (int i = 0; i < kTextureCount; ++i) {
+            textures.push_back(SDL_CreateTexture(window->getRenderer(), SDL_PIXELFORMAT_RGBA32,
+                                                 SDL_TEXTUREACCESS_STATIC, 768, 128));
+        }
+    }
+
+    ~BatchFixture() {
+        for (SDL_Texture* texture : textures) {
+            SDL_DestroyTexture(texture);
+        }
+        window.reset();
+        SDL_Quit();
+    }
+
+    std::unique_ptr<RenderWindow> window;
+    std::vector<SDL_Texture*> textures;
+};
+
+BatchFixture& fixture() {
+    static BatchFixture instance;
+    return instance;
+}
+
+void renderSprites(benchmark::State& state, bool batched) {
+    BatchFixture& batch = fixture();
+    if (!batch.window->isValid()) {
+        state.SkipWithError("Failed to create render window");
+        return;
+    }
+
+    std::vector<Sprite> sprites;
+    for (int i = 0; i < state.range(0); ++i) {
+        Sprite sprite((i * 37) % 1800, 600 + (i * 13) % 400, batch.textures[i % kTextureCount], 1, 6);
+        sprites.push_back(sprite);
+    }
+
+    for (auto _ : state) {
+        batch.window->clear();
+        for (auto& sprite : sprites) {
+            if (batched) {
+                batch.window->submit(sprite);
+            } else {
+                batch.window->render(sprite);
+            }
+        }
+        batch.window->display();
+    }
+
+    const RenderStats& stats = batch.window->getFrameStats();
+    state.counters["draw_calls_per_frame"] = stats.drawCalls;
+    state.counters["texture_binds_per_frame"] = stats.textureBinds;
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} // namespace
+
+static void BM_SpritesImmediate(benchmark::State& state) {
+    renderSprites(state, false);
+}
+BENCHMARK(BM_SpritesImmediate)->Arg(100)->Arg(500)->Arg(2000)->Unit(benchmark::kMicrosecond);
+
+static void BM_SpritesBatched(benchmark::State& state) {
+    renderSprites(state, true);
+}
+BENCHMARK(BM_SpritesBatched)->Arg(100)->Arg(500)->Arg(2000)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,125 @@
+#include <benchmark/benchmark.h>
+#include <SDL.h>
+#include <SDL_image.h>
+#include "RenderWindow.hpp"
+#include "TextureAtlas.hpp"
+#include "Sprite.hpp"
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Gameplay scene with the same image sizes as assets/images, drawn in the same order as
+// RhythmGame::render (ocean, fish, boat, hook, fisher). Compares one texture per image
+// against a single atlas page and reports texture binds per frame.
+namespace {
+
+struct SceneImage {
+    std::string name;
+    int width;
+    int height;
+};
+
+const std::vector<SceneImage> kSceneImages = {
+    {"ocean", 1920, 1080}, {"blue_fish", 768, 128}, {"green_fish", 768, 128},
+    {"gold_fish", 768, 128}, {"boat", 512, 256}, {"fisher", 384, 256}, {"hook", 106, 200}
+};
+
+constexpr int kFishCount = 25;
+
+class SceneFixture {
+public:
+    SceneFixture() {
+        SDL_Init(SDL_INIT_VIDEO);
+        window = std::make_unique<RenderWindow>("Atlas Benchmark", 1920, 1080, SDL_WINDOW_HIDDEN);
+
+        std::vector<std::pair<std::string, SDL_Surface*>> surfaces;
+        for (const auto& image : kSceneImages) {
+            SDL_Surface* surface = SDL_CreateRGBSurfaceWithFormat(0, image.width, image.height, 32, SDL_PIXELFORMAT_RGBA32);
+            SDL_FillRect(surface, nullptr, SDL_MapRGBA(surface->format, 40, 80, 160, 255));
+            separate[image.name] = SDL_CreateTextureFromSurface(window->getRenderer(), surface);
+            surfaces.emplace_back(image.name, surface);
+        }
+
+        atlas.build(window->getRenderer(), surfaces, 2048);
+
+        for (auto& surface : surfaces) {
+            SDL_FreeSurface(surface.second);
+        }
+    }
+
+    ~SceneFixture() {
+        for (auto& pair : separate) {
+            SDL_DestroyTexture(pair.second);
+        }
+        atlas.release();
+        window.reset();
+        SDL_Quit();
+    }
+
+    TextureRegion region(const std::string& name, bool useAtlas) {
+        if (useAtlas) {
+            return atlas.find(name);
+        }
+        TextureRegion standalone;
+        standalone.texture = separate[name];
+        SDL_QueryTexture(standalone.texture, nullptr, nullptr, &standalone.rect.w, &standalone.rect.h);
+        return standalone;
+    }
+
+    std::unique_ptr<RenderWindow> window;
+    TextureAtlas atlas;
+    std::unordered_map<std::string, SDL_Texture*> separate;
+};
+
+SceneFixture& scene() {
+    static SceneFixture fixture;
+    return fixture;
+}
+
+void renderScene(benchmark::State& state, bool useAtlas) {
+    SceneFixture& fixture = scene();
+    if (!fixture.window->isValid()) {
+        state.SkipWithError("Failed to create render window");
+        return;
+    }
+
+    const char* fishNames[] = {"blue_fish", "green_fish", "gold_fish"};
+    Entity ocean(0, 0, fixture.region("ocean", useAtlas));
+    Sprite boat(150, 350, fixture.region("boat", useAtlas), 1, 1);
+    Sprite hook(430, 215, fixture.region("hook", useAtlas), 1, 1);
+    Sprite fisher(300, 200, fixture.region("fisher", useAtlas), 1, 2);
+    std::vector<Sprite> fish;
+    for (int i = 0; i < kFishCount; ++i) {
+        fish.emplace_back(100.0f + i * 70.0f, 720.0f, fixture.region(fishNames[i % 3], useAtlas), 1, 6);
+    }
+
+    for (auto _ : state) {
+        fixture.window->clear();
+        fixture.window->render(ocean);
+        for (auto& sprite : fish) {
+            fixture.window->render(sprite);
+        }
+        fixture.window->render(boat);
+        fixture.window->render(hook);
+        fixture.window->render(fisher);
+        fixture.window->display();
+    }
+
+    const RenderStats& stats = fixture.window->getFrameStats();
+    state.counters["draw_calls_per_frame"] = stats.drawCalls;
+    state.counters["texture_binds_per_frame"] = stats.textureBinds;
+}
+
+} // namespace
+
+static void BM_SceneSeparateTextures(benchmark::State& state) {
+    renderScene(state, false);
+}
+BENCHMARK(BM_SceneSeparateTextures)->Unit(benchmark::kMicrosecond);
+
+static void BM_SceneAtlas(benchmark::State& state) {
+    renderScene(state, true);
+}
+BENCHMARK(BM_SceneAtlas)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstdint>
+
+// Animation state for hook throwing
+struct HookAnimationState {
+    bool isThrowing;
+    bool isReturning;
+    std::uint32_t throwStartTime;
+    int throwDuration;
+    int hookStartX;
+    int hookStartY;
+    int hookTargetX;
+    int hookTargetY;
+
+    HookAnimationState()
+        : isThrowing(false), isReturning(false), throwStartTime(0)
+        , throwDuration(0), hookStartX(0), hookStartY(0)
+        , hookTargetX(0), hookTargetY(0) {}
+};
+
+// Animation state for fisher
+struct FisherAnimationState {
+    static constexpr double kThrowPoseMs = 100.0; // Two frames of the original 20 FPS loop
+
+    bool thrown;
+    double thrownTimeLeftMs;
+
+    FisherAnimationState() : thrown(false), thrownTimeLeftMs(kThrowPoseMs) {}
+};
+
+// Position at the previous and current simulation step; rendering blends between them
+struct InterpolatedPosition {
+    float prevX = 0.0f;
+    float prevY = 0.0f;
+    float x = 0.0f;
+    float y = 0.0f;
+
+    // Jump without blending (spawn, reset)
+    void snap(float newX, float newY) {
+        prevX = x = newX;
+        prevY = y = newY;
+    }
+    // Record the result of a simulation step
+    void advance(float newX, float newY) {
+        prevX = x;
+        prevY = y;
+        x = newX;
+        y = newY;
+    }
+    // alpha = 0 is the previous step, 1 the current one
+    float lerpX(float alpha) const { return prevX + (x - prevX) * alpha; }
+    float lerpY(float alpha) const { return prevY + (y - prevY) * alpha; }
+};
+
+// Idle sway added to a base position (whole pixels, like the original)
+struct SwayOffset {
+    int x = 0;
+    int y = 0;
+};
+
+// Animation maths for GameSimulation, on plain positions.
+// Nothing here touches SDL, so the simulation can run without a window.
+namespace Animation {
+    // Sway at timeSeconds; phase staggers sprites so they do not move in lockstep
+    SwayOffset sway(float timeSeconds, float phase = 0.0f);
+
+    // Move a hook throw to now (same clock as state.throwStartTime). Returns true and sets x, y
+    // when the throw placed the hook this call, including the call that brings it back.
+    bool stepHookThrow(HookAnimationState& state, std::uint32_t now, int& x, int& y);
+
+    void startFisherThrow(FisherAnimationState& state);
+    // Advance the throw pose by stepMs; returns the fisher sheet column (2 while thrown)
+    int stepFisherThrow(FisherAnimationState& state, double stepMs);
+}
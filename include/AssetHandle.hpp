@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstdint>
+
+// Compact reference to an asset registered with ResourceManager. The index selects a
+// slot in a flat array; the generation changes whenever the slot is released, so a
+// handle kept past release() or cleanup() resolves to nullptr instead of a dangling
+// pointer. Generation 0 is never issued, so a default handle is always invalid.
+template <typename Tag>
+struct AssetHandle {
+    std::uint32_t index = 0;
+    std::uint32_t generation = 0;
+
+    bool isValid() const { return generation != 0; }
+
+    bool operator==(const AssetHandle& other) const {
+        return index == other.index && generation == other.generation;
+    }
+    bool operator!=(const AssetHandle& other) const { return !(*this == other); }
+};
+
+using TextureHandle = AssetHandle<struct TextureHandleTag>;
+using FontHandle = AssetHandle<struct FontHandleTag>;
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "MappedFile.hpp"
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Single-file archive of pre-decoded assets, built by the meowstro_pack tool.
+//
+// Layout (little-endian):
+//   header   magic "MWPK", version, entry count, TOC offset and size
+//   data     one block per entry, each starting on a 16-byte boundary
+//            (images are tightly packed RGBA32 rows, fonts are the raw TTF bytes)
+//   TOC      per entry: type, width, height, name length, data offset, data size, name
+enum class AssetPackEntryType : std::uint32_t {
+    Image = 1,
+    Font = 2
+};
+
+struct AssetPackEntry {
+    AssetPackEntryType type = AssetPackEntryType::Image;
+    int width = 0;                      // Images only
+    int height = 0;
+    const std::uint8_t* data = nullptr; // Points into the mapped file
+    size_t size = 0;
+};
+
+class AssetPack {
+public:
+    static constexpr std::uint32_t kVersion = 1;
+
+    AssetPack() = default;
+    ~AssetPack() = default;
+
+    AssetPack(const AssetPack&) = delete;
+    AssetPack& operator=(const AssetPack&) = delete;
+
+    // Map the pack and index its table of contents; entries stay valid until close()
+    bool open(const std::string& packPath);
+    void close();
+
+    bool isOpen() const { return m_file.isOpen(); }
+    size_t getEntryCount() const { return m_entries.size(); }
+
+    // Look up by asset path as used in GameConfig ("./assets/images/boat.png" and
+    // "assets/images/boat.png" name the same entry); nullptr if not packed
+    const AssetPackEntry* find(const std::string& assetPath) const;
+
+    // Strip leading "./" and use forward slashes so pack keys match config paths
+    static std::string normalizePath(const std::string& assetPath);
+
+private:
+    MappedFile m_file;
+    std::unordered_map<std::string, AssetPackEntry> m_entries;
+};
+
+// Builds a pack file in memory and writes it out (used by meowstro_pack and tests)
+class AssetPackWriter {
+public:
+    void addImage(const std::string& assetPath, int width, int height, const void* rgbaPixels);
+    void addFont(const std::string& assetPath, std::vector<std::uint8_t> fontBytes);
+
+    size_t getEntryCount() const { return m_entries.size(); }
+    bool write(const std::string& packPath) const;
+
+private:
+    struct PendingEntry {
+        std::string name;
+        AssetPackEntryType type;
+        int width;
+        int height;
+        std::vector<std::uint8_t> bytes;
+    };
+    std::vector<PendingEntry> m_entries;
+};
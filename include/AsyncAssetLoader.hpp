@@ -0,0 +1,117 @@
+#pragma once
+
+#include "TextureAtlas.hpp"
+
+#include <SDL.h>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+class ResourceManager;
+class AssetPack;
+struct AssetPackEntry;
+
+enum class AssetLoadStatus {
+    Pending,    // Queued or decoding on a worker thread
+    Ready,      // Uploaded on the render thread and available from ResourceManager
+    Failed      // At least one image could not be decoded or uploaded
+};
+
+// Handle returned by async requests - cheap to copy, poll it from the render thread
+class AssetLoadHandle {
+public:
+    AssetLoadHandle() = default;
+
+    bool isValid() const { return state != nullptr; }
+    AssetLoadStatus getStatus() const { return state ? state->status.load() : AssetLoadStatus::Failed; }
+    bool isReady() const { return getStatus() == AssetLoadStatus::Ready; }
+    bool isDone() const { return getStatus() != AssetLoadStatus::Pending; }
+
+    // Texture for single image requests once ready (nullptr for atlas requests)
+    SDL_Texture* getTexture() const { return state ? state->texture : nullptr; }
+
+private:
+    friend class AsyncAssetLoader;
+
+    struct State {
+        std::atomic<AssetLoadStatus> status{AssetLoadStatus::Pending};
+        SDL_Texture* texture = nullptr; // Only touched on the render thread
+    };
+    std::shared_ptr<State> state;
+};
+
+// Decodes PNGs with IMG_Load on worker threads and hands the surfaces to the
+// render thread, which uploads them within a per-frame time budget. Atlases are
+// uploaded an image at a time, so one large atlas also spreads over several frames.
+class AsyncAssetLoader {
+public:
+    explicit AsyncAssetLoader(int workerCount = 2);
+    ~AsyncAssetLoader();
+
+    AsyncAssetLoader(const AsyncAssetLoader&) = delete;
+    AsyncAssetLoader& operator=(const AsyncAssetLoader&) = delete;
+
+    // Packed images skip decoding: workers wrap the mapped pixels instead of calling IMG_Load
+    void setAssetPack(const AssetPack* assetPack);
+
+    // Surface view over a packed RGBA image (does not copy or own the pixels)
+    static SDL_Surface* wrapPackImage(const AssetPackEntry& entry);
+
+    // Queue one image; it is cached under its path once uploaded
+    AssetLoadHandle requestImage(const std::string& filePath);
+
+    // Queue a group of images that is packed into a named atlas once all of them are decoded
+    AssetLoadHandle requestAtlas(const std::string& atlasName, const std::vector<std::string>& imagePaths, int pageSize);
+
+    // Render thread only: upload decoded images until budgetMs has been spent (always at least one).
+    // An atlas that is not finished resumes on the next call. Returns the images uploaded.
+    int pumpUploads(ResourceManager& resourceManager, double budgetMs);
+
+    // Render thread only: block until every request has been decoded and uploaded
+    void finishAll(ResourceManager& resourceManager);
+
+    // Fraction of requested images that are fully uploaded, 1.0 when idle
+    float getProgress() const;
+    bool isIdle() const;
+
+private:
+    struct Job {
+        bool isAtlas = false;
+        std::string name;                    // Cache key or atlas name
+        std::vector<std::string> paths;
+        std::vector<SDL_Surface*> surfaces;  // Filled by workers, same order as paths
+        int pageSize = 0;
+        int remainingDecodes = 0;
+        std::shared_ptr<AssetLoadHandle::State> state;
+        std::unique_ptr<TextureAtlas> atlas; // Being uploaded, handed to ResourceManager when done
+        size_t uploadedImages = 0;
+    };
+
+    struct DecodeTask {
+        std::shared_ptr<Job> job;
+        size_t index;
+    };
+
+    void workerLoop();
+    // Uploads one image of the job; returns true once the job is complete
+    bool uploadNext(ResourceManager& resourceManager, Job& job);
+    void finishJob(Job& job, bool uploaded);
+
+    std::vector<std::thread> m_workers;
+    mutable std::mutex m_mutex;
+    std::condition_variable m_taskAvailable;
+    std::condition_variable m_jobDecoded;
+    std::deque<DecodeTask> m_tasks;
+    std::deque<std::shared_ptr<Job>> m_decodedJobs;
+    std::vector<std::shared_ptr<Job>> m_activeJobs;
+    std::shared_ptr<Job> m_uploadingJob;    // Render thread only: partly uploaded atlas
+    const AssetPack* m_assetPack;
+    size_t m_requestedImages;
+    size_t m_uploadedImages;
+    bool m_stopping;
+};
@@ -1,9 +1,25 @@
 #pragma once
 #include <iostream>
 #include <string>
+#include <vector>
+#include <atomic>
+#include <cstddef>
 #include <SDL.h>
 #include <SDL_mixer.h>
+#include "PcmMusic.hpp"
 
+// What the mixer device actually runs at, which can differ from GameConfig::AudioConfig
+struct AudioDeviceSpec {
+	int frequency = 0;
+	Uint16 format = 0;
+	int channels = 0;
+	int bufferSamples = 0;         // Frames per mixer callback; measured once the first callback runs
+	double outputLatencyMs = 0.0;  // One buffer plus AudioConfig::deviceLatencyMs
+};
+
+// Opens the mixer device from GameConfig::AudioConfig. SDL_mixer has one device per process and
+// reference-counts opens, so a second Audio shares it; the first one installs a post-mix hook that
+// measures the real buffer size and counts late callbacks (underruns).
 class Audio {
 public:
 	Audio();
@@ -12,11 +28,51 @@ public:
 	void stopBackgroundMusic();
 	bool isValid() const { return m_valid; }
 	
-	// Get precise audio position for beat synchronization
-	double getMusicPositionMs() const;
+	// Precise audio position for beat synchronization, with the host time it was taken at when known.
+	// Read it once per update: the two values always come from the same mixer callback.
+	MusicPosition getMusicPosition() const;
+	bool isMusicPlaying() const;
+	
+	// With AudioConfig::predecodeMusic, start decoding a song to PCM in the background so
+	// playBackgroundMusic can start it from memory; otherwise does nothing
+	void preloadMusic(const std::string& filePath);
+	
+	// Short metronome click, synthesized on first use (calibration screen)
+	bool playClick();
+	
+	AudioDeviceSpec getDeviceSpec() const;
+	// Mixer position to speakers; SongClock subtracts this from the music position
+	double getOutputLatencyMs() const { return getDeviceSpec().outputLatencyMs; }
+	
+	// Mixer callbacks that came more than two buffers apart since the current song started
+	size_t getUnderrunCount() const { return s_lateCallbacks.load(std::memory_order_relaxed); }
+	
+	// Between songs: if the last one underran, reopen the device with a doubled buffer and save it.
+	// Returns true when the buffer was changed.
+	bool recoverFromUnderruns();
 
 private:
+	bool openDevice(int bufferSamples);
+	void closeDevice();
+	bool createClick();
+	void freeClick();
+	
 	Mix_Music* bgMusic;
+	PcmMusic m_pcmMusic;
+	bool m_usingPcm;               // The current song plays from m_pcmMusic rather than bgMusic
+	Mix_Chunk* m_click;
+	std::vector<Uint8> m_clickPcm; // Samples behind m_click, which does not own them
+	int m_requestedSamples;
+	bool m_ownsDevice;             // Opened the device and installed the post-mix hook
 	bool m_valid;
+	
+	// Written by the post-mix hook on the audio thread
+	static std::atomic<int> s_frequency;
+	static std::atomic<int> s_frameBytes;
+	static std::atomic<int> s_callbackFrames;
+	static std::atomic<double> s_lastCallbackMs;
+	static std::atomic<size_t> s_lateCallbacks;
+	
+	static void SDLCALL postMix(void* userdata, Uint8* stream, int len);
 };
 
@@ -17,9 +17,17 @@ public:
     double beatToTimestampMs(double beat, int bpm);
     double timestampMsToBeat(double timestampMs, int bpm);
 
-    // Hit registration and evaluation
+    // Global input offset from calibration (positive when taps land late)
+    void setInputOffsetMs(double offsetMs);
+    double getInputOffsetMs() const;
+    // Tap time moved onto the song timeline the player actually heard
+    double applyInputOffset(double actualMs) const;
+
+    // Hit registration and evaluation. Only compares the two times: pass applyInputOffset(tap)
+    // to judge a calibrated tap.
     short int checkHit(double expectedMs, double actualMs);
 private:
     const double PERFECT_WINDOW_MS = 60.0;
     const double GOOD_WINDOW_MS = 120.0;
+    double m_inputOffsetMs = 0.0;
 };
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+// Outcome of a calibration run. offsetMs is how long after a click was triggered the player's
+// taps arrive - audio output latency, input latency and the player's own habit combined.
+struct CalibrationResult {
+    bool valid = false;      // Enough taps survived outlier rejection
+    double offsetMs = 0.0;   // Mean of the accepted tap offsets
+    double jitterMs = 0.0;   // Standard deviation of the accepted tap offsets
+    size_t taps = 0;         // Taps matched to a scored click
+    size_t rejected = 0;     // Of those, taps dropped as outliers or repeats
+};
+
+// Collects metronome click times and the player's taps (both in host ms) and estimates the
+// global input offset. Each tap is paired with the nearest click; offsets further than
+// outlierMads scaled median absolute deviations from the median are dropped before averaging,
+// so a missed beat or a stray double tap does not drag the estimate.
+class Calibration {
+public:
+    Calibration(size_t leadInClicks = 4, size_t minTaps = 8, double outlierMads = 3.0);
+
+    void reset();
+
+    // Clicks must be added in time order; taps may arrive before the click they belong to
+    void addClick(double hostMs);
+    void addTap(double hostMs);
+
+    size_t getClickCount() const { return m_clicks.size(); }
+    size_t getTapCount() const { return m_taps.size(); }
+
+    CalibrationResult compute() const;
+
+    // Robust mean and jitter of raw tap offsets
+    static CalibrationResult analyze(std::vector<double> offsetsMs, size_t minTaps, double outlierMads);
+
+private:
+    size_t m_leadInClicks;  // Clicks that let the player find the beat; taps on them are ignored
+    size_t m_minTaps;
+    double m_outlierMads;
+    std::vector<double> m_clicks;
+    std::vector<double> m_taps;
+};
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <string>
+#include <vector>
+
+enum class NoteType : std::uint8_t {
+    Tap = 0,
+    Hold = 1
+};
+
+// One note, kept small so long charts stay cache friendly (16 bytes)
+struct ChartNote {
+    double timeMs;          // Song time of the note, before the chart offset
+    std::uint8_t lane;
+    NoteType type;
+};
+
+// A song chart loaded from a text .chart file:
+//
+//   version 1
+//   title <text>            (optional)
+//   music <path>            (optional)
+//   bpm <number>
+//   offset <ms>             (optional, added to every note time)
+//   scroll <px per ms>      (optional, fish speed for this chart)
+//   count <n>               (optional hint so the note array is allocated once)
+//   [notes]
+//   <time_ms> <lane> <tap|hold>
+//
+// '#' starts a comment. The file is parsed line by line, so it is never held in memory whole.
+// Charts compiled by meowstro_chartc (see CompiledChart) load without any text parsing.
+class Chart {
+public:
+    static constexpr int kFormatVersion = 1;
+    static constexpr size_t kMaxCountHint = size_t(1) << 20;  // Larger 'count' values only reserve this many notes
+
+    Chart();
+
+    // Accepts text and compiled charts
+    bool loadFromFile(const std::string& filePath);
+    // Decodes every note of a .mwch up front and unmaps it; use CompiledChart directly to decode sections on demand
+    bool loadCompiled(const std::string& filePath);
+    // sourceName is only used in error messages
+    bool load(std::istream& input, const std::string& sourceName);
+    void clear();
+
+    bool isLoaded() const { return m_loaded; }
+    const std::string& getTitle() const { return m_title; }
+    const std::string& getMusicPath() const { return m_musicPath; }
+    double getBpm() const { return m_bpm; }
+    double getOffsetMs() const { return m_offsetMs; }
+    double getScrollSpeed() const { return m_scrollSpeed; } // 0 when the chart does not set one
+
+    // Notes sorted by time
+    const std::vector<ChartNote>& getNotes() const { return m_notes; }
+    size_t getNoteCount() const { return m_notes.size(); }
+    double getNoteTimeMs(size_t index) const { return m_notes[index].timeMs + m_offsetMs; }
+
+    // Note times with the offset applied, in the form the judgement engine takes
+    std::vector<double> getNoteTimes() const;
+
+private:
+    std::string m_title;
+    std::string m_musicPath;
+    double m_bpm;
+    double m_offsetMs;
+    double m_scrollSpeed;
+    std::vector<ChartNote> m_notes;
+    bool m_loaded;
+
+    bool parseHeaderLine(const std::string& key, std::istream& values, const std::string& sourceName, int lineNumber);
+    bool parseNoteLine(std::istream& values, const std::string& sourceName, int lineNumber);
+};
@@ -0,0 +1,99 @@
+#pragma once
+
+#include "Chart.hpp"
+#include "MappedFile.hpp"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Binary chart built from a text .chart by the meowstro_chartc tool.
+//
+// Layout (little-endian):
+//   header    magic "MWCH", version, note count, notes per section, section count,
+//             bpm, offset and scroll speed (f64), then offsets of the blocks below
+//   metadata  title and music path, each a u32 length followed by the bytes
+//   index     per section: time of its first note (us) and where its times start
+//   lanes     one byte per note: lane in the low nibble, NoteType in the high nibble
+//   times     per note: LEB128 varint delta (us) from the previous note in its section;
+//             the first note of a section is relative to the section's index time
+//
+// Opening maps the file and validates the header and index only; notes are decoded on
+// demand, a section at a time, so seeking into a long chart touches one section.
+class CompiledChart {
+public:
+    static constexpr std::uint32_t kVersion = 1;
+    static constexpr std::uint32_t kDefaultNotesPerSection = 256;
+    static constexpr int kMaxLane = 15;
+    static constexpr double kTimeUnitsPerMs = 1000.0; // Note times are stored in microseconds
+
+    CompiledChart();
+    ~CompiledChart() = default;
+
+    CompiledChart(const CompiledChart&) = delete;
+    CompiledChart& operator=(const CompiledChart&) = delete;
+
+    bool open(const std::string& filePath);
+    void close();
+
+    // True if the file starts with the compiled chart magic
+    static bool isCompiledChart(const std::string& filePath);
+
+    bool isOpen() const { return m_file.isOpen(); }
+    const std::string& getTitle() const { return m_title; }
+    const std::string& getMusicPath() const { return m_musicPath; }
+    double getBpm() const { return m_bpm; }
+    double getOffsetMs() const { return m_offsetMs; }
+    double getScrollSpeed() const { return m_scrollSpeed; }
+    size_t getNoteCount() const { return m_noteCount; }
+    size_t getSectionCount() const { return m_sectionCount; }
+    size_t getNotesPerSection() const { return m_notesPerSection; }
+    size_t getFileSize() const { return m_file.size(); }
+
+    // Section holding the last note at or before songTimeMs (offset applied); 0 if none
+    size_t findSection(double songTimeMs) const;
+
+    // Index of the first note at or after songTimeMs, or getNoteCount() if there is none
+    size_t findNote(double songTimeMs) const;
+
+    // Append decoded notes (times before the offset, like Chart::getNotes()).
+    // Return false if the note data is corrupt.
+    bool decodeSection(size_t section, std::vector<ChartNote>& out) const;
+    bool decodeNotes(size_t first, size_t count, std::vector<ChartNote>& out) const;
+
+    // Every note time with the offset applied; empty if the note data is corrupt
+    std::vector<double> getNoteTimes() const;
+
+private:
+    MappedFile m_file;
+    std::string m_title;
+    std::string m_musicPath;
+    double m_bpm;
+    double m_offsetMs;
+    double m_scrollSpeed;
+    size_t m_noteCount;
+    size_t m_notesPerSection;
+    size_t m_sectionCount;
+    const std::uint8_t* m_index;
+    const std::uint8_t* m_lanes;
+    const std::uint8_t* m_times;
+    size_t m_timesSize;
+
+    std::int64_t getSectionBaseTime(size_t section) const;
+
+    // Decode up to count notes of one section, starting skip notes in
+    bool decodeSectionRange(size_t section, size_t skip, size_t count, std::vector<ChartNote>& out) const;
+};
+
+// Encodes a loaded Chart in the compiled layout (used by meowstro_chartc and tests)
+class CompiledChartWriter {
+public:
+    explicit CompiledChartWriter(std::uint32_t notesPerSection = CompiledChart::kDefaultNotesPerSection);
+
+    // Fails on notes the format cannot hold (negative times, lanes above kMaxLane)
+    bool build(const Chart& chart, std::vector<std::uint8_t>& out) const;
+    bool write(const Chart& chart, const std::string& filePath) const;
+
+private:
+    std::uint32_t m_notesPerSection;
+};
@@ -2,6 +2,7 @@
 #include <SDL.h>
 #include <SDL_image.h>
 #include "SDLTexture.hpp"
+#include "TextureAtlas.hpp"
 #include <memory>
 
 class Entity
@@ -11,6 +12,8 @@ public:
 	Entity(float x, float y, SharedSDLTexture texture);
 	// Constructor for raw SDL_Texture* (creates shared ownership)
 	Entity(float x, float y, SDL_Texture* texture);
+	// Constructor for a sub-rectangle of a shared (atlas) texture
+	Entity(float x, float y, const TextureRegion& region);
 	inline float getX() const
 	{
 		return x;
@@ -25,6 +28,11 @@ public:
 		// Return shared texture if available, otherwise raw texture
 		return texture_ ? texture_->get() : rawTexture_;
 	}
+	// Cache handle for ResourceManager-owned textures (invalid for atlas pages and owned textures)
+	inline TextureHandle getTextureHandle() const
+	{
+		return textureHandle_;
+	}
 	// Get shared texture for ownership transfer
 	inline SharedSDLTexture getSharedTexture() const
 	{
@@ -37,13 +45,17 @@ public:
 	inline void setTexture(SharedSDLTexture texture)
 	{
 		texture_ = texture;
+		textureHandle_ = TextureHandle();
 	}
 	// Set texture from raw pointer (non-owning reference)
 	inline void setTexture(SDL_Texture* texture)
 	{
 		rawTexture_ = texture;
 		texture_ = nullptr;  // Clear shared texture
+		textureHandle_ = TextureHandle();
 	}
+	// Set texture to an atlas region, frame follows the region's rect
+	void setTexture(const TextureRegion& region);
 protected:
 	// Fixed type consistency - use float to match member variables
 	inline void setX(float x)
@@ -59,4 +71,6 @@ protected:
 	SDL_Rect currentFrame;
 	SharedSDLTexture texture_;       // For owned textures
 	SDL_Texture* rawTexture_;       // For non-owned textures (ResourceManager-owned)
+	SDL_Point regionOrigin_;        // Top-left of the image inside its texture (non-zero for atlas regions)
+	TextureHandle textureHandle_;   // Resolved at draw time so evicted textures reload and released ones are skipped
 };
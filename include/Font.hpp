@@ -16,10 +16,17 @@ class Font
         Font(); // Basic Constructor 
         ~Font(); // Destructor
         bool load(const std::string& fontPath, int fontSz); // Allows us to add a font file
+        bool loadFromMemory(const void* data, size_t size, int fontSz); // Font bytes must outlive the Font (e.g. a mapped asset pack)
         void unload(); // Clean up (or unload) the font
 
         // This allows us to make the switch from text (ttf or any font file) to texture (SDL)
         SDL_Texture* renderText(SDL_Renderer* renderer, const std::string& txt, SDL_Color color); 
+
+        // Single glyph access, used to rasterize a glyph atlas once per (font, size)
+        SDL_Surface* renderGlyph(Uint16 ch, SDL_Color color); // Caller frees the surface
+        bool getGlyphMetrics(Uint16 ch, int& minX, int& advance);
+        int getKerning(Uint16 previous, Uint16 ch);
+        int getLineHeight() const;
     private: 
     TTF_Font* font; // Internal pointer, which points to the loaded font 
 };
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <SDL.h>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+// Frame time summary over the most recent frames (milliseconds)
+struct FrameTimeStats {
+    double minMs = 0.0;
+    double avgMs = 0.0;
+    double p99Ms = 0.0;
+    double maxMs = 0.0;
+    size_t frames = 0;
+};
+
+// Paces a loop to a target frame rate. endFrame() sleeps with SDL_Delay until shortly
+// before the deadline and spin-waits the rest, so frames are not rounded to whole
+// milliseconds or stretched by scheduler granularity. In VSync mode the present call
+// already blocks, so the pacer only measures.
+class FramePacer {
+public:
+    static constexpr double kDefaultSpinMs = 2.0;   // Tail of each frame that is spun instead of slept
+    static constexpr size_t kHistorySize = 1024;    // Frames kept for statistics
+
+    explicit FramePacer(double targetFps = 60.0, bool vsync = false);
+
+    // fps <= 0 disables the cap
+    void setTargetFps(double fps);
+    double getTargetFps() const { return m_targetFps; }
+    void setVSync(bool enabled) { m_vsync = enabled; }
+    bool isVSync() const { return m_vsync; }
+    void setSpinThresholdMs(double spinMs) { m_spinMs = spinMs; }
+
+    // Run task about every intervalMs while waiting for the frame deadline (e.g. to pump input);
+    // an empty task stops it. In VSync mode or uncapped the pacer does not wait, so endFrame() runs
+    // it once and loops should call runIdleTask() right before presenting.
+    void setIdleTask(std::function<void()> task, double intervalMs = 1.0);
+
+    // Run the idle task once now, if one is set
+    void runIdleTask();
+
+    // Start a new loop: the next frame is measured from now and history is cleared
+    void reset();
+
+    // Call once per frame after presenting; waits until the frame deadline and records the frame time
+    void endFrame();
+
+    double getLastFrameMs() const { return m_lastFrameMs; }
+    FrameTimeStats getStats() const;
+
+private:
+    Uint64 m_frequency;
+    Uint64 m_frameTicks;     // Target frame length in performance counter ticks, 0 when uncapped
+    Uint64 m_deadline;       // Counter value the current frame should end at
+    Uint64 m_lastFrameEnd;
+    double m_targetFps;
+    double m_spinMs;
+    double m_lastFrameMs;
+    bool m_vsync;
+
+    std::vector<float> m_history;   // Ring buffer of frame times
+    size_t m_historyNext;
+
+    std::function<void()> m_idleTask;
+    Uint64 m_idleTicks;
+
+    void waitUntil(Uint64 deadline);
+    void record(double frameMs);
+};
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <SDL.h>
+#include "Chart.hpp"
 #include <string>
 #include <vector>
 
@@ -23,6 +24,32 @@ public:
         int bpm = 147;
         double travelDuration = 2000.0; // ms before beat to start moving
         std::string backgroundMusicPath = "./assets/audio/meowstro_short_ver.mp3";
+        
+        // Decode the whole song to PCM on a worker thread while the menu is shown and play it
+        // from memory (PcmMusic), instead of streaming it through Mix_LoadMUS
+        bool predecodeMusic = false;
+        
+        // Mixer device, opened with Mix_OpenAudioDevice. The buffer is most of the output latency
+        // (512 frames at 44.1 kHz is ~12 ms; the old fixed 2048 was ~46 ms).
+        int sampleRate = 44100;
+        int bufferSamples = 512;          // Frames per mixer callback
+        int channels = 2;
+        std::string deviceName;           // Empty for the system default output
+        bool allowDeviceChanges = true;   // Take the device's own rate/channels/buffer instead of converting
+        double deviceLatencyMs = 0.0;     // OS/driver latency beyond the buffer, if known
+        
+        // Underrun fallback: a song with this many late mixer callbacks doubles the buffer
+        // (up to maxBufferSamples) before the next song, and the new size is saved
+        int underrunLimit = 3;
+        int maxBufferSamples = 4096;
+        
+        // Hit sounds (SoundEffects): voices in the channel pool and chunk volume (0-128)
+        int sfxVoices = 16;
+        int sfxVolume = 96;
+        
+        // Measured by the calibration screen and kept in the settings file. Positive when taps
+        // land late; AudioLogic subtracts it from tap times before judging.
+        double inputOffsetMs = 0.0;
     };
     
     // Visual settings
@@ -31,12 +58,29 @@ public:
         const SDL_Color BLACK = { 0, 0, 0, 255 };
         const SDL_Color RED = { 255, 0, 0, 255 };
         int frameDelay = 75; // SDL_Delay value
+        int targetFps = 60; // Frame pacer target for menus and gameplay (simulation speed does not depend on it)
+        bool vsync = false; // Let the display pace presents instead of the frame pacer
+        int atlasPageSize = 2048; // Max width/height of a texture atlas page
+        int cullMargin = 128; // Sprites this far outside the window are still drawn and animated
+        bool perfOverlay = false; // Show the performance overlay at startup (F3 toggles it in any screen)
     };
     
     // Asset paths
     struct AssetPaths {
         std::string fontPath = "./assets/fonts/Comic Sans MS.ttf";
         
+        // Note chart for the song; the build compiles it with meowstro_chartc and the
+        // compiled copy is preferred when present
+        std::string chartPath = "./assets/charts/meowstro_short_ver.chart";
+        std::string compiledChartPath = "./assets/charts/meowstro_short_ver.mwch";
+        
+        // Hit sound samples (any format Mix_LoadWAV reads); empty or unreadable uses a synthesized tone
+        std::string perfectHitSoundPath;
+        std::string goodHitSoundPath;
+        
+        // Pre-decoded images and fonts baked by meowstro_pack; loose files are used if it is missing
+        std::string assetPackPath = "./assets.mwpk";
+        
         // Image paths
         std::string oceanTexture = "./assets/images/Ocean.png";
         std::string boatTexture = "./assets/images/boat.png";
@@ -49,28 +93,75 @@ public:
         std::string blueFishTexture = "./assets/images/blue_fish.png";
         std::string greenFishTexture = "./assets/images/green_fish.png";
         std::string goldFishTexture = "./assets/images/gold_fish.png";
+        
+        // Images shown by the menus - packed synchronously at startup
+        std::vector<std::string> getMenuImagePaths() const {
+            return { menuCatTexture, selectCatTexture };
+        }
+        
+        // Images used only during a song - decoded in the background while the menu runs
+        std::vector<std::string> getGameplayImagePaths() const {
+            return { oceanTexture, boatTexture, fisherTexture, hookTexture,
+                     blueFishTexture, greenFishTexture, goldFishTexture };
+        }
+        
+        // Every image above
+        std::vector<std::string> getImagePaths() const {
+            std::vector<std::string> paths = getMenuImagePaths();
+            std::vector<std::string> gameplay = getGameplayImagePaths();
+            paths.insert(paths.end(), gameplay.begin(), gameplay.end());
+            return paths;
+        }
     };
     
     // Game mechanics
     struct GameplayConfig {
-        int numBeats = 25;
         int numFishTextures = 3;
         int throwDuration = 200; // hook animation duration
         int hookTargetX = 650;
         int hookTargetY = 625;
         int fishTargetX = 660;
+        int fishY = 720;
+        
+        // Fish x is derived from song time: fishTargetX + (noteTime - songTime) * fishSpeed.
+        // 0.2 px/ms matches the original 10 px per 50 ms update. A chart's scroll speed overrides it.
+        double fishSpeed = 0.2;
+        double fishFrameMs = 50.0; // Time per swim frame
+        
+        // Fixed simulation step; rendering interpolates between the last two steps
+        double simulationStepMs = 1000.0 / 120.0;
+        int maxSimulationSteps = 15; // Per update - beyond this the simulation skips ahead
         
-        // Fish spawn locations
-        std::vector<int> fishStartXLocations = { 
-            1352, 2350, 2465, 2800, 3145, 3330, 3480, 3663, 4175, 4560,
-            4816, 5245, 6059, 6260, 6644, 6885, 7100, 7545, 7801, 8230,
-            8775, 9145, 9531, 9829, 10160 
-        };
+        // Gameplay keys are captured by InputSampler, pumped this often while the frame pacer waits.
+        // Off: keys are read by the per-frame SDL_PollEvent loop.
+        bool inputSampling = true;
+        double inputPumpIntervalMs = 1.0;
         
-        // Beat timing data - will be initialized from AudioLogic conversion
+        // Every song is recorded here for `meowstro --replay <file>` (set by `--record <file>`); empty disables recording
+        std::string replayPath;
+        
+        // Note times in ms, filled from the loaded chart
         std::vector<double> noteBeats;
     };
     
+    // Resource cache settings
+    struct ResourceConfig {
+        size_t textureCacheBudgetBytes = 64 * 1024 * 1024; // Cached image/text textures, excluding atlases
+        int loaderThreads = 2;          // Worker threads decoding images for async loads
+        double uploadBudgetMs = 4.0;    // Render-thread time per frame spent uploading decoded images
+    };
+    
+    // Latency calibration screen, reached from the main menu
+    struct CalibrationConfig {
+        double clickBpm = 100.0;
+        int clickCount = 24;        // Clicks per run, lead-in included
+        int leadInClicks = 4;       // Not scored, so the player can find the beat first
+        int minTaps = 8;            // Accepted taps needed before an offset is saved
+        double outlierMads = 3.0;   // Taps further than this many deviations from the median are ignored
+        double maxOffsetMs = 250.0; // Larger results are treated as a failed run
+        std::string settingsPath = "./meowstro_settings.cfg";
+    };
+    
     // Font sizes
     struct FontSizes {
         int menuLogo = 75;
@@ -80,10 +171,24 @@ public:
         int gameNumbers = 35;
         int gameStats = 55;
         int hitFeedback = 30;
+        int perfOverlay = 22;
     };
     
-    // Initialization method for beat timings
-    void initializeBeatTimings();
+    // Loads the configured chart on first use; returns false if it could not be read
+    bool initializeBeatTimings();
+    
+    // Replaces the current chart and note timings with the chart at filePath
+    bool loadChart(const std::string& filePath);
+    
+    // Player settings kept between runs (calibrated input offset, audio buffer size). Returns false when the
+    // settings file is missing or could not be read/written; defaults stay in place.
+    bool loadSettings();
+    bool saveSettings() const;
+    void setInputOffsetMs(double offsetMs) { audioConfig.inputOffsetMs = offsetMs; }
+    void setAudioBufferSamples(int frames) { audioConfig.bufferSamples = frames; }
+    void setPredecodeMusic(bool enabled) { audioConfig.predecodeMusic = enabled; }
+    void setReplayPath(const std::string& path) { gameplayConfig.replayPath = path; }
+    void setSettingsPath(const std::string& path) { calibrationConfig.settingsPath = path; }
     
     // Getter methods
     const WindowConfig& getWindowConfig() const { return windowConfig; }
@@ -92,6 +197,9 @@ public:
     const AssetPaths& getAssetPaths() const { return assetPaths; }
     const GameplayConfig& getGameplayConfig() const { return gameplayConfig; }
     const FontSizes& getFontSizes() const { return fontSizes; }
+    const ResourceConfig& getResourceConfig() const { return resourceConfig; }
+    const CalibrationConfig& getCalibrationConfig() const { return calibrationConfig; }
+    const Chart& getChart() const { return chart; }
     
 private:
     GameConfig() = default;
@@ -105,4 +213,7 @@ private:
     AssetPaths assetPaths;
     GameplayConfig gameplayConfig;
     FontSizes fontSizes;
+    ResourceConfig resourceConfig;
+    CalibrationConfig calibrationConfig;
+    Chart chart;
 };
\ No newline at end of file
@@ -0,0 +1,219 @@
+#pragma once
+
+#include "AnimationState.hpp"
+#include "AudioLogic.hpp"
+#include "GameStats.hpp"
+#include "JudgementEngine.hpp"
+#include "Replay.hpp"
+#include "ViewportCuller.hpp"
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+// Song time source for GameSimulation::update. The game fuses the music position with the
+// performance counter (SongClock); tests and bots move a ManualClock themselves.
+class SimulationClock {
+public:
+    virtual ~SimulationClock() = default;
+    virtual double songTimeMs() = 0;
+};
+
+// Whether the song is still playing - the simulation is finished once it stops
+class MusicState {
+public:
+    virtual ~MusicState() = default;
+    virtual bool isMusicPlaying() const = 0;
+};
+
+// Headless clock, moved by hand
+class ManualClock : public SimulationClock {
+public:
+    explicit ManualClock(double timeMs = 0.0) : m_timeMs(timeMs) {}
+    void setTimeMs(double timeMs) { m_timeMs = timeMs; }
+    void advanceMs(double deltaMs) { m_timeMs += deltaMs; }
+    double getTimeMs() const { return m_timeMs; }
+    double songTimeMs() override { return m_timeMs; }
+
+private:
+    double m_timeMs;
+};
+
+// Headless music that plays until the clock reaches the song length
+class FixedLengthMusic : public MusicState {
+public:
+    FixedLengthMusic(const ManualClock& clock, double lengthMs) : m_clock(clock), m_lengthMs(lengthMs) {}
+    bool isMusicPlaying() const override { return m_clock.getTimeMs() < m_lengthMs; }
+
+private:
+    const ManualClock& m_clock;
+    double m_lengthMs;
+};
+
+// Everything a song needs, without GameConfig or textures. Defaults match GameConfig::GameplayConfig.
+struct SimulationConfig {
+    std::vector<double> noteTimesMs;    // Sorted ascending
+    std::uint32_t seed = 0;             // Picks each fish's variant
+    double perfectWindowMs = 60.0;
+    double goodWindowMs = 120.0;
+    double inputOffsetMs = 0.0;         // Calibrated offset, subtracted from press times before judging
+
+    double stepMs = 1000.0 / 120.0;     // Fixed simulation step
+    int maxSteps = 15;                  // Per step() call - beyond this the simulation skips ahead
+
+    double fishSpeed = 0.2;             // px/ms
+    int fishTargetX = 660;              // Fish reach this x at their note time
+    int fishY = 720;
+    double fishFrameMs = 50.0;          // Time per swim frame
+    int fishVariants = 3;
+    // Frame size (width, height) of each variant's sheet, for culling; missing variants cull as a point
+    std::vector<std::pair<int, int>> fishFrameSizes;
+    ViewportCuller culler;              // A zero-sized viewport disables culling
+
+    int throwDuration = 200;            // Hook flight each way
+    double hitPopupMs = 1000.0;         // Score popup shown in place of a caught fish
+
+    // Base positions the idle sway is added to
+    std::pair<int, int> fisherPosition = {300, 200};
+    std::pair<int, int> boatPosition = {150, 350};
+    std::pair<int, int> hookPosition = {430, 215};
+};
+
+enum class FishView : std::uint8_t {
+    Swimming = 0,
+    HitPopup = 1    // Caught less than hitPopupMs ago - draw the score for judgement instead of the fish
+};
+
+struct FishSnapshot {
+    float x = 0.0f;
+    float y = 0.0f;
+    int noteIndex = 0;
+    int variant = 0;
+    FishView view = FishView::Swimming;
+    Judgement judgement = Judgement::Miss;
+};
+
+struct SpriteSnapshot {
+    float x = 0.0f;
+    float y = 0.0f;
+    int column = 1;     // Sheet column
+};
+
+// What to draw after a step, already interpolated between the last two simulation steps
+struct RenderSnapshot {
+    double songTimeMs = 0.0;
+    std::vector<FishSnapshot> fish;     // Only the fish to draw: hit popups, then on-screen fish in note order
+    int fishColumn = 1;                 // Swim cycle column shared by every swimming fish
+    SpriteSnapshot fisher;
+    SpriteSnapshot boat;
+    SpriteSnapshot hook;
+    int score = 0;
+    CullStats fishCull;
+    std::vector<JudgementResult> hits;  // Hits judged by the last step, oldest first (for hit sounds)
+    int misses = 0;                     // Notes the last step marked missed
+};
+
+// Gameplay without a window or audio device: judgement, scoring, fish movement and animation.
+//
+// step(songTimeMs, presses) judges each press at its own song time, resolves notes whose window
+// closed, then runs fixed steps of config.stepMs up to songTimeMs and returns what to draw.
+// Nothing reads a wall clock, so the same presses at the same song times give the same result at
+// any frame rate - RhythmGame feeds it from SongClock and SDL input, tests and bots from a
+// ManualClock as fast as the CPU allows.
+//
+// Every judgement call is recorded in getReplay() for `meowstro --replay`.
+class GameSimulation {
+public:
+    GameSimulation();
+
+    // Start a song. Stats, replay and animation start over; the clock and music state are kept.
+    void reset(const SimulationConfig& config);
+
+    // Used by update() and isFinished(); not owned
+    void setClock(SimulationClock* clock) { m_clock = clock; }
+    void setMusicState(const MusicState* music) { m_music = music; }
+
+    // Press times are song times before the input offset, oldest first; presses after songTimeMs are judged
+    // at it and presses before 0 at 0
+    const RenderSnapshot& step(double songTimeMs, const std::vector<double>& pressTimesMs);
+    // step() at the clock's current time (song time 0 without a clock)
+    const RenderSnapshot& update(const std::vector<double>& pressTimesMs);
+
+    // The music stopped; without a music state, once every note is resolved
+    bool isFinished() const;
+
+    // Close the replay at the last step's song time
+    void finishReplay();
+
+    const RenderSnapshot& getSnapshot() const { return m_snapshot; }
+    const GameStats& getStats() const { return m_stats; }
+    const Replay& getReplay() const { return m_replay; }
+    const JudgementEngine& getJudgement() const { return m_judgement; }
+    const SimulationConfig& getConfig() const { return m_config; }
+    double getSimTimeMs() const { return m_simTimeMs; }
+
+private:
+    struct Fish {
+        float baseX = 0.0f;     // Scroll position before sway
+        float baseY = 0.0f;
+        float x = 0.0f;
+        float y = 0.0f;
+        int variant = 0;
+        bool active = false;    // Not caught and inside the viewport plus margin (only kept up to date in the window)
+        bool caught = false;
+        Judgement judgement = Judgement::Miss;
+        double caughtAtMs = 0.0;
+    };
+
+    struct Body {
+        float x = 0.0f;
+        float y = 0.0f;
+        int column = 1;
+        InterpolatedPosition position;
+    };
+
+    SimulationConfig m_config;
+    SimulationClock* m_clock;
+    const MusicState* m_music;
+
+    AudioLogic m_rhythmLogic;   // Input offset
+    JudgementEngine m_judgement;
+    GameStats m_stats;
+    Replay m_replay;
+
+    double m_simTimeMs;         // Song time of the last simulation step
+    double m_songTimeMs;        // Song time of the last step() call
+    float m_interpolationAlpha; // Render position between the previous (0) and current (1) step
+    float m_animationSeconds;
+
+    // Fish scroll right to left in note order, so the ones that can be on screen are the notes in
+    // [m_firstFish, m_lastFish). Only these are moved, culled, swayed and interpolated; both ends
+    // only move forward as the simulation clock does.
+    std::vector<Fish> m_fish;
+    std::vector<InterpolatedPosition> m_fishPositions;
+    size_t m_firstFish;
+    size_t m_lastFish;
+    float m_maxFishWidth;               // Widest variant frame, so no fish leaves the window while visible
+    std::vector<size_t> m_caughtFish;   // Showing their hit popup, in catch order
+    int m_fishColumn;
+    CullStats m_fishCull;
+
+    Body m_fisher;
+    Body m_boat;
+    Body m_hook;
+    HookAnimationState m_hookState;
+    FisherAnimationState m_fisherState;
+
+    RenderSnapshot m_snapshot;
+
+    void judgePress(double songTimeMs, double pressTimeMs);
+    void resolveMisses(double songTimeMs);
+    void advanceSimulation(double songTimeMs);
+    void stepSimulation();
+    size_t updateFishWindow();
+    float fishScrollX(size_t index) const;
+    void updateFishMovement();
+    void updateFishVisibility();
+    void updateAnimations();
+    void buildSnapshot();
+};
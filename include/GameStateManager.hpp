@@ -4,6 +4,8 @@
 #include "GameStats.hpp"
 #include "RhythmGame.hpp"
 #include "MenuSystem.hpp"
+#include "FramePacer.hpp"
+#include "InputSampler.hpp"
 
 #include <SDL.h>
 
@@ -39,6 +41,8 @@ private:
     SDL_Event event;
     RhythmGame rhythmGame;
     MenuSystem menuSystem;
+    FramePacer framePacer; // Shared by every state loop
+    InputSampler inputSampler; // Gameplay keys, pumped while the frame pacer waits
     
     // State transition methods
     void transitionTo(GameState newState);
@@ -46,9 +50,11 @@ private:
     
     // State execution methods
     void runMainMenu();
+    void runCalibration();
     void runGameplay();
     void runEndScreen();
     
     // Helper methods
     void resetGameStats();
+    void logFrameStats(const char* loopName) const;
 };
\ No newline at end of file
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "Font.hpp"
+#include "TextureAtlas.hpp"
+
+#include <SDL.h>
+#include <array>
+#include <string>
+#include <vector>
+
+// Printable ASCII glyphs of one (font, size) rasterized once into an atlas page.
+// Strings are drawn as one textured quad per glyph, so changing text (score,
+// stats) never creates a texture at runtime.
+class GlyphAtlas {
+public:
+    static constexpr int kFirstGlyph = 32;  // ' '
+    static constexpr int kLastGlyph = 126;  // '~'
+    static constexpr int kGlyphCount = kLastGlyph - kFirstGlyph + 1;
+
+    struct Glyph {
+        SDL_Rect src = {0, 0, 0, 0};
+        int offsetX = 0;    // Horizontal offset of the glyph bitmap from the pen position
+        int advance = 0;    // Pen movement after this glyph
+    };
+
+    GlyphAtlas();
+    ~GlyphAtlas() = default;
+
+    GlyphAtlas(const GlyphAtlas&) = delete;
+    GlyphAtlas& operator=(const GlyphAtlas&) = delete;
+
+    // Rasterize all glyphs in white; color is applied per vertex when drawing
+    bool build(SDL_Renderer* renderer, Font& font, int pageSize = 1024);
+
+    bool isValid() const { return m_texture != nullptr; }
+    SDL_Texture* getTexture() const { return m_texture; }
+    int getLineHeight() const { return m_lineHeight; }
+
+    // Width in pixels of the string when drawn with this atlas
+    int measureText(const std::string& text) const;
+
+    // Append two triangles per visible glyph with (x, y) as the top-left of the line
+    void appendQuads(const std::string& text, float x, float y, SDL_Color color,
+                     std::vector<SDL_Vertex>& vertices, std::vector<int>& indices) const;
+
+private:
+    TextureAtlas m_atlas;
+    SDL_Texture* m_texture;
+    int m_pageWidth;
+    int m_pageHeight;
+    int m_lineHeight;
+    std::array<Glyph, kGlyphCount> m_glyphs;
+    std::vector<int> m_kerning; // kGlyphCount x kGlyphCount, indexed [previous][current]
+
+    static bool isSupported(char ch) {
+        return ch >= kFirstGlyph && ch <= kLastGlyph;
+    }
+    int kerning(char previous, char current) const;
+};
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <SDL.h>
+#include <cstdint>
 
 enum class InputAction {
     None,
@@ -8,7 +9,22 @@ enum class InputAction {
     Select,         // SPACE key
     MenuUp,         // UP arrow (menu navigation)
     MenuDown,       // DOWN arrow (menu navigation)
-    Escape          // ESC key
+    Escape,         // ESC key
+    TogglePerfOverlay // F3 key, in every state
+};
+
+// An action together with when its SDL event was generated
+struct InputEvent {
+    InputAction action = InputAction::None;
+    double timestampMs = -1.0;  // On the SongClock::hostTimeMs() timeline; < 0 when there is no event
+};
+
+// One gameplay key transition captured by InputSampler
+struct InputRecord {
+    InputAction action = InputAction::None;
+    std::uint8_t lane = 0;
+    bool pressed = false;
+    double timestampMs = -1.0;  // SongClock::hostTimeMs() when the event reached SDL's queue
 };
 
 enum class GameState {
@@ -27,6 +43,18 @@ public:
     // Process SDL events and return the appropriate action
     InputAction processInput(SDL_Event& event, GameState currentState);
     
+    // Same as processInput, keeping the event's timestamp so hits are judged when the key went down
+    InputEvent processEvent(SDL_Event& event, GameState currentState);
+    
+    // True for the key that shows/hides RenderWindow's performance overlay
+    static bool isPerfOverlayToggle(const SDL_Event& event);
+    
+    // Host time (SongClock::hostTimeMs) at which SDL queued the event
+    static double eventTimeMs(const SDL_Event& event);
+    
+    // Gameplay input from InputSampler's queue instead of the frame's SDL_PollEvent loop
+    InputEvent processGameInput(const InputRecord& record);
+    
     // Check if a key is currently pressed (for game state)
     bool isKeyPressed(SDL_Scancode key) const;
     
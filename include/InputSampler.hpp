@@ -0,0 +1,51 @@
+#pragma once
+
+#include "InputHandler.hpp"
+#include "SpscRing.hpp"
+
+#include <SDL.h>
+#include <atomic>
+#include <cstddef>
+
+// Captures gameplay key events the moment SDL queues them and hands them to the game loop
+// through a lock-free SPSC ring, so presses are timestamped independently of rendering.
+//
+// SDL only allows event pumping on the thread that created the window, so sampling runs on
+// the main thread: an SDL event watch timestamps each key with the performance counter as it
+// is pumped, and pump() is called every millisecond or so while the frame pacer waits (see
+// FramePacer::setIdleTask). The event watch is the single producer and the gameplay update
+// the single consumer.
+class InputSampler {
+public:
+    static constexpr size_t kQueueSize = 256;
+
+    InputSampler();
+    ~InputSampler();
+
+    InputSampler(const InputSampler&) = delete;
+    InputSampler& operator=(const InputSampler&) = delete;
+
+    // Install the event watch and drop anything left from a previous song
+    void start();
+    void stop();
+    bool isRunning() const { return m_running; }
+
+    // Let SDL read pending OS events so the watch sees them now (main thread only)
+    void pump();
+
+    // Next captured record, oldest first; false when the queue is empty
+    bool poll(InputRecord& record);
+
+    // Records lost because the game loop fell more than kQueueSize events behind
+    size_t getDroppedCount() const { return m_dropped.load(std::memory_order_relaxed); }
+
+    // Map a gameplay key event to a record; false for events gameplay ignores (key repeats included)
+    static bool translate(const SDL_Event& event, double timestampMs, InputRecord& record);
+
+private:
+    SpscRing<InputRecord, kQueueSize> m_queue;
+    std::atomic<size_t> m_dropped;
+    bool m_running;
+
+    static int SDLCALL eventWatch(void* userdata, SDL_Event* event);
+};
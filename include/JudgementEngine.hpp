@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+// Values match AudioLogic::checkHit (0 = miss, 1 = good, 2 = perfect)
+enum class Judgement {
+    Miss = 0,
+    Good = 1,
+    Perfect = 2
+};
+
+struct JudgementResult {
+    int noteIndex = -1;     // -1 when the press matched no note
+    Judgement judgement = Judgement::Miss;
+    double deltaMs = 0.0;   // Press time minus note time
+
+    bool isHit() const { return noteIndex >= 0; }
+};
+
+// Points a hit is worth
+inline int judgementScore(Judgement judgement) {
+    switch (judgement) {
+        case Judgement::Perfect: return 1000;
+        case Judgement::Good: return 500;
+        default: return 0;
+    }
+}
+
+// Resolves presses and misses against a time-sorted chart. A cursor tracks the
+// earliest unresolved note, so each frame only looks at notes inside the timing
+// window instead of scanning the whole chart.
+class JudgementEngine {
+public:
+    JudgementEngine(double perfectWindowMs = 60.0, double goodWindowMs = 120.0);
+
+    // Note times must be sorted ascending; unsorted charts are rejected
+    bool load(const std::vector<double>& noteTimesMs);
+
+    // Mark every note unresolved and rewind to the start
+    void reset();
+
+    // Move to timeMs: notes whose window already closed are skipped without counting as misses
+    void seek(double timeMs);
+
+    // Judge a press against the earliest unresolved note whose window contains timeMs
+    JudgementResult judgeHit(double timeMs);
+
+    // Resolve unresolved notes whose window closed before timeMs as misses.
+    // Missed note indices are appended to missedNotes when it is given. Returns the number of misses.
+    int resolveMisses(double timeMs, std::vector<int>* missedNotes = nullptr);
+
+    bool isResolved(int noteIndex) const;
+    size_t getCursor() const { return m_cursor; }
+    size_t getNoteCount() const { return m_noteTimes.size(); }
+    bool isFinished() const { return m_cursor >= m_noteTimes.size(); }
+
+    double getPerfectWindowMs() const { return m_perfectWindowMs; }
+    double getGoodWindowMs() const { return m_goodWindowMs; }
+
+private:
+    std::vector<double> m_noteTimes;
+    std::vector<char> m_resolved;
+    size_t m_cursor;    // Every note before the cursor is resolved
+    double m_perfectWindowMs;
+    double m_goodWindowMs;
+
+    void advanceCursor();
+};
@@ -6,6 +6,7 @@
 #include "GameStats.hpp"
 #include "Entity.hpp"
 #include "Sprite.hpp"
+#include "FramePacer.hpp"
 
 #include <SDL.h>
 
@@ -15,13 +16,15 @@ enum class MenuResult {
     StartGame,      // Start new game
     RetryGame,      // Retry current game
     QuitGame,       // Quit to desktop
-    GoToMainMenu    // Return to main menu
+    GoToMainMenu,   // Return to main menu
+    Calibrate       // Open the latency calibration screen
 };
 
 // Menu types for future extensibility
 enum class MenuType {
     MainMenu,
     EndScreen,
+    Calibration,
     PauseMenu,      // Future menu
     SettingsMenu,   // Future menu
     CreditsMenu     // Future menu
@@ -33,10 +36,13 @@ public:
     ~MenuSystem() = default;
     
     // Main menu interface
-    MenuResult runMainMenu(RenderWindow& window, ResourceManager& resourceManager, InputHandler& inputHandler);
+    MenuResult runMainMenu(RenderWindow& window, ResourceManager& resourceManager, InputHandler& inputHandler, FramePacer& framePacer);
     
     // End screen interface
-    MenuResult runEndScreen(RenderWindow& window, ResourceManager& resourceManager, GameStats& stats, InputHandler& inputHandler);
+    MenuResult runEndScreen(RenderWindow& window, ResourceManager& resourceManager, GameStats& stats, InputHandler& inputHandler, FramePacer& framePacer);
+    
+    // Latency calibration: plays a metronome, collects taps and saves the measured input offset
+    MenuResult runCalibration(RenderWindow& window, ResourceManager& resourceManager, InputHandler& inputHandler, FramePacer& framePacer);
     
     // Future extensibility methods
     MenuResult runPauseMenu(RenderWindow& window, ResourceManager& resourceManager, InputHandler& inputHandler);
@@ -47,6 +53,7 @@ private:
     MenuType currentMenuType;
     int currentOption;
     bool menuActive;
+    bool firstFrameLogged;  // Cold-start time is logged once, at the first main menu frame
     
     // Helper methods for menu management
     void resetMenuState(MenuType type);
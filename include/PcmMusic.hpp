@@ -0,0 +1,86 @@
+#pragma once
+
+#include <SDL.h>
+#include <SDL_mixer.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <thread>
+
+// Song position and the host time (SongClock::hostTimeMs) it was taken at, read together.
+// positionMs < 0 when the position is unknown; hostMs < 0 when it is only known as of the read (streaming).
+struct MusicPosition {
+    double positionMs = -1.0;
+    double hostMs = -1.0;
+};
+
+// Cost of a decoded song, for comparing with streaming playback
+struct PcmMusicStats {
+    double decodeMs = 0.0;    // Wall time of the worker's decode and format conversion
+    size_t bytes = 0;         // PCM held in memory
+    double durationMs = 0.0;
+};
+
+// A song decoded in full to PCM in the mixer's format, played through Mix_HookMusic.
+//
+// Decoding runs on a worker thread (startDecode) so it can overlap the menu; play() waits for
+// it if needed. The hook copies the buffer straight into the mix and advances a frame cursor,
+// so the position is exact to the frame, and the host time of each hook call is kept so
+// SongClock can place the sample when it was taken rather than when the game read it.
+class PcmMusic {
+public:
+    PcmMusic();
+    ~PcmMusic();
+
+    PcmMusic(const PcmMusic&) = delete;
+    PcmMusic& operator=(const PcmMusic&) = delete;
+
+    // Needs an open mixer device. Does nothing if this file is already decoded or decoding.
+    void startDecode(const std::string& filePath);
+    // Blocks until the worker is done; false if nothing was decoded
+    bool waitForDecode();
+    bool isDecoding() const { return m_worker.joinable() && !m_decodeDone.load(std::memory_order_acquire); }
+    const std::string& getPath() const { return m_path; }
+
+    // Start from the beginning in place of any Mix_Music; false if not decoded for the current device format
+    bool play();
+    void stop();
+    bool isPlaying() const { return m_playing.load(std::memory_order_acquire); }
+
+    // Audio handed to the mixer since play() and the host time it was handed over, both from the same
+    // mixer callback
+    MusicPosition getPosition() const;
+
+    // Valid once waitForDecode() has returned
+    const PcmMusicStats& getStats() const { return m_stats; }
+
+    // Stop and free the decoded song
+    void release();
+
+private:
+    std::thread m_worker;
+    std::atomic<bool> m_decodeDone;
+    std::string m_path;
+
+    // Written by the worker before m_decodeDone is set
+    Mix_Chunk* m_chunk;
+    int m_frequency;
+    Uint16 m_format;
+    int m_channels;
+    PcmMusicStats m_stats;
+
+    // Playback state shared with the audio thread. The cursor and its host time are a seqlock: the
+    // sequence is odd while the mixer callback writes them, and a reader retries if it changed.
+    std::atomic<std::uint32_t> m_cursorSequence;
+    std::atomic<size_t> m_cursorBytes;
+    std::atomic<double> m_cursorHostMs;
+    std::atomic<bool> m_playing;
+    size_t m_frameBytes;
+    bool m_hooked;  // Mix_HookMusic points at this object
+
+    void decode(std::string filePath);
+    void publishCursor(size_t bytes, double hostMs);
+    static void SDLCALL mixHook(void* userdata, Uint8* stream, int len);
+};
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <SDL.h>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+class GlyphAtlas;
+class RenderWindow;
+struct RenderStats;
+struct TextureCacheStats;
+
+// Frame times over the overlay's history window (milliseconds)
+struct PerfOverlayStats {
+    double fps = 0.0;
+    double lastMs = 0.0;
+    double p50Ms = 0.0;
+    double p99Ms = 0.0;
+    size_t frames = 0;
+};
+
+// Performance HUD that RenderWindow::display() draws over whatever was rendered: FPS, a rolling
+// frame-time graph, p50/p99, the frame's draw calls and texture binds, live cached textures and
+// their bytes, and song clock drift while a song plays.
+//
+// Text comes from a GlyphAtlas built at startup and the graph is filled rects, so a shown overlay
+// adds a handful of draw calls and creates no textures. Frame times are recorded while it is
+// hidden too, so the graph is full as soon as it is toggled on.
+class PerfOverlay {
+public:
+    static constexpr size_t kHistorySize = 240;     // Frames in the graph and percentiles (4 s at 60 FPS)
+    static constexpr double kGraphMaxMs = 50.0;     // Frame time at the top of the graph
+    static constexpr int kGraphHeight = 60;
+
+    PerfOverlay();
+
+    void setEnabled(bool enabled) { m_enabled = enabled; }
+    bool isEnabled() const { return m_enabled; }
+    void toggle() { m_enabled = !m_enabled; }
+
+    // Atlas the numbers are drawn from; without one only the graph is drawn
+    void setGlyphs(const GlyphAtlas* glyphs) { m_glyphs = glyphs; }
+
+    // Present-to-present time of one frame
+    void recordFrame(double frameMs);
+    PerfOverlayStats getStats() const;
+
+    // SongClock::getDriftMs for the current frame; display() clears it after each present, so frames
+    // without a song show none
+    void setClockDriftMs(double driftMs);
+    void clearClockDrift() { m_hasDrift = false; }
+
+    // cacheStats may be null when the window has no ResourceManager
+    void draw(RenderWindow& window, const RenderStats& frameStats, const TextureCacheStats* cacheStats);
+
+private:
+    bool m_enabled;
+    const GlyphAtlas* m_glyphs;
+
+    std::vector<float> m_history;   // Ring buffer of frame times
+    size_t m_historyNext;
+    mutable std::vector<float> m_sorted;
+
+    bool m_hasDrift;
+    double m_driftMs;
+
+    // Scratch reused every frame so drawing does not allocate
+    std::string m_line;
+    std::vector<SDL_Rect> m_bars[3];    // Under one 60 FPS frame, under two, slower
+
+    void drawLine(RenderWindow& window, const char* text, int x, int y);
+};
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// Set by CMake from the MEOWSTRO_PROFILING option. At 0 the PROFILE_ZONE/PROFILE_THREAD macros
+// expand to nothing, so instrumented code compiles exactly as if it were not instrumented.
+#ifndef MEOWSTRO_PROFILING
+#define MEOWSTRO_PROFILING 0
+#endif
+
+// Records timed zones from any thread and writes them as a Chrome trace-event JSON file
+// (open it in chrome://tracing or ui.perfetto.dev).
+//
+// Each thread appends to its own buffer of fixed-size chunks and publishes the event count with a
+// release store, so recording a zone takes no lock; the registry mutex is only taken the first time
+// a thread records and when a session begins or ends. Buffers outlive their threads.
+//
+// Time is std::chrono::steady_clock, which is the same performance counter SDL_GetPerformanceCounter
+// reads (QueryPerformanceCounter on Windows, CLOCK_MONOTONIC elsewhere) without making the core
+// library depend on SDL.
+class Profiler {
+public:
+    static constexpr size_t kChunkEvents = 4096;
+    static constexpr size_t kMaxEventsPerThread = size_t(1) << 22;  // Per session, ~100 MB per thread; later zones are dropped
+
+    // Start recording; the trace is written to tracePath by endSession(). Returns false if a session is
+    // already running. Zones that closed before this call are not part of the session.
+    static bool beginSession(const std::string& tracePath);
+
+    // Stop recording and write the trace. Returns false if no session was running or the file could not be written.
+    static bool endSession();
+
+    static bool isRecording() { return s_recording.load(std::memory_order_relaxed); }
+
+    // Track name for the calling thread in the trace (threads default to "Thread <n>")
+    static void setThreadName(const std::string& name);
+
+    // Profiler clock in nanoseconds
+    static std::int64_t nowNs();
+
+    // Append a closed zone to the calling thread's buffer. name must outlive the session (use string literals).
+    static void record(const char* name, std::int64_t startNs, std::int64_t endNs);
+
+    // Zones recorded / dropped (buffer full) by every thread so far in the current session
+    static size_t getRecordedCount();
+    static size_t getDroppedCount();
+
+private:
+    static std::atomic<bool> s_recording;
+};
+
+// Times its own lifetime as one zone. Zones opened while no session is recording cost one relaxed load.
+class ProfileZone {
+public:
+    explicit ProfileZone(const char* name)
+        : m_name(name), m_startNs(Profiler::isRecording() ? Profiler::nowNs() : -1) {}
+
+    ~ProfileZone() {
+        if (m_startNs >= 0) {
+            Profiler::record(m_name, m_startNs, Profiler::nowNs());
+        }
+    }
+
+    ProfileZone(const ProfileZone&) = delete;
+    ProfileZone& operator=(const ProfileZone&) = delete;
+
+private:
+    const char* m_name;
+    std::int64_t m_startNs;
+};
+
+#if MEOWSTRO_PROFILING
+#define MEOWSTRO_PROFILE_JOIN_(a, b) a##b
+#define MEOWSTRO_PROFILE_JOIN(a, b) MEOWSTRO_PROFILE_JOIN_(a, b)
+// Zone from here to the end of the enclosing scope
+#define PROFILE_ZONE(name) ProfileZone MEOWSTRO_PROFILE_JOIN(profileZone_, __LINE__)(name)
+#define PROFILE_THREAD(name) Profiler::setThreadName(name)
+#else
+#define PROFILE_ZONE(name) ((void)0)
+#define PROFILE_THREAD(name) ((void)0)
+#endif
@@ -1,6 +1,24 @@
 #pragma once
 #include <SDL.h>
 #include "Entity.hpp"
+#include "PerfOverlay.hpp"
+#include "SpriteBatch.hpp"
+#include "ViewportCuller.hpp"
+
+#include <string>
+#include <vector>
+
+class GlyphAtlas;
+class ResourceManager;
+
+// Per-frame renderer counters, latched by display()
+struct RenderStats {
+	int drawCalls = 0;
+	int textureBinds = 0; // Draws whose texture differs from the previous draw
+	int batchedSprites = 0; // Quads drawn through the sprite batch
+	int visibleSprites = 0; // Submissions that passed viewport culling
+	int culledSprites = 0; // Submissions dropped as off screen
+};
 
 class RenderWindow
 {
@@ -8,8 +26,24 @@ public:
 	RenderWindow(const char *title, int w, int h, Uint32 windowFlags = SDL_WINDOW_SHOWN);
 	void clear();
 	void render(Entity& entity);
+	void render(SDL_Texture* texture, const SDL_Rect* src, const SDL_Rect& destination);
+	// Draw a string from a glyph atlas as one batch of quads (x, y is the top-left of the line)
+	void renderText(const GlyphAtlas& glyphs, const std::string& text, int x, int y, SDL_Color color);
+	
+	// Sprite batch - queued quads are drawn grouped by (layer, texture) on flushBatch() or display().
+	// Immediate render()/renderText() calls flush first so they still draw on top of earlier submissions.
+	// Submissions outside the window (grown by the cull margin) are dropped and counted as culled.
+	void submit(Entity& entity, int layer = 0);
+	void submit(SDL_Texture* texture, const SDL_Rect& src, const SDL_Rect& destination, int layer = 0, SDL_Color color = {255, 255, 255, 255});
+	void flushBatch();
+	void setCullMargin(int margin) { m_culler.setMargin(margin); }
+	const ViewportCuller& getCuller() const { return m_culler; }
+	
 	void display();
 	~RenderWindow();
+	
+	// Sync presents to the display refresh; returns false if the renderer does not support it
+	bool setVSync(bool enabled);
 
 	inline SDL_Renderer* getRenderer() const
 	{
@@ -18,10 +52,35 @@ public:
 	
 	bool isValid() const { return m_valid; }
 	
+	// Entities holding a texture handle are resolved through this cache when drawn
+	void setResourceManager(ResourceManager* resourceManager) { m_resourceManager = resourceManager; }
+	
+	// Counters for the last presented frame (the performance overlay's own draws are not counted)
+	const RenderStats& getFrameStats() const { return m_lastFrameStats; }
+	
+	// Drawn by display() on top of the frame while enabled
+	PerfOverlay& getPerfOverlay() { return m_perfOverlay; }
+	
 private:
 	SDL_Window *window;
 	SDL_Renderer *renderer;
 	bool m_valid;
+	
+	RenderStats m_frameStats;
+	RenderStats m_lastFrameStats;
+	SDL_Texture* m_lastTexture;
+	ResourceManager* m_resourceManager;
+	SpriteBatch m_batch;
+	ViewportCuller m_culler;
+	PerfOverlay m_perfOverlay;
+	Uint64 m_lastPresentTicks;
+	
+	// Texture for an entity, resolved through its handle when it has one
+	SDL_Texture* resolveTexture(Entity& entity);
+	
+	// Scratch buffers reused by renderText so drawing text does not allocate per frame
+	std::vector<SDL_Vertex> m_textVertices;
+	std::vector<int> m_textIndices;
 
 };
 
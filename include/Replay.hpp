@@ -0,0 +1,94 @@
+#pragma once
+
+#include "GameStats.hpp"
+
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+enum class ReplayEventType : std::uint8_t {
+    Press = 0,      // A gameplay key judged at this song time
+    MissSweep = 1   // resolveMisses at this song time marked at least one note missed
+};
+
+// Song times are as the game saw them, before the input offset is applied
+struct ReplayEvent {
+    ReplayEventType type;
+    double songTimeMs;
+};
+
+struct ReplayResult {
+    bool valid = false;     // False when the replay was recorded against a different chart
+    bool matches = false;   // Replayed score, hits and misses equal the recorded ones
+    GameStats stats;        // As replayed
+    size_t steps = 0;       // GameSimulation steps taken, one per event
+};
+
+// A recorded song: the RNG seed, the chart's identity, the judgement settings and every call the
+// game made into the JudgementEngine, in order, with the final GameStats.
+//
+// Saved as text, one "key value" line per header field followed by the events:
+//
+//   version 1
+//   seed <n>
+//   notes <count> <hash>
+//   input_offset_ms <ms>
+//   windows <perfect_ms> <good_ms>
+//   end <song_ms>
+//   result <score> <hits> <misses>
+//   p <song_ms>        (press)
+//   m <song_ms>        (miss sweep)
+//
+// Times are written with full precision so playback judges the exact same doubles. Loading
+// rejects event times that are not finite, negative or after the end. Playback needs no window
+// or audio device: it runs a GameSimulation on a ManualClock that jumps from event to event.
+class Replay {
+public:
+    static constexpr int kFormatVersion = 1;
+
+    Replay();
+
+    // Start recording a song. Clears any earlier recording.
+    void begin(std::uint32_t seed, const std::vector<double>& noteTimesMs, double inputOffsetMs,
+               double perfectWindowMs, double goodWindowMs);
+    void recordPress(double songTimeMs);
+    void recordMissSweep(double songTimeMs);
+    void finish(double endSongTimeMs, const GameStats& stats);
+    void clear();
+
+    bool saveToFile(const std::string& filePath) const;
+    bool save(std::ostream& output) const;
+    bool loadFromFile(const std::string& filePath);
+    // sourceName is only used in error messages
+    bool load(std::istream& input, const std::string& sourceName);
+
+    // Re-run the recorded events through GameSimulation::step with steps of stepMs (the
+    // simulation default when not positive) and compare the result with the recording
+    ReplayResult play(const std::vector<double>& noteTimesMs, double stepMs) const;
+
+    bool isLoaded() const { return m_loaded; }
+    std::uint32_t getSeed() const { return m_seed; }
+    size_t getNoteCount() const { return m_noteCount; }
+    std::uint32_t getNoteHash() const { return m_noteHash; }
+    double getInputOffsetMs() const { return m_inputOffsetMs; }
+    double getEndSongTimeMs() const { return m_endSongTimeMs; }
+    const GameStats& getRecordedStats() const { return m_stats; }
+    const std::vector<ReplayEvent>& getEvents() const { return m_events; }
+
+    // FNV-1a over the note times, so a replay is only played against the chart it was made on
+    static std::uint32_t hashNotes(const std::vector<double>& noteTimesMs);
+
+private:
+    std::uint32_t m_seed;
+    size_t m_noteCount;
+    std::uint32_t m_noteHash;
+    double m_inputOffsetMs;
+    double m_perfectWindowMs;
+    double m_goodWindowMs;
+    double m_endSongTimeMs;
+    GameStats m_stats;
+    std::vector<ReplayEvent> m_events;
+    bool m_loaded;   // Finished or loaded, so it can be saved or played
+};
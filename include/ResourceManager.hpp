@@ -5,39 +5,185 @@
 #include <unordered_map>
 #include <string>
 #include <memory>
+#include <vector>
+#include <list>
+#include <cstdint>
+#include <initializer_list>
+#include "AssetHandle.hpp"
 #include "Font.hpp"
+#include "TextureAtlas.hpp"
+#include "GlyphAtlas.hpp"
+#include "AsyncAssetLoader.hpp"
+#include "AssetPack.hpp"
+
+// Counters for the texture cache (loaded images and text textures, not atlas pages)
+struct TextureCacheStats {
+    size_t hits = 0;
+    size_t misses = 0;
+    size_t evictions = 0;
+    size_t liveTextures = 0;
+    size_t liveBytes = 0;
+    size_t budgetBytes = 0;
+};
 
 class ResourceManager {
 public:
     ResourceManager(SDL_Renderer* renderer);
     ~ResourceManager();
 
-    // Texture management
+    // Asset pack - once mounted, packed images and fonts load from the mapping instead of disk
+    bool mountAssetPack(const std::string& packPath);
+    bool hasAssetPack() const { return assetPack.isOpen(); }
+    
+    // Handles - register an asset once, then resolve it with an array index on hot paths.
+    // Evicted textures are reloaded on the next getTexture(); released ones resolve to nullptr.
+    TextureHandle acquireTexture(const std::string& filePath);
+    TextureHandle acquireTextTexture(FontHandle font, const std::string& text, SDL_Color color);
+    FontHandle acquireFont(const std::string& fontPath, int fontSize);
+    SDL_Texture* getTexture(TextureHandle handle);
+    TextureRegion getRegion(TextureHandle handle);
+    Font* getFont(FontHandle handle) const;
+    bool isHandleValid(TextureHandle handle) const;
+    void releaseTexture(TextureHandle handle);
+    
+    // Texture management (string-keyed convenience wrappers over the handle API)
     SDL_Texture* loadTexture(const std::string& filePath);
     SDL_Texture* createTextTexture(const std::string& fontPath, int fontSize, const std::string& text, SDL_Color color);
     
+    // Upload an already decoded surface and cache it under key (surface stays owned by the caller)
+    SDL_Texture* createTextureFromSurface(const std::string& key, SDL_Surface* surface);
+    
+    // Atlas management - packs the given images onto shared pages under a name
+    bool buildAtlas(const std::string& atlasName, const std::vector<std::string>& imagePaths, int pageSize);
+    bool buildAtlas(const std::string& atlasName, const std::vector<std::pair<std::string, SDL_Surface*>>& images, int pageSize);
+    const TextureAtlas* getAtlas(const std::string& atlasName) const;
+    // Register an atlas built elsewhere (AsyncAssetLoader builds one over several frames)
+    void addAtlas(const std::string& atlasName, std::unique_ptr<TextureAtlas> atlas);
+    
+    // Region for an image: atlas sub-rect if packed, otherwise the whole standalone texture
+    TextureRegion getTextureRegion(const std::string& filePath);
+    
+    // Async loading - images decode on worker threads, pumpAsyncUploads() uploads them on this thread
+    AssetLoadHandle loadTextureAsync(const std::string& filePath);
+    AssetLoadHandle buildAtlasAsync(const std::string& atlasName, const std::vector<std::string>& imagePaths, int pageSize);
+    int pumpAsyncUploads(double budgetMs);
+    void finishAsyncLoads();
+    float getAsyncLoadProgress() const;
+    bool hasPendingAsyncLoads() const;
+    
     // Font management
     Font* getFont(const std::string& fontPath, int fontSize);
     
+    // Glyph atlas for a (font, size), rasterized on first use and cached
+    GlyphAtlas* getGlyphAtlas(const std::string& fontPath, int fontSize);
+    
+    // Byte budget for cached textures; least recently used unpinned textures are evicted above it
+    void setTextureBudget(size_t budgetBytes);
+    TextureCacheStats getTextureCacheStats() const { return cacheStats; }
+    
+    // Pinned textures are never evicted - pin anything held across frames. Pins go through handles,
+    // so a stale one (texture released since) cannot unpin whatever reuses its slot.
+    void pinTexture(TextureHandle handle);
+    void unpinTexture(TextureHandle handle);
+    bool isTexturePinned(TextureHandle handle) const;
+    
     // Manual cleanup (called automatically in destructor)
     void cleanup();
     
     // Clear texture cache without destroying textures (for state resets)
     void clearCache();
     
-    // Validate that a texture pointer is still valid
-    bool isTextureValid(SDL_Texture* texture) const;
-    
     // Validity checking
     bool isValid() const { return m_valid; }
+    SDL_Renderer* getRenderer() const { return renderer; }
 
 private:
+    // One registered texture. The slot outlives eviction (texture == nullptr) so handles
+    // stay valid and the texture can be recreated from its source on the next access.
+    struct TextureSlot {
+        SDL_Texture* texture = nullptr;
+        std::uint32_t generation = 1;
+        bool registered = false;
+        size_t bytes = 0;
+        int pinCount = 0;
+        std::list<std::uint32_t>::iterator lruPosition;
+        
+        // Source - an image path, or a font + text + color for text textures
+        std::string path;
+        FontHandle font;
+        std::string text;
+        SDL_Color color = {0, 0, 0, 0};
+    };
+    
+    // Text textures are looked up by value instead of a concatenated string key
+    struct TextKey {
+        std::uint32_t font;
+        std::uint32_t color;    // Packed RGBA
+        std::string text;
+        
+        bool operator==(const TextKey& other) const {
+            return font == other.font && color == other.color && text == other.text;
+        }
+    };
+    struct TextKeyHash {
+        size_t operator()(const TextKey& key) const;
+    };
+    
+    struct FontSlot {
+        std::unique_ptr<Font> font;
+        std::uint32_t generation = 1;
+    };
+    
     SDL_Renderer* renderer;
-    std::unordered_map<std::string, SDL_Texture*> textures;
-    std::unordered_map<std::string, std::unique_ptr<Font>> fonts;
+    AssetPack assetPack;
+    std::vector<TextureSlot> textureSlots;
+    std::vector<std::uint32_t> freeTextureSlots;
+    std::unordered_map<std::string, std::uint32_t> imageSlots;          // Interned image paths
+    std::unordered_map<TextKey, std::uint32_t, TextKeyHash> textSlots; // Interned text textures
+    std::list<std::uint32_t> lruOrder; // Resident slots, front is most recently used
+    TextureCacheStats cacheStats;
+    std::vector<FontSlot> fontSlots;
+    std::unordered_map<std::string, std::uint32_t> fontSlotsByKey;
+    std::unordered_map<std::string, std::unique_ptr<TextureAtlas>> atlases;
+    std::unordered_map<std::string, std::unique_ptr<GlyphAtlas>> glyphAtlases;
+    std::unique_ptr<AsyncAssetLoader> asyncLoader; // Created on first async request
     bool m_valid;
     
+    AsyncAssetLoader& getAsyncLoader();
+    
+    // Upload a packed RGBA image with SDL_UpdateTexture - no decode
+    SDL_Texture* createPackTexture(const AssetPackEntry& entry);
+    
+    // Create the GPU texture for a slot from its source (image file/pack or text)
+    SDL_Texture* createSlotTexture(const TextureSlot& slot);
+    
+    // Slot helpers - resident slots are tracked in LRU order and count toward the budget
+    TextureSlot* findSlot(TextureHandle handle);
+    const TextureSlot* findSlot(TextureHandle handle) const;
+    std::uint32_t allocateSlot();
+    TextureHandle makeHandle(std::uint32_t index) const;
+    void makeResident(std::uint32_t index, SDL_Texture* texture);
+    void evictSlot(std::uint32_t index, bool destroy);
+    void releaseSlot(std::uint32_t index, bool destroy);
+    void releaseAllSlots(bool destroy);
+    void evictToBudget(std::uint32_t keepIndex);
+    static size_t estimateTextureBytes(SDL_Texture* texture);
+    
     // Helper to generate unique keys
     std::string generateFontKey(const std::string& fontPath, int fontSize) const;
-    std::string generateTextKey(const std::string& fontPath, int fontSize, const std::string& text, SDL_Color color) const;
-};
\ No newline at end of file
+};
+
+// Pins a set of textures for the lifetime of a scope (e.g. while a menu is shown).
+// Invalid handles (atlas regions, which are never evicted) are ignored.
+class ScopedTexturePins {
+public:
+    ScopedTexturePins(ResourceManager& resourceManager, std::initializer_list<TextureHandle> textures);
+    ~ScopedTexturePins();
+    
+    ScopedTexturePins(const ScopedTexturePins&) = delete;
+    ScopedTexturePins& operator=(const ScopedTexturePins&) = delete;
+    
+private:
+    ResourceManager& resourceManager;
+    std::vector<TextureHandle> textures;
+};
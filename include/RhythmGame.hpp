@@ -7,25 +7,54 @@
 #include "Entity.hpp"
 #include "Sprite.hpp"
 #include "Audio.hpp"
-#include "AudioLogic.hpp"
-#include "AnimationSystem.hpp"
+#include "SoundEffects.hpp"
+#include "GameSimulation.hpp"
+#include "SongClock.hpp"
 
+#include <cstdint>
+#include <string>
 #include <vector>
-#include <unordered_set>
-#include <unordered_map>
 #include <SDL.h>
 
 
+// GameSimulation's clock during play: the song clock, fed the music position on every read
+class AudioSongClock : public SimulationClock {
+public:
+    AudioSongClock(SongClock& songClock, const Audio& audio) : m_songClock(songClock), m_audio(audio) {}
+    double songTimeMs() override;
+
+private:
+    SongClock& m_songClock;
+    const Audio& m_audio;
+};
+
+// GameSimulation's music state during play
+class AudioMusicState : public MusicState {
+public:
+    explicit AudioMusicState(const Audio& audio) : m_audio(audio) {}
+    bool isMusicPlaying() const override { return m_audio.isMusicPlaying(); }
+
+private:
+    const Audio& m_audio;
+};
+
+// SDL front end for a song: turns input events into press times for GameSimulation, plays hit
+// sounds for its judgements and draws its render snapshot. The gameplay rules live in the simulation.
 class RhythmGame {
 public:
     RhythmGame();
     ~RhythmGame();
     
+    // Load the chart and start decoding its music in the background (pre-decoded mode),
+    // so it is ready by the time the player starts the song
+    void prepareSong();
+    
     // Initialize the game with required dependencies
     void initialize(RenderWindow& window, ResourceManager& resourceManager, GameStats& stats);
     
     // Main game update - returns true if game should continue, false if ended
-    bool update(InputAction action, InputHandler& inputHandler);
+    // A Select is judged at input.timestampMs when it is set, not at the time of the call
+    bool update(const InputEvent& input, InputHandler& inputHandler);
     
     // Render the game
     void render(RenderWindow& window);
@@ -35,6 +64,12 @@ public:
     
     // Clean up resources when exiting gameplay
     void cleanup();
+    
+    // Fish inside the viewport (plus margin) as of the last update
+    const CullStats& getFishCullStats() const { return m_simulation.getSnapshot().fishCull; }
+    
+    // Score as six zero-padded digits, as drawn on the HUD
+    static std::string formatScore(int score);
 
 private:
     // Game dependencies
@@ -43,68 +78,51 @@ private:
     
     // Audio system
     Audio m_audioPlayer;
-    AudioLogic m_rhythmLogic;
+    SoundEffects m_soundEffects; // Declared after m_audioPlayer so it is released while the device is open
     
-    // Animation system
-    AnimationSystem m_animationSystem;
-    HookAnimationState m_hookAnimationState;
-    FisherAnimationState m_fisherAnimationState;
+    // Song time fused from the music position and the performance counter
+    SongClock m_songClock;
+    AudioSongClock m_clockSource;
+    AudioMusicState m_musicState;
     
-    // Game timing
-    Uint32 m_songStartTime;
-    std::vector<bool> m_noteHitFlags;
+    // Judgement, scoring, movement and the replay; this class feeds it and draws the result
+    GameSimulation m_simulation;
+    std::vector<double> m_pendingPresses; // Song times of presses not yet passed to the simulation
     
-    // Frame timing for consistent framerates
-    Uint64 m_lastFrameTime;
-    Uint64 m_targetFrameTime;
+    // Time from a key event being queued to it being judged
+    size_t m_inputLatencyCount;
+    double m_inputLatencySumMs;
+    double m_inputLatencyMaxMs;
     
-    // Game entities
+    // Drawn at the snapshot's positions each frame
     Entity m_ocean;
     Entity m_scoreLabel;
-    Entity m_scoreNumber;
     Sprite m_fisher;
     Sprite m_boat;
     Sprite m_hook;
-    std::vector<Sprite> m_fish;
-    
-    // Base positions for sway effect (to avoid accumulating position changes)
-    std::vector<std::pair<int, int>> m_fishBasePositions;
-    std::pair<int, int> m_fisherBasePosition;
-    std::pair<int, int> m_boatBasePosition;
-    std::pair<int, int> m_hookBasePosition;
-    
-    // Hit tracking
-    std::unordered_set<int> m_fishHits;
-    std::unordered_map<int, Uint32> m_fishHitTimes;
-    std::unordered_map<int, bool> m_fishHitTypes; // false = Good, true = Perfect
-    
-    // Animation parameters
-    int m_throwDuration;
-    int m_hookTargetX;
-    int m_hookTargetY;
+    std::vector<Sprite> m_fishSprites; // One per fish variant
     
     // Textures
-    SDL_Texture* m_fishTextures[3];
-    SDL_Texture* m_perfectHitTexture;
-    SDL_Texture* m_goodHitTexture;
+    TextureRegion m_fishTextures[3];
+    TextureRegion m_perfectHitText;
+    TextureRegion m_goodHitText;
+    
+    // Cache textures held for the whole song, pinned so the texture cache cannot evict them
+    std::vector<TextureHandle> m_pinnedTextures;
     
-    // Last score for texture updating
+    // Score digits are drawn from a glyph atlas; the string is rebuilt only when the score changes
+    GlyphAtlas* m_scoreGlyphs;
+    std::string m_scoreText;
     int m_lastScore;
     
     // Private helper methods
+    std::string getSongMusicPath() const;
     void initializeTextures();
     void initializeEntities();
-    void initializeFish();
-    void handleRhythmInput(double currentTime);
-    void updateAnimations();
-    void updateFishMovement();
-    void checkMissedNotes(double currentTime);
-    void renderFish(RenderWindow& window, Uint32 currentTicks);
+    SimulationConfig makeSimulationConfig(const RenderWindow& window, std::uint32_t seed);
+    void playHitSounds(const RenderSnapshot& snapshot);
+    void renderFish(RenderWindow& window, const RenderSnapshot& snapshot);
     void updateScore();
-    
-    // Format score helper
-    std::string formatScore(int score);
-    
-    // Helper method for precise timing
-    double getCurrentGameTimeMs() const;
+    void pinTexture(TextureHandle texture);
+    void unpinTextures();
 };
\ No newline at end of file
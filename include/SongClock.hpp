@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstddef>
+
+// How well the audio position and the fused clock agreed over a song
+struct SongClockStats {
+    size_t samples = 0;         // Audio position changes seen
+    size_t resyncs = 0;         // Times the fit was discarded after a jump (stall, seek, late start)
+    double meanErrorMs = 0.0;   // Mean |audio position - prediction| when a new position arrived
+    double maxErrorMs = 0.0;
+    double rate = 1.0;          // Audio ms per host ms from the current fit
+};
+
+// Song time fused from the audio stream position and the high-resolution host clock.
+//
+// Mix_GetMusicPosition only advances when the mixer consumes a buffer (~46 ms at 2048
+// frames / 44.1 kHz), so it is a staircase. Each step is recorded as an (host, audio)
+// sample and a least-squares line over the last kWindowSize samples gives the song time
+// at any host time in between. The returned time never decreases, and while no audio
+// position is available the clock runs on host time alone.
+//
+// The mixer position is what has been mixed, not what is heard: the device buffer still has
+// to play out. setOutputLatencyMs() shifts audio samples back by that much so song time
+// follows the speakers.
+class SongClock {
+public:
+    static constexpr size_t kWindowSize = 16;           // Audio steps in the fit (~0.75 s)
+    static constexpr double kResyncThresholdMs = 250.0; // Larger prediction errors restart the fit
+    static constexpr double kMaxRateError = 0.05;       // Fitted rate is clamped to 1 +/- this
+
+    SongClock();
+
+    // Song time 0 is at hostMs; clears samples and statistics (the output latency is kept)
+    void start(double hostMs);
+
+    // Time from the mixer position to the sound leaving the speakers (see Audio::getOutputLatencyMs)
+    void setOutputLatencyMs(double latencyMs) { m_outputLatencyMs = latencyMs; }
+    double getOutputLatencyMs() const { return m_outputLatencyMs; }
+
+    // audioMs < 0 means the stream position is unavailable. audioHostMs is the host time the position
+    // was taken at, if known (e.g. in the mixer callback); otherwise it is taken to be hostMs.
+    // Returns the song time in ms.
+    double update(double hostMs, double audioMs, double audioHostMs = -1.0);
+
+    double getTimeMs() const { return m_lastTimeMs; }
+    const SongClockStats& getStats() const { return m_stats; }
+
+    // Song time minus host time elapsed since start() at the last update. Starts near minus the output
+    // latency; how it moves during a song is the drift between the audio clock and the performance counter.
+    double getDriftMs() const { return m_lastTimeMs - (m_lastHostMs - m_startHostMs); }
+
+    // Song time at an earlier host time (e.g. when an input event was queued) from the current fit.
+    // Not clamped, so it can be before getTimeMs().
+    double toSongTime(double hostMs) const;
+
+    // SDL_GetPerformanceCounter in milliseconds
+    static double hostTimeMs();
+
+private:
+    double m_startHostMs;
+    double m_lastTimeMs;
+    double m_lastHostMs;
+    double m_lastAudioMs;
+    double m_outputLatencyMs;
+
+    // Ring of (host, audio) samples taken when the audio position changed
+    double m_sampleHost[kWindowSize];
+    double m_sampleAudio[kWindowSize];
+    size_t m_sampleCount;
+    size_t m_sampleNext;
+
+    // Current fit: audio = m_fitAudio + m_fitRate * (host - m_fitHost)
+    double m_fitHost;
+    double m_fitAudio;
+    double m_fitRate;
+    bool m_hasFit;
+
+    SongClockStats m_stats;
+    double m_errorSumMs;
+
+    double predict(double hostMs) const;
+    void addSample(double hostMs, double audioMs);
+    void refit();
+};
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <SDL.h>
+#include <SDL_mixer.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Preloaded one-shot sounds
+enum class SoundId : uint8_t {
+    HitPerfect,
+    HitGood,
+    Count
+};
+
+// A short decaying sine burst, used when no sample file is configured
+struct ToneSpec {
+    double toneHz = 1000.0;
+    double durationMs = 30.0;
+    double decayMs = 6.0;    // Time constant of the exponential fade
+    double volume = 0.8;     // Peak amplitude, 0-1
+};
+
+struct SoundEffectStats {
+    size_t played = 0;   // Sounds started, stolen voices included
+    size_t stolen = 0;   // Starts that cut off the oldest playing voice
+    size_t failed = 0;   // Starts the mixer rejected
+};
+
+// Hit sounds played on a fixed pool of mixer channels: the first `voices` channels, tagged as one
+// group and reserved so Mix_PlayChannel(-1, ...) elsewhere never lands on them. Every sample is
+// decoded or synthesized into a Mix_Chunk in initialize(); play() only picks a channel and calls
+// Mix_PlayChannel, so it never allocates or touches disk. When every voice is busy the one that
+// has played longest is cut off.
+class SoundEffects {
+public:
+    static constexpr int kChannelGroup = 1;
+
+    SoundEffects();
+    ~SoundEffects();
+
+    SoundEffects(const SoundEffects&) = delete;
+    SoundEffects& operator=(const SoundEffects&) = delete;
+
+    // Needs an open mixer device. Adds and reserves `voices` channels and loads every sound;
+    // does nothing if already initialized.
+    bool initialize(int voices);
+    // Stops the pool and frees the samples (also needed before the mixer device is reopened)
+    void shutdown();
+    bool isReady() const { return m_ready; }
+
+    // Start a sound now; returns the channel, or -1 if it could not be played
+    int play(SoundId id);
+    void stopAll();
+
+    int getVoiceCount() const { return m_voices; }
+    const SoundEffectStats& getStats() const { return m_stats; }
+
+    // Render a tone in the format the mixer device is open with (S16 or F32)
+    static bool synthesizeTone(const ToneSpec& tone, std::vector<Uint8>& pcm);
+
+private:
+    struct Sound {
+        Mix_Chunk* chunk = nullptr;
+        std::vector<Uint8> pcm;  // Synthesized samples behind chunk, which does not own them
+    };
+
+    bool loadSound(SoundId id, const std::string& filePath, const ToneSpec& fallback, int volume);
+
+    std::array<Sound, static_cast<size_t>(SoundId::Count)> m_sounds;
+    int m_voices;
+    bool m_ready;
+    SoundEffectStats m_stats;
+};
@@ -5,6 +5,8 @@ class Sprite : public Entity
 {
 public:
 	Sprite(float x, float y, SDL_Texture* texture, int maxRow, int maxCol);
+	// Sprite sheet stored as a region of an atlas page
+	Sprite(float x, float y, const TextureRegion& region, int maxRow, int maxCol);
 	
 	void setFrame(int row, int col);
 	inline void resetFrame()
@@ -21,7 +23,7 @@ public:
 		return col;
 	}
 
-	inline void setLoc(int x, int y)
+	inline void setLoc(float x, float y)
 	{
 		setX(x);
 		setY(y);
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <SDL.h>
+#include <vector>
+
+// Collects textured quads for a frame and draws them grouped by (layer, texture),
+// one SDL_RenderGeometry call per group. Lower layers draw first; within a layer
+// quads keep submission order per texture, so sprites that must overlap in a
+// specific order across textures belong on different layers.
+class SpriteBatch {
+public:
+    struct Quad {
+        SDL_Texture* texture;
+        SDL_Rect src;
+        SDL_FRect dst;
+        SDL_Color color;
+        int layer;
+    };
+
+    struct FlushResult {
+        int drawCalls = 0;
+        int textureBinds = 0;   // Groups whose texture differs from the previous group
+        int sprites = 0;
+        SDL_Texture* lastTexture = nullptr; // Texture of the last group drawn
+    };
+
+    SpriteBatch() = default;
+
+    SpriteBatch(const SpriteBatch&) = delete;
+    SpriteBatch& operator=(const SpriteBatch&) = delete;
+
+    // Queue a quad; null textures and empty rects are ignored
+    void submit(SDL_Texture* texture, const SDL_Rect& src, const SDL_FRect& dst, SDL_Color color, int layer = 0);
+
+    bool empty() const { return m_quads.empty(); }
+    size_t size() const { return m_quads.size(); }
+
+    // Sort by (layer, texture) and draw every group, then empty the batch.
+    // lastTexture is the texture bound before the flush, used only for counting binds.
+    FlushResult flush(SDL_Renderer* renderer, SDL_Texture* lastTexture = nullptr);
+
+    // Drop queued quads without drawing them
+    void clear() { m_quads.clear(); }
+
+private:
+    std::vector<Quad> m_quads;
+
+    // Scratch buffers reused across flushes so a steady frame does not allocate
+    std::vector<SDL_Vertex> m_vertices;
+    std::vector<int> m_indices;
+};
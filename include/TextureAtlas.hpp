@@ -0,0 +1,96 @@
+#pragma once
+
+#include "AssetHandle.hpp"
+
+#include <SDL.h>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <utility>
+
+// A sub-rectangle of a texture. Atlas-backed entities share one page texture
+// and differ only by their rect, so consecutive draws do not switch textures.
+struct TextureRegion {
+    SDL_Texture* texture = nullptr;
+    SDL_Rect rect = {0, 0, 0, 0};
+    TextureHandle handle;   // Set for cache-owned standalone textures; atlas pages are never evicted
+
+    bool isValid() const { return texture != nullptr && rect.w > 0 && rect.h > 0; }
+};
+
+// Shelf packer used to lay out images on atlas pages (no SDL calls, easy to test)
+class AtlasPacker {
+public:
+    struct Placement {
+        int page = -1;      // -1 if the item does not fit on an empty page
+        int x = 0;
+        int y = 0;
+    };
+
+    AtlasPacker(int pageWidth, int pageHeight, int padding = 2);
+
+    // Pack items given as (width, height); returns one placement per item in input order
+    std::vector<Placement> pack(const std::vector<std::pair<int, int>>& sizes);
+
+    int getPageCount() const { return m_pageCount; }
+    int getPageWidth() const { return m_pageWidth; }
+    int getPageHeight() const { return m_pageHeight; }
+
+private:
+    int m_pageWidth;
+    int m_pageHeight;
+    int m_padding;
+    int m_pageCount;
+};
+
+class TextureAtlas {
+public:
+    TextureAtlas();
+    ~TextureAtlas();
+
+    TextureAtlas(const TextureAtlas&) = delete;
+    TextureAtlas& operator=(const TextureAtlas&) = delete;
+
+    // Load each image with IMG_Load and pack them onto as few pages as possible
+    bool build(SDL_Renderer* renderer, const std::vector<std::string>& imagePaths, int pageSize);
+
+    // Pack already decoded surfaces (surfaces stay owned by the caller)
+    bool build(SDL_Renderer* renderer, const std::vector<std::pair<std::string, SDL_Surface*>>& images, int pageSize);
+
+    // The same build in steps that can be spread over frames: beginBuild packs the images and creates
+    // the empty pages, then each uploadNext() copies one image into its page. The surfaces must stay
+    // alive until isBuilding() is false; regions become available as their images are uploaded.
+    bool beginBuild(SDL_Renderer* renderer, const std::vector<std::pair<std::string, SDL_Surface*>>& images, int pageSize);
+    void uploadNext();
+    bool isBuilding() const { return m_nextUpload < m_pending.size(); }
+
+    // Look up an image by the key it was packed under; invalid region if not packed
+    TextureRegion find(const std::string& key) const;
+    bool contains(const std::string& key) const;
+
+    int getPageCount() const { return static_cast<int>(m_pages.size()); }
+    SDL_Texture* getPage(int index) const;
+    size_t getRegionCount() const { return m_regions.size(); }
+
+    // Destroy all page textures and forget every region
+    void release();
+
+private:
+    // An image waiting for uploadNext(); page -1 gets a texture of its own
+    struct PendingImage {
+        std::string key;
+        SDL_Surface* surface;
+        int page;
+        SDL_Rect rect;
+    };
+
+    std::vector<SDL_Texture*> m_pages;
+    std::unordered_map<std::string, TextureRegion> m_regions;
+
+    SDL_Renderer* m_renderer;
+    std::vector<SDL_Texture*> m_packedPages;    // By packer page index; nullptr if the page failed to create
+    std::vector<PendingImage> m_pending;
+    size_t m_nextUpload;
+
+    void finishBuild();
+};
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <limits>
+
+// Visible and culled sprite counts for one frame
+struct CullStats {
+    int visible = 0;
+    int culled = 0;
+};
+
+// Axis-aligned visibility test against the screen grown by a margin on every side.
+// The margin keeps sprites that are about to scroll in (or sway over the edge) alive.
+class ViewportCuller {
+public:
+    ViewportCuller(int width = 0, int height = 0, int margin = 0)
+        : m_width(width), m_height(height), m_margin(margin) {}
+
+    void setViewport(int width, int height) {
+        m_width = width;
+        m_height = height;
+    }
+    void setMargin(int margin) { m_margin = margin; }
+    int getMargin() const { return m_margin; }
+
+    // A zero-sized viewport disables culling
+    bool isVisible(float x, float y, float w, float h) const {
+        if (!isEnabled()) {
+            return true;
+        }
+        return x + w > -m_margin && x < m_width + m_margin &&
+               y + h > -m_margin && y < m_height + m_margin;
+    }
+    // Horizontal extent a sprite must overlap to be visible (unbounded when culling is disabled)
+    float getLeftBound() const {
+        return isEnabled() ? static_cast<float>(-m_margin) : -std::numeric_limits<float>::infinity();
+    }
+    float getRightBound() const {
+        return isEnabled() ? static_cast<float>(m_width + m_margin) : std::numeric_limits<float>::infinity();
+    }
+    bool isEnabled() const { return m_width > 0 && m_height > 0; }
+
+    // Any rect with x, y, w, h members (SDL_FRect, SDL_Rect)
+    template <typename Rect>
+    bool isVisible(const Rect& bounds) const {
+        return isVisible(bounds.x, bounds.y, bounds.w, bounds.h);
+    }
+
+private:
+    int m_width;
+    int m_height;
+    int m_margin;
+};
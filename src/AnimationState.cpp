@@ -0,0 +1,69 @@
+#include "AnimationState.hpp"
+
+#include <cmath>
+#include <algorithm>
+
+namespace Animation {
+
+SwayOffset sway(float timeSeconds, float phase) {
+    SwayOffset offset;
+    offset.x = static_cast<int>(sin(timeSeconds + phase) * 1.1);
+    offset.y = static_cast<int>(cos(timeSeconds + phase) * 1.1);
+    return offset;
+}
+
+bool stepHookThrow(HookAnimationState& state, std::uint32_t now, int& x, int& y) {
+    if (!state.isThrowing) {
+        return false;
+    }
+
+    std::uint32_t elapsed = now - state.throwStartTime;
+
+    float progress = static_cast<float>(elapsed) / state.throwDuration;
+    if (progress >= 1.0f) {
+        progress = 1.0f;
+
+        if (!state.isReturning) {
+            state.isReturning = true;
+            // Reset timer for return journey to avoid teleporting
+            state.throwStartTime = now;
+            // Swap start and target for return journey
+            std::swap(state.hookStartX, state.hookTargetX);
+            std::swap(state.hookStartY, state.hookTargetY);
+            // Recalculate progress for smooth transition
+            progress = 0.0f;
+        }
+        else {
+            state.isThrowing = false;
+            state.isReturning = false;
+            x = state.hookStartX; // back to original location
+            y = state.hookStartY;
+            return true;
+        }
+    }
+
+    x = static_cast<int>(state.hookStartX + (state.hookTargetX - state.hookStartX) * progress);
+    y = static_cast<int>(state.hookStartY + (state.hookTargetY - state.hookStartY) * progress);
+    return true;
+}
+
+void startFisherThrow(FisherAnimationState& state) {
+    state.thrown = true;
+    state.thrownTimeLeftMs = FisherAnimationState::kThrowPoseMs;
+}
+
+int stepFisherThrow(FisherAnimationState& state, double stepMs) {
+    // Hand throwing pose, held for a fixed time rather than a number of frames
+    if (!state.thrown) {
+        return 1;
+    }
+
+    state.thrownTimeLeftMs -= stepMs;
+    if (state.thrownTimeLeftMs <= 0.0) {
+        state.thrown = false;
+        return 1;
+    }
+    return 2;
+}
+
+}
@@ -0,0 +1,215 @@
+#include "AssetPack.hpp"
+#include "Logger.hpp"
+
+#include <cstring>
+#include <fstream>
+
+namespace {
+
+const char kMagic[4] = {'M', 'W', 'P', 'K'};
+constexpr size_t kHeaderSize = 32;
+constexpr size_t kTocFixedSize = 32;
+constexpr size_t kDataAlignment = 16;
+
+void appendU32(std::vector<std::uint8_t>& out, std::uint32_t value) {
+    for (int i = 0; i < 4; ++i) {
+        out.push_back(static_cast<std::uint8_t>(value >> (i * 8)));
+    }
+}
+
+void appendU64(std::vector<std::uint8_t>& out, std::uint64_t value) {
+    for (int i = 0; i < 8; ++i) {
+        out.push_back(static_cast<std::uint8_t>(value >> (i * 8)));
+    }
+}
+
+std::uint32_t readU32(const std::uint8_t* in) {
+    std::uint32_t value = 0;
+    for (int i = 0; i < 4; ++i) {
+        value |= static_cast<std::uint32_t>(in[i]) << (i * 8);
+    }
+    return value;
+}
+
+std::uint64_t readU64(const std::uint8_t* in) {
+    std::uint64_t value = 0;
+    for (int i = 0; i < 8; ++i) {
+        value |= static_cast<std::uint64_t>(in[i]) << (i * 8);
+    }
+    return value;
+}
+
+} // namespace
+
+bool AssetPack::open(const std::string& packPath) {
+    close();
+
+    if (!m_file.open(packPath)) {
+        return false;
+    }
+
+    const std::uint8_t* base = m_file.data();
+    const size_t fileSize = m_file.size();
+
+    if (fileSize < kHeaderSize || std::memcmp(base, kMagic, sizeof(kMagic)) != 0) {
+        Logger::error("AssetPack: not an asset pack: " + packPath);
+        close();
+        return false;
+    }
+
+    std::uint32_t version = readU32(base + 4);
+    if (version != kVersion) {
+        Logger::error("AssetPack: unsupported version " + std::to_string(version) + " in " + packPath);
+        close();
+        return false;
+    }
+
+    const std::uint32_t entryCount = readU32(base + 8);
+    const std::uint64_t tocOffset = readU64(base + 16);
+    const std::uint64_t tocSize = readU64(base + 24);
+    if (tocOffset > fileSize || tocSize > fileSize - tocOffset) {
+        Logger::error("AssetPack: table of contents out of range in " + packPath);
+        close();
+        return false;
+    }
+
+    // Walk the TOC, bounds-checking every record against the mapping
+    const std::uint8_t* cursor = base + tocOffset;
+    const std::uint8_t* tocEnd = cursor + tocSize;
+    m_entries.reserve(entryCount);
+
+    for (std::uint32_t i = 0; i < entryCount; ++i) {
+        if (static_cast<size_t>(tocEnd - cursor) < kTocFixedSize) {
+            break;
+        }
+
+        AssetPackEntry entry;
+        entry.type = static_cast<AssetPackEntryType>(readU32(cursor));
+        entry.width = static_cast<int>(readU32(cursor + 4));
+        entry.height = static_cast<int>(readU32(cursor + 8));
+        const std::uint32_t nameLength = readU32(cursor + 12);
+        const std::uint64_t dataOffset = readU64(cursor + 16);
+        const std::uint64_t dataSize = readU64(cursor + 24);
+        cursor += kTocFixedSize;
+
+        if (static_cast<size_t>(tocEnd - cursor) < nameLength ||
+            dataOffset > fileSize || dataSize > fileSize - dataOffset) {
+            break;
+        }
+        if (entry.type == AssetPackEntryType::Image &&
+            dataSize != static_cast<std::uint64_t>(entry.width) * entry.height * 4) {
+            break;
+        }
+
+        std::string name(reinterpret_cast<const char*>(cursor), nameLength);
+        cursor += nameLength;
+
+        entry.data = base + dataOffset;
+        entry.size = static_cast<size_t>(dataSize);
+        m_entries[name] = entry;
+    }
+
+    if (m_entries.size() != entryCount) {
+        Logger::error("AssetPack: corrupt table of contents in " + packPath);
+        close();
+        return false;
+    }
+
+    Logger::info("Mapped asset pack " + packPath + " (" + std::to_string(entryCount) + " entries, " +
+                 std::to_string(fileSize / 1024) + " KB)");
+    return true;
+}
+
+void AssetPack::close() {
+    m_entries.clear();
+    m_file.close();
+}
+
+const AssetPackEntry* AssetPack::find(const std::string& assetPath) const {
+    if (m_entries.empty()) {
+        return nullptr;
+    }
+    auto it = m_entries.find(normalizePath(assetPath));
+    return it != m_entries.end() ? &it->second : nullptr;
+}
+
+std::string AssetPack::normalizePath(const std::string& assetPath) {
+    std::string normalized = assetPath;
+    for (char& ch : normalized) {
+        if (ch == '\\') {
+            ch = '/';
+        }
+    }
+    while (normalized.compare(0, 2, "./") == 0) {
+        normalized.erase(0, 2);
+    }
+    return normalized;
+}
+
+void AssetPackWriter::addImage(const std::string& assetPath, int width, int height, const void* rgbaPixels) {
+    const std::uint8_t* pixels = static_cast<const std::uint8_t*>(rgbaPixels);
+    PendingEntry entry;
+    entry.name = AssetPack::normalizePath(assetPath);
+    entry.type = AssetPackEntryType::Image;
+    entry.width = width;
+    entry.height = height;
+    entry.bytes.assign(pixels, pixels + static_cast<size_t>(width) * height * 4);
+    m_entries.push_back(std::move(entry));
+}
+
+void AssetPackWriter::addFont(const std::string& assetPath, std::vector<std::uint8_t> fontBytes) {
+    PendingEntry entry;
+    entry.name = AssetPack::normalizePath(assetPath);
+    entry.type = AssetPackEntryType::Font;
+    entry.width = 0;
+    entry.height = 0;
+    entry.bytes = std::move(fontBytes);
+    m_entries.push_back(std::move(entry));
+}
+
+bool AssetPackWriter::write(const std::string& packPath) const {
+    std::vector<std::uint8_t> data;
+    std::vector<std::uint8_t> toc;
+    std::vector<std::uint64_t> offsets;
+
+    // Data blocks first so the TOC can record final offsets
+    for (const auto& entry : m_entries) {
+        while ((kHeaderSize + data.size()) % kDataAlignment != 0) {
+            data.push_back(0);
+        }
+        offsets.push_back(kHeaderSize + data.size());
+        data.insert(data.end(), entry.bytes.begin(), entry.bytes.end());
+    }
+
+    for (size_t i = 0; i < m_entries.size(); ++i) {
+        const auto& entry = m_entries[i];
+        appendU32(toc, static_cast<std::uint32_t>(entry.type));
+        appendU32(toc, static_cast<std::uint32_t>(entry.width));
+        appendU32(toc, static_cast<std::uint32_t>(entry.height));
+        appendU32(toc, static_cast<std::uint32_t>(entry.name.size()));
+        appendU64(toc, offsets[i]);
+        appendU64(toc, entry.bytes.size());
+        toc.insert(toc.end(), entry.name.begin(), entry.name.end());
+    }
+
+    std::vector<std::uint8_t> header(kMagic, kMagic + sizeof(kMagic));
+    appendU32(header, AssetPack::kVersion);
+    appendU32(header, static_cast<std::uint32_t>(m_entries.size()));
+    appendU32(header, 0); // Reserved
+    appendU64(header, kHeaderSize + data.size());
+    appendU64(header, toc.size());
+
+    std::ofstream out(packPath, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        Logger::error("AssetPackWriter: cannot open " + packPath + " for writing");
+        return false;
+    }
+    out.write(reinterpret_cast<const char*>(header.data()), header.size());
+    out.write(reinterpret_cast<const char*>(data.data()), data.size());
+    out.write(reinterpret_cast<const char*>(toc.data()), toc.size());
+    if (!out) {
+        Logger::error("AssetPackWriter: failed writing " + packPath);
+        return false;
+    }
+    return true;
+}
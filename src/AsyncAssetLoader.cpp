@@ -0,0 +1,265 @@
+#include "AsyncAssetLoader.hpp"
+#include "ResourceManager.hpp"
+#include "AssetPack.hpp"
+#include "Logger.hpp"
+#include "Profiler.hpp"
+
+#include <SDL_image.h>
+
+AsyncAssetLoader::AsyncAssetLoader(int workerCount)
+    : m_assetPack(nullptr), m_requestedImages(0), m_uploadedImages(0), m_stopping(false) {
+    if (workerCount < 1) {
+        workerCount = 1;
+    }
+    for (int i = 0; i < workerCount; ++i) {
+        m_workers.emplace_back(&AsyncAssetLoader::workerLoop, this);
+    }
+}
+
+AsyncAssetLoader::~AsyncAssetLoader() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+        m_tasks.clear();
+    }
+    m_taskAvailable.notify_all();
+    for (auto& worker : m_workers) {
+        worker.join();
+    }
+
+    // Anything decoded but never uploaded still owns its surfaces
+    for (auto& job : m_activeJobs) {
+        for (SDL_Surface* surface : job->surfaces) {
+            if (surface) {
+                SDL_FreeSurface(surface);
+            }
+        }
+        if (job->state->status == AssetLoadStatus::Pending) {
+            job->state->status = AssetLoadStatus::Failed;
+        }
+    }
+}
+
+void AsyncAssetLoader::setAssetPack(const AssetPack* assetPack) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_assetPack = assetPack;
+}
+
+SDL_Surface* AsyncAssetLoader::wrapPackImage(const AssetPackEntry& entry) {
+    if (entry.type != AssetPackEntryType::Image) {
+        return nullptr;
+    }
+    // SDL never writes through a surface that is only blitted from or uploaded
+    return SDL_CreateRGBSurfaceWithFormatFrom(const_cast<std::uint8_t*>(entry.data), entry.width, entry.height,
+                                              32, entry.width * 4, SDL_PIXELFORMAT_RGBA32);
+}
+
+AssetLoadHandle AsyncAssetLoader::requestImage(const std::string& filePath) {
+    return requestAtlas("", {filePath}, 0);
+}
+
+AssetLoadHandle AsyncAssetLoader::requestAtlas(const std::string& atlasName, const std::vector<std::string>& imagePaths, int pageSize) {
+    AssetLoadHandle handle;
+    handle.state = std::make_shared<AssetLoadHandle::State>();
+
+    if (imagePaths.empty()) {
+        Logger::warning("AsyncAssetLoader request with no images: " + atlasName);
+        handle.state->status = AssetLoadStatus::Failed;
+        return handle;
+    }
+
+    auto job = std::make_shared<Job>();
+    job->isAtlas = !atlasName.empty();
+    job->name = job->isAtlas ? atlasName : imagePaths.front();
+    job->paths = imagePaths;
+    job->surfaces.assign(imagePaths.size(), nullptr);
+    job->pageSize = pageSize;
+    job->remainingDecodes = static_cast<int>(imagePaths.size());
+    job->state = handle.state;
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_activeJobs.push_back(job);
+        m_requestedImages += imagePaths.size();
+        for (size_t i = 0; i < imagePaths.size(); ++i) {
+            m_tasks.push_back({job, i});
+        }
+    }
+    m_taskAvailable.notify_all();
+    return handle;
+}
+
+void AsyncAssetLoader::workerLoop() {
+    PROFILE_THREAD("Asset loader");
+    while (true) {
+        DecodeTask task;
+        const AssetPack* assetPack = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_taskAvailable.wait(lock, [this] { return m_stopping || !m_tasks.empty(); });
+            if (m_stopping) {
+                return;
+            }
+            task = std::move(m_tasks.front());
+            m_tasks.pop_front();
+            assetPack = m_assetPack;
+        }
+
+        // Decode and convert to the upload format off the render thread (packed images are already RGBA)
+        PROFILE_ZONE("AsyncAssetLoader::decode");
+        const std::string& path = task.job->paths[task.index];
+        const AssetPackEntry* packed = assetPack ? assetPack->find(path) : nullptr;
+        SDL_Surface* surface = packed ? wrapPackImage(*packed) : IMG_Load(path.c_str());
+        if (!surface) {
+            Logger::logSDLImageError(LogLevel::ERROR, "Failed to decode image: " + path);
+        } else if (surface->format->format != SDL_PIXELFORMAT_RGBA32) {
+            SDL_Surface* converted = SDL_ConvertSurfaceFormat(surface, SDL_PIXELFORMAT_RGBA32, 0);
+            SDL_FreeSurface(surface);
+            surface = converted;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            task.job->surfaces[task.index] = surface;
+            if (--task.job->remainingDecodes == 0) {
+                m_decodedJobs.push_back(task.job);
+                m_jobDecoded.notify_all();
+            }
+        }
+    }
+}
+
+int AsyncAssetLoader::pumpUploads(ResourceManager& resourceManager, double budgetMs) {
+    const Uint64 start = SDL_GetPerformanceCounter();
+    const double ticksPerMs = static_cast<double>(SDL_GetPerformanceFrequency()) / 1000.0;
+    int uploaded = 0;
+
+    while (true) {
+        if (!m_uploadingJob) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_decodedJobs.empty()) {
+                break;
+            }
+            m_uploadingJob = m_decodedJobs.front();
+            m_decodedJobs.pop_front();
+        }
+
+        std::shared_ptr<Job> job = m_uploadingJob;
+        const size_t uploadedBefore = job->uploadedImages;
+        const bool finished = uploadNext(resourceManager, *job);
+        ++uploaded;
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_uploadedImages += job->uploadedImages - uploadedBefore;
+            if (finished) {
+                for (auto it = m_activeJobs.begin(); it != m_activeJobs.end(); ++it) {
+                    if (*it == job) {
+                        m_activeJobs.erase(it);
+                        break;
+                    }
+                }
+                if (m_activeJobs.empty()) {
+                    m_requestedImages = 0;
+                    m_uploadedImages = 0;
+                }
+            }
+        }
+        if (finished) {
+            m_uploadingJob.reset();
+        }
+
+        // Each image upload is indivisible, so the budget is checked between them
+        if ((SDL_GetPerformanceCounter() - start) / ticksPerMs >= budgetMs) {
+            break;
+        }
+    }
+
+    return uploaded;
+}
+
+void AsyncAssetLoader::finishAll(ResourceManager& resourceManager) {
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            if (m_activeJobs.empty()) {
+                return;
+            }
+            if (!m_uploadingJob) {
+                m_jobDecoded.wait(lock, [this] { return !m_decodedJobs.empty(); });
+            }
+        }
+        pumpUploads(resourceManager, 1000.0);
+    }
+}
+
+float AsyncAssetLoader::getProgress() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_requestedImages == 0) {
+        return 1.0f;
+    }
+    return static_cast<float>(m_uploadedImages) / static_cast<float>(m_requestedImages);
+}
+
+bool AsyncAssetLoader::isIdle() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_activeJobs.empty();
+}
+
+bool AsyncAssetLoader::uploadNext(ResourceManager& resourceManager, Job& job) {
+    if (!job.isAtlas) {
+        if (job.surfaces.front()) {
+            job.state->texture = resourceManager.createTextureFromSurface(job.name, job.surfaces.front());
+        }
+        finishJob(job, job.state->texture != nullptr);
+        return true;
+    }
+
+    if (!job.atlas) {
+        // Pack whatever decoded; missing images fall back to standalone loads later
+        std::vector<std::pair<std::string, SDL_Surface*>> images;
+        for (size_t i = 0; i < job.paths.size(); ++i) {
+            if (job.surfaces[i]) {
+                images.emplace_back(job.paths[i], job.surfaces[i]);
+            }
+        }
+        job.atlas = std::make_unique<TextureAtlas>();
+        if (images.empty() || !job.atlas->beginBuild(resourceManager.getRenderer(), images, job.pageSize)) {
+            job.atlas.reset();
+            finishJob(job, false);
+            return true;
+        }
+    }
+
+    job.atlas->uploadNext();
+    job.uploadedImages++;
+    if (job.atlas->isBuilding()) {
+        return false;
+    }
+
+    const bool uploaded = job.atlas->getRegionCount() > 0;
+    if (uploaded) {
+        resourceManager.addAtlas(job.name, std::move(job.atlas));
+    } else {
+        Logger::warning("Failed to build atlas '" + job.name + "', images will load as separate textures");
+        job.atlas.reset();
+    }
+    finishJob(job, uploaded);
+    return true;
+}
+
+void AsyncAssetLoader::finishJob(Job& job, bool uploaded) {
+    bool decoded = true;
+    for (SDL_Surface*& surface : job.surfaces) {
+        if (surface) {
+            SDL_FreeSurface(surface);
+            surface = nullptr;
+        } else {
+            decoded = false;
+        }
+    }
+    job.uploadedImages = job.paths.size();
+
+    job.state->status = (decoded && uploaded) ? AssetLoadStatus::Ready : AssetLoadStatus::Failed;
+    Logger::debug("Async upload " + std::string(job.state->status == AssetLoadStatus::Ready ? "finished: " : "failed: ") + job.name);
+}
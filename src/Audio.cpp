@@ -1,17 +1,32 @@
 #include "Audio.hpp"
+#include "GameConfig.hpp"
+#include "SongClock.hpp"
+#include "SoundEffects.hpp"
 #include "Logger.hpp"
 #include <string>
+#include <cstdio>
 #include <iostream>
 
+namespace {
 
-Audio::Audio() : bgMusic(nullptr), m_valid(false) {
+const ToneSpec kClickTone = { 1760.0, 30.0, 6.0, 0.8 };
+
+} // namespace
+
+
+std::atomic<int> Audio::s_frequency(0);
+std::atomic<int> Audio::s_frameBytes(0);
+std::atomic<int> Audio::s_callbackFrames(0);
+std::atomic<double> Audio::s_lastCallbackMs(0.0);
+std::atomic<size_t> Audio::s_lateCallbacks(0);
+
+Audio::Audio() : bgMusic(nullptr), m_usingPcm(false), m_click(nullptr), m_requestedSamples(0), m_ownsDevice(false), m_valid(false) {
     if (SDL_Init(SDL_INIT_AUDIO) < 0) {
         Logger::logSDLError(LogLevel::ERROR, "Failed to initialize SDL audio");
         return;
     }
 
-    if (Mix_OpenAudio(44100, MIX_DEFAULT_FORMAT, 2, 2048) < 0) {
-        Logger::logSDLMixerError(LogLevel::ERROR, "Failed to initialize SDL_mixer");
+    if (!openDevice(GameConfig::getInstance().getAudioConfig().bufferSamples)) {
         SDL_QuitSubSystem(SDL_INIT_AUDIO);
         return;
     }
@@ -24,22 +39,178 @@ Audio::~Audio() {
         Mix_FreeMusic(bgMusic);
         bgMusic = nullptr;
     }
+    m_pcmMusic.release(); // Unhooks before the device goes away
+    freeClick();
+    if (m_valid) {
+        closeDevice();
+    }
+}
+
+bool Audio::openDevice(int bufferSamples) {
+    const auto& audioConfig = GameConfig::getInstance().getAudioConfig();
+    int frequency = 0;
+    Uint16 format = 0;
+    int channels = 0;
+    
+    if (Mix_QuerySpec(&frequency, &format, &channels) != 0) {
+        // Already open: asking for the same format and channels just takes another reference
+        if (Mix_OpenAudioDevice(frequency, format, channels, bufferSamples, nullptr, 0) < 0) {
+            Logger::logSDLMixerError(LogLevel::ERROR, "Failed to share the audio device");
+            return false;
+        }
+        m_requestedSamples = bufferSamples;
+        m_ownsDevice = false;
+        return true;
+    }
+    
+    const char* device = audioConfig.deviceName.empty() ? nullptr : audioConfig.deviceName.c_str();
+    const int allowedChanges = audioConfig.allowDeviceChanges
+        ? (SDL_AUDIO_ALLOW_FREQUENCY_CHANGE | SDL_AUDIO_ALLOW_CHANNELS_CHANGE | SDL_AUDIO_ALLOW_SAMPLES_CHANGE) : 0;
+    
+    int result = Mix_OpenAudioDevice(audioConfig.sampleRate, MIX_DEFAULT_FORMAT, audioConfig.channels, bufferSamples, device, allowedChanges);
+    if (result < 0 && device) {
+        Logger::logSDLMixerError(LogLevel::WARNING, "Failed to open audio device '" + audioConfig.deviceName + "', trying the default");
+        result = Mix_OpenAudioDevice(audioConfig.sampleRate, MIX_DEFAULT_FORMAT, audioConfig.channels, bufferSamples, nullptr, allowedChanges);
+    }
+    if (result < 0) {
+        Logger::logSDLMixerError(LogLevel::ERROR, "Failed to initialize SDL_mixer");
+        return false;
+    }
+    
+    Mix_QuerySpec(&frequency, &format, &channels);
+    const int sampleBytes = SDL_AUDIO_BITSIZE(format) / 8;
+    s_frequency.store(frequency, std::memory_order_relaxed);
+    s_frameBytes.store(sampleBytes * channels, std::memory_order_relaxed);
+    s_callbackFrames.store(0, std::memory_order_relaxed);
+    s_lastCallbackMs.store(0.0, std::memory_order_relaxed);
+    s_lateCallbacks.store(0, std::memory_order_relaxed);
+    Mix_SetPostMix(&Audio::postMix, nullptr);
+    
+    m_requestedSamples = bufferSamples;
+    m_ownsDevice = true;
+    
+    char buffer[160];
+    snprintf(buffer, sizeof(buffer), "Audio device: %d Hz, %d-bit, %d channels, %d-frame buffer requested (%.1f ms)",
+             frequency, SDL_AUDIO_BITSIZE(format), channels, bufferSamples, bufferSamples * 1000.0 / frequency);
+    Logger::info(buffer);
+    return true;
+}
+
+void Audio::closeDevice() {
+    if (m_ownsDevice) {
+        Mix_SetPostMix(nullptr, nullptr);
+        m_ownsDevice = false;
+    }
     Mix_CloseAudio();
 }
 
-double Audio::getMusicPositionMs() const {
+AudioDeviceSpec Audio::getDeviceSpec() const {
+    AudioDeviceSpec spec;
+    if (!m_valid || Mix_QuerySpec(&spec.frequency, &spec.format, &spec.channels) == 0 || spec.frequency <= 0) {
+        return spec;
+    }
+    
+    // Until the first callback reports the real size, assume the device took the requested buffer
+    int frames = s_callbackFrames.load(std::memory_order_relaxed);
+    spec.bufferSamples = frames > 0 ? frames : m_requestedSamples;
+    spec.outputLatencyMs = spec.bufferSamples * 1000.0 / spec.frequency + GameConfig::getInstance().getAudioConfig().deviceLatencyMs;
+    return spec;
+}
+
+bool Audio::recoverFromUnderruns() {
+    if (!m_valid || !m_ownsDevice) {
+        return false;
+    }
+    
+    auto& config = GameConfig::getInstance();
+    const auto& audioConfig = config.getAudioConfig();
+    const size_t lateCallbacks = getUnderrunCount();
+    if (lateCallbacks < static_cast<size_t>(audioConfig.underrunLimit)) {
+        return false;
+    }
+    
+    const int frames = m_requestedSamples * 2;
+    if (frames > audioConfig.maxBufferSamples) {
+        Logger::warning(std::to_string(lateCallbacks) + " audio underruns with the largest allowed buffer (" +
+                        std::to_string(m_requestedSamples) + " frames)");
+        s_lateCallbacks.store(0, std::memory_order_relaxed);
+        return false;
+    }
+    
+    // Someone else still holds the device (e.g. the calibration screen); try again after the next song
+    int frequency = 0;
+    Uint16 format = 0;
+    int channels = 0;
+    if (Mix_QuerySpec(&frequency, &format, &channels) > 1) {
+        return false;
+    }
+    
+    Logger::warning(std::to_string(lateCallbacks) + " audio underruns, reopening the device with a " +
+                    std::to_string(frames) + "-frame buffer");
+    if (bgMusic) {
+        Mix_HaltMusic();
+        Mix_FreeMusic(bgMusic);
+        bgMusic = nullptr;
+    }
+    m_pcmMusic.release(); // Decoded for the old device format
+    m_usingPcm = false;
+    freeClick(); // Resynthesized for the new device
+    closeDevice();
+    
+    if (!openDevice(frames)) {
+        m_valid = false;
+        return false;
+    }
+    config.setAudioBufferSamples(frames);
+    config.saveSettings();
+    return true;
+}
+
+void SDLCALL Audio::postMix(void* userdata, Uint8* stream, int len) {
+    // Runs on the audio thread once per device buffer - atomics only
+    const int frameBytes = s_frameBytes.load(std::memory_order_relaxed);
+    const int frequency = s_frequency.load(std::memory_order_relaxed);
+    if (frameBytes <= 0 || frequency <= 0) {
+        return;
+    }
+    const int frames = len / frameBytes;
+    s_callbackFrames.store(frames, std::memory_order_relaxed);
+    
+    // The device plays one buffer while the next is mixed; a gap of two means it ran dry
+    const double nowMs = SongClock::hostTimeMs();
+    const double lastMs = s_lastCallbackMs.exchange(nowMs, std::memory_order_relaxed);
+    const double bufferMs = frames * 1000.0 / frequency;
+    if (lastMs > 0.0 && nowMs - lastMs > 2.0 * bufferMs) {
+        s_lateCallbacks.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+MusicPosition Audio::getMusicPosition() const {
+    if (m_usingPcm) {
+        return m_pcmMusic.getPosition(); // Exact frame count handed to the mixer, stamped in its callback
+    }
+    MusicPosition position;
     if (!m_valid || !bgMusic || Mix_PlayingMusic() == 0) {
-        return 0.0;
+        position.positionMs = 0.0;
+        return position;
     }
     
     // Try to get precise audio position from SDL_mixer 2.8.0+
     double positionSeconds = Mix_GetMusicPosition(bgMusic);
     if (positionSeconds >= 0.0) {
-        return positionSeconds * 1000.0; // Convert to milliseconds
+        position.positionMs = positionSeconds * 1000.0; // Convert to milliseconds
     }
     
-    // Fallback: return -1 to indicate SDL_GetTicks should be used
-    return -1.0;
+    // Otherwise positionMs stays -1 to indicate SDL_GetTicks should be used
+    return position;
+}
+bool Audio::isMusicPlaying() const {
+    return m_usingPcm ? m_pcmMusic.isPlaying() : Mix_PlayingMusic() != 0;
+}
+void Audio::preloadMusic(const std::string& filePath) {
+    if (m_valid && !filePath.empty() && GameConfig::getInstance().getAudioConfig().predecodeMusic) {
+        m_pcmMusic.startDecode(filePath);
+    }
 }
 void Audio::playBackgroundMusic(const std::string& filePath) {
     if (!m_valid) {
@@ -58,6 +229,20 @@ void Audio::playBackgroundMusic(const std::string& filePath) {
         Mix_FreeMusic(bgMusic);
         bgMusic = nullptr;
     }
+    m_pcmMusic.stop();
+    m_usingPcm = false;
+    
+    // Pre-decoded mode: play from memory, waiting for the decode if the menu did not finish it
+    if (GameConfig::getInstance().getAudioConfig().predecodeMusic) {
+        m_pcmMusic.startDecode(filePath);
+        if (m_pcmMusic.play()) {
+            m_usingPcm = true;
+            s_lateCallbacks.store(0, std::memory_order_relaxed);
+            Logger::info("Started playing pre-decoded music: " + filePath);
+            return;
+        }
+        Logger::warning("Falling back to streaming for " + filePath);
+    }
     
     bgMusic = Mix_LoadMUS(filePath.c_str());
     if (!bgMusic) {
@@ -72,6 +257,8 @@ void Audio::playBackgroundMusic(const std::string& filePath) {
         return;
     }
     
+    // Underruns are judged per song
+    s_lateCallbacks.store(0, std::memory_order_relaxed);
     Logger::info("Started playing background music: " + filePath);
 }
 void Audio::stopBackgroundMusic() {
@@ -80,6 +267,12 @@ void Audio::stopBackgroundMusic() {
         return;
     }
     
+    if (m_usingPcm) {
+        m_pcmMusic.stop(); // The decoded song is kept for a retry
+        m_usingPcm = false;
+        Logger::info("Stopped background music");
+    }
+    
     Mix_HaltMusic();
     if (bgMusic) {
         Mix_FreeMusic(bgMusic);
@@ -87,3 +280,38 @@ void Audio::stopBackgroundMusic() {
         Logger::info("Stopped background music");
     }
 }
+
+bool Audio::playClick() {
+    if (!m_valid) {
+        return false;
+    }
+    if (!m_click && !createClick()) {
+        return false;
+    }
+    
+    if (Mix_PlayChannel(-1, m_click, 0) < 0) {
+        Logger::logSDLMixerError(LogLevel::WARNING, "Failed to play click");
+        return false;
+    }
+    return true;
+}
+void Audio::freeClick() {
+    if (m_click) {
+        Mix_FreeChunk(m_click);
+        m_click = nullptr;
+    }
+    m_clickPcm.clear();
+}
+bool Audio::createClick() {
+    if (!SoundEffects::synthesizeTone(kClickTone, m_clickPcm)) {
+        return false;
+    }
+    
+    m_click = Mix_QuickLoad_RAW(m_clickPcm.data(), static_cast<Uint32>(m_clickPcm.size()));
+    if (!m_click) {
+        Logger::logSDLMixerError(LogLevel::ERROR, "Failed to create click sound");
+        m_clickPcm.clear();
+        return false;
+    }
+    return true;
+}
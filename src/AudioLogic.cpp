@@ -19,6 +19,16 @@ double AudioLogic::timestampMsToBeat(double timestampMs, int bpm) {
     return timestampMs * bpm / 60000.0;
 }
 
+void AudioLogic::setInputOffsetMs(double offsetMs) {
+    m_inputOffsetMs = offsetMs;
+}
+double AudioLogic::getInputOffsetMs() const {
+    return m_inputOffsetMs;
+}
+double AudioLogic::applyInputOffset(double actualMs) const {
+    return actualMs - m_inputOffsetMs;
+}
+
 short int AudioLogic::checkHit(double expectedMs, double actualMs) {
     double delta = fabs(expectedMs - actualMs);
     short int scoreType = 0;
@@ -0,0 +1,113 @@
+#include "Calibration.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+// Scales a median absolute deviation to a standard deviation for normally distributed taps
+constexpr double kMadToSigma = 1.4826;
+
+// Never reject within this distance of the median, so very steady tappers keep all their taps
+constexpr double kMinOutlierMs = 5.0;
+
+double median(std::vector<double> values) {
+    const size_t mid = values.size() / 2;
+    std::nth_element(values.begin(), values.begin() + mid, values.end());
+    double upper = values[mid];
+    if (values.size() % 2 != 0) {
+        return upper;
+    }
+    double lower = *std::max_element(values.begin(), values.begin() + mid);
+    return (lower + upper) / 2.0;
+}
+
+} // namespace
+
+Calibration::Calibration(size_t leadInClicks, size_t minTaps, double outlierMads)
+    : m_leadInClicks(leadInClicks), m_minTaps(minTaps), m_outlierMads(outlierMads) {
+}
+
+void Calibration::reset() {
+    m_clicks.clear();
+    m_taps.clear();
+}
+
+void Calibration::addClick(double hostMs) {
+    m_clicks.push_back(hostMs);
+}
+
+void Calibration::addTap(double hostMs) {
+    m_taps.push_back(hostMs);
+}
+
+CalibrationResult Calibration::compute() const {
+    std::vector<double> offsets;
+    std::vector<bool> clickTapped(m_clicks.size(), false);
+    size_t repeats = 0;
+
+    for (double tap : m_taps) {
+        if (m_clicks.empty()) {
+            break;
+        }
+
+        // Nearest click on either side of the tap
+        size_t index = std::lower_bound(m_clicks.begin(), m_clicks.end(), tap) - m_clicks.begin();
+        if (index == m_clicks.size() || (index > 0 && tap - m_clicks[index - 1] < m_clicks[index] - tap)) {
+            --index;
+        }
+        if (index < m_leadInClicks) {
+            continue;
+        }
+
+        // Only the first tap on a click counts
+        if (clickTapped[index]) {
+            ++repeats;
+            continue;
+        }
+        clickTapped[index] = true;
+        offsets.push_back(tap - m_clicks[index]);
+    }
+
+    CalibrationResult result = analyze(std::move(offsets), m_minTaps, m_outlierMads);
+    result.taps += repeats;
+    result.rejected += repeats;
+    return result;
+}
+
+CalibrationResult Calibration::analyze(std::vector<double> offsetsMs, size_t minTaps, double outlierMads) {
+    CalibrationResult result;
+    result.taps = offsetsMs.size();
+    if (offsetsMs.empty()) {
+        return result;
+    }
+
+    const double center = median(offsetsMs);
+    std::vector<double> deviations;
+    deviations.reserve(offsetsMs.size());
+    for (double offset : offsetsMs) {
+        deviations.push_back(std::fabs(offset - center));
+    }
+    const double threshold = std::max(outlierMads * kMadToSigma * median(deviations), kMinOutlierMs);
+
+    double sum = 0.0;
+    double sumSquares = 0.0;
+    size_t accepted = 0;
+    for (double offset : offsetsMs) {
+        if (std::fabs(offset - center) > threshold) {
+            continue;
+        }
+        sum += offset;
+        sumSquares += offset * offset;
+        ++accepted;
+    }
+
+    result.rejected = result.taps - accepted;
+    if (accepted == 0) {
+        return result;
+    }
+    result.offsetMs = sum / accepted;
+    result.jitterMs = std::sqrt(std::max(0.0, sumSquares / accepted - result.offsetMs * result.offsetMs));
+    result.valid = accepted >= minTaps;
+    return result;
+}
@@ -0,0 +1,222 @@
+#include "Chart.hpp"
+#include "CompiledChart.hpp"
+#include "Logger.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+namespace {
+
+std::string lineContext(const std::string& sourceName, int lineNumber) {
+    return sourceName + ":" + std::to_string(lineNumber);
+}
+
+} // namespace
+
+Chart::Chart()
+    : m_bpm(0.0), m_offsetMs(0.0), m_scrollSpeed(0.0), m_loaded(false) {
+}
+
+void Chart::clear() {
+    m_title.clear();
+    m_musicPath.clear();
+    m_bpm = 0.0;
+    m_offsetMs = 0.0;
+    m_scrollSpeed = 0.0;
+    m_notes.clear();
+    m_loaded = false;
+}
+
+bool Chart::loadFromFile(const std::string& filePath) {
+    if (CompiledChart::isCompiledChart(filePath)) {
+        return loadCompiled(filePath);
+    }
+
+    std::ifstream file(filePath);
+    if (!file) {
+        Logger::error("Failed to open chart: " + filePath);
+        clear();
+        return false;
+    }
+    return load(file, filePath);
+}
+
+bool Chart::loadCompiled(const std::string& filePath) {
+    clear();
+
+    CompiledChart compiled;
+    if (!compiled.open(filePath)) {
+        return false;
+    }
+
+    m_notes.reserve(compiled.getNoteCount());
+    if (!compiled.decodeNotes(0, compiled.getNoteCount(), m_notes)) {
+        Logger::error("Corrupt note data in compiled chart: " + filePath);
+        clear();
+        return false;
+    }
+
+    m_title = compiled.getTitle();
+    m_musicPath = compiled.getMusicPath();
+    m_bpm = compiled.getBpm();
+    m_offsetMs = compiled.getOffsetMs();
+    m_scrollSpeed = compiled.getScrollSpeed();
+    m_loaded = true;
+    return true;
+}
+
+bool Chart::load(std::istream& input, const std::string& sourceName) {
+    clear();
+
+    std::string line;
+    int lineNumber = 0;
+    int version = 0;
+    bool inNotes = false;
+    bool sorted = true;
+    std::istringstream values;
+
+    while (std::getline(input, line)) {
+        ++lineNumber;
+
+        size_t comment = line.find('#');
+        if (comment != std::string::npos) {
+            line.erase(comment);
+        }
+        // One stream is reused for every line
+        values.clear();
+        values.str(line);
+
+        if (inNotes) {
+            // Skip blank lines without constructing a note
+            if (line.find_first_not_of(" \t\r") == std::string::npos) {
+                continue;
+            }
+            size_t previous = m_notes.size();
+            if (!parseNoteLine(values, sourceName, lineNumber)) {
+                clear();
+                return false;
+            }
+            if (previous > 0 && m_notes[previous].timeMs < m_notes[previous - 1].timeMs) {
+                sorted = false;
+            }
+            continue;
+        }
+
+        std::string key;
+        if (!(values >> key)) {
+            continue; // Blank or comment-only line
+        }
+        if (key == "[notes]") {
+            inNotes = true;
+            continue;
+        }
+        if (key == "version") {
+            values >> version;
+            continue;
+        }
+        if (!parseHeaderLine(key, values, sourceName, lineNumber)) {
+            clear();
+            return false;
+        }
+    }
+
+    if (version != kFormatVersion) {
+        Logger::error("Unsupported chart version " + std::to_string(version) + " in " + sourceName);
+        clear();
+        return false;
+    }
+    if (m_bpm <= 0.0) {
+        Logger::error("Chart has no bpm: " + sourceName);
+        clear();
+        return false;
+    }
+    if (m_scrollSpeed < 0.0) {
+        Logger::error("Chart has a negative scroll speed: " + sourceName);
+        clear();
+        return false;
+    }
+
+    if (!sorted) {
+        // Charts are usually written in order; stable so simultaneous notes keep file order
+        Logger::warning("Chart notes are not in time order, sorting: " + sourceName);
+        std::stable_sort(m_notes.begin(), m_notes.end(), [](const ChartNote& a, const ChartNote& b) {
+            return a.timeMs < b.timeMs;
+        });
+    }
+
+    m_notes.shrink_to_fit();
+    m_loaded = true;
+    Logger::debug("Loaded chart " + sourceName + " with " + std::to_string(m_notes.size()) + " notes");
+    return true;
+}
+
+bool Chart::parseHeaderLine(const std::string& key, std::istream& values, const std::string& sourceName, int lineNumber) {
+    if (key == "title" || key == "music") {
+        std::string text;
+        std::getline(values >> std::ws, text);
+        while (!text.empty() && (text.back() == '\r' || text.back() == ' ' || text.back() == '\t')) {
+            text.pop_back();
+        }
+        (key == "title" ? m_title : m_musicPath) = text;
+        return true;
+    }
+
+    double number = 0.0;
+    if (!(values >> number)) {
+        Logger::error("Expected a number after '" + key + "' at " + lineContext(sourceName, lineNumber));
+        return false;
+    }
+    if (key == "bpm") {
+        m_bpm = number;
+    } else if (key == "offset") {
+        m_offsetMs = number;
+    } else if (key == "scroll") {
+        m_scrollSpeed = number;
+    } else if (key == "count") {
+        // Only a hint: a bogus count must not be able to fail the load with a huge allocation
+        if (number > 0.0) {
+            m_notes.reserve(static_cast<size_t>(std::min(number, static_cast<double>(kMaxCountHint))));
+        }
+    } else {
+        // Unknown keys are skipped so newer charts still load
+        Logger::warning("Unknown chart key '" + key + "' at " + lineContext(sourceName, lineNumber));
+    }
+    return true;
+}
+
+bool Chart::parseNoteLine(std::istream& values, const std::string& sourceName, int lineNumber) {
+    double timeMs = 0.0;
+    int lane = 0;
+    std::string type;
+    if (!(values >> timeMs >> lane >> type)) {
+        Logger::error("Expected '<time_ms> <lane> <type>' at " + lineContext(sourceName, lineNumber));
+        return false;
+    }
+    if (lane < 0 || lane > 255) {
+        Logger::error("Note lane out of range at " + lineContext(sourceName, lineNumber));
+        return false;
+    }
+
+    NoteType noteType;
+    if (type == "tap") {
+        noteType = NoteType::Tap;
+    } else if (type == "hold") {
+        noteType = NoteType::Hold;
+    } else {
+        Logger::error("Unknown note type '" + type + "' at " + lineContext(sourceName, lineNumber));
+        return false;
+    }
+
+    m_notes.push_back({timeMs, static_cast<std::uint8_t>(lane), noteType});
+    return true;
+}
+
+std::vector<double> Chart::getNoteTimes() const {
+    std::vector<double> times;
+    times.reserve(m_notes.size());
+    for (const ChartNote& note : m_notes) {
+        times.push_back(note.timeMs + m_offsetMs);
+    }
+    return times;
+}
@@ -0,0 +1,430 @@
+#include "CompiledChart.hpp"
+#include "Logger.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+
+namespace {
+
+const char kMagic[4] = {'M', 'W', 'C', 'H'};
+constexpr size_t kHeaderSize = 88;
+constexpr size_t kIndexEntrySize = 16;
+
+void appendU32(std::vector<std::uint8_t>& out, std::uint32_t value) {
+    for (int i = 0; i < 4; ++i) {
+        out.push_back(static_cast<std::uint8_t>(value >> (i * 8)));
+    }
+}
+
+void appendU64(std::vector<std::uint8_t>& out, std::uint64_t value) {
+    for (int i = 0; i < 8; ++i) {
+        out.push_back(static_cast<std::uint8_t>(value >> (i * 8)));
+    }
+}
+
+void appendF64(std::vector<std::uint8_t>& out, double value) {
+    std::uint64_t bits = 0;
+    std::memcpy(&bits, &value, sizeof(bits));
+    appendU64(out, bits);
+}
+
+void appendString(std::vector<std::uint8_t>& out, const std::string& text) {
+    appendU32(out, static_cast<std::uint32_t>(text.size()));
+    out.insert(out.end(), text.begin(), text.end());
+}
+
+void appendVarint(std::vector<std::uint8_t>& out, std::uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<std::uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<std::uint8_t>(value));
+}
+
+std::uint32_t readU32(const std::uint8_t* in) {
+    std::uint32_t value = 0;
+    for (int i = 0; i < 4; ++i) {
+        value |= static_cast<std::uint32_t>(in[i]) << (i * 8);
+    }
+    return value;
+}
+
+std::uint64_t readU64(const std::uint8_t* in) {
+    std::uint64_t value = 0;
+    for (int i = 0; i < 8; ++i) {
+        value |= static_cast<std::uint64_t>(in[i]) << (i * 8);
+    }
+    return value;
+}
+
+double readF64(const std::uint8_t* in) {
+    std::uint64_t bits = readU64(in);
+    double value = 0.0;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+// Returns false if the varint runs past end or is longer than 64 bits
+bool readVarint(const std::uint8_t*& cursor, const std::uint8_t* end, std::uint64_t& value) {
+    value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        if (cursor == end) {
+            return false;
+        }
+        std::uint8_t byte = *cursor++;
+        value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace
+
+CompiledChart::CompiledChart()
+    : m_bpm(0.0), m_offsetMs(0.0), m_scrollSpeed(0.0), m_noteCount(0), m_notesPerSection(0),
+      m_sectionCount(0), m_index(nullptr), m_lanes(nullptr), m_times(nullptr), m_timesSize(0) {
+}
+
+bool CompiledChart::isCompiledChart(const std::string& filePath) {
+    std::ifstream file(filePath, std::ios::binary);
+    char magic[sizeof(kMagic)] = {};
+    return file.read(magic, sizeof(magic)) && std::memcmp(magic, kMagic, sizeof(kMagic)) == 0;
+}
+
+bool CompiledChart::open(const std::string& filePath) {
+    close();
+
+    if (!m_file.open(filePath)) {
+        return false;
+    }
+
+    const std::uint8_t* base = m_file.data();
+    const size_t fileSize = m_file.size();
+
+    if (fileSize < kHeaderSize || std::memcmp(base, kMagic, sizeof(kMagic)) != 0) {
+        Logger::error("CompiledChart: not a compiled chart: " + filePath);
+        close();
+        return false;
+    }
+
+    std::uint32_t version = readU32(base + 4);
+    if (version != kVersion) {
+        Logger::error("CompiledChart: unsupported version " + std::to_string(version) + " in " + filePath);
+        close();
+        return false;
+    }
+
+    const std::uint64_t noteCount = readU32(base + 8);
+    const std::uint64_t notesPerSection = readU32(base + 12);
+    const std::uint64_t sectionCount = readU32(base + 16);
+    const std::uint64_t metadataOffset = readU64(base + 48);
+    const std::uint64_t indexOffset = readU64(base + 56);
+    const std::uint64_t lanesOffset = readU64(base + 64);
+    const std::uint64_t timesOffset = readU64(base + 72);
+    const std::uint64_t timesSize = readU64(base + 80);
+
+    // Every block must lie inside the mapping and the section count must match the notes
+    bool valid = notesPerSection > 0 &&
+                 sectionCount == (noteCount + notesPerSection - 1) / notesPerSection &&
+                 metadataOffset <= fileSize &&
+                 indexOffset <= fileSize && sectionCount * kIndexEntrySize <= fileSize - indexOffset &&
+                 lanesOffset <= fileSize && noteCount <= fileSize - lanesOffset &&
+                 timesOffset <= fileSize && timesSize <= fileSize - timesOffset;
+
+    // Metadata strings
+    const std::uint8_t* cursor = base + metadataOffset;
+    const std::uint8_t* end = base + fileSize;
+    for (std::string* text : {&m_title, &m_musicPath}) {
+        if (!valid || end - cursor < 4) {
+            valid = false;
+            break;
+        }
+        std::uint32_t length = readU32(cursor);
+        cursor += 4;
+        if (static_cast<std::uint64_t>(end - cursor) < length) {
+            valid = false;
+            break;
+        }
+        text->assign(reinterpret_cast<const char*>(cursor), length);
+        cursor += length;
+    }
+
+    if (valid) {
+        m_noteCount = static_cast<size_t>(noteCount);
+        m_notesPerSection = static_cast<size_t>(notesPerSection);
+        m_sectionCount = static_cast<size_t>(sectionCount);
+        m_index = base + indexOffset;
+        m_lanes = base + lanesOffset;
+        m_times = base + timesOffset;
+        m_timesSize = static_cast<size_t>(timesSize);
+
+        // Sections must start in order inside the time stream so findSection can binary search
+        for (size_t i = 0; i < m_sectionCount && valid; ++i) {
+            const std::uint8_t* entry = m_index + i * kIndexEntrySize;
+            valid = readU64(entry + 8) <= m_timesSize &&
+                    (i == 0 || getSectionBaseTime(i) >= getSectionBaseTime(i - 1));
+        }
+    }
+
+    if (!valid) {
+        Logger::error("CompiledChart: corrupt header or section index in " + filePath);
+        close();
+        return false;
+    }
+
+    // Same limits as the text parser; a NaN here would reach every fish position
+    const double bpm = readF64(base + 24);
+    const double offsetMs = readF64(base + 32);
+    const double scrollSpeed = readF64(base + 40);
+    if (!std::isfinite(bpm) || bpm <= 0.0 || !std::isfinite(offsetMs) || !std::isfinite(scrollSpeed) || scrollSpeed < 0.0) {
+        Logger::error("CompiledChart: invalid bpm, offset or scroll speed in " + filePath);
+        close();
+        return false;
+    }
+    m_bpm = bpm;
+    m_offsetMs = offsetMs;
+    m_scrollSpeed = scrollSpeed;
+
+    Logger::debug("Mapped compiled chart " + filePath + " (" + std::to_string(m_noteCount) + " notes, " +
+                  std::to_string(m_sectionCount) + " sections)");
+    return true;
+}
+
+void CompiledChart::close() {
+    m_file.close();
+    m_title.clear();
+    m_musicPath.clear();
+    m_bpm = 0.0;
+    m_offsetMs = 0.0;
+    m_scrollSpeed = 0.0;
+    m_noteCount = 0;
+    m_notesPerSection = 0;
+    m_sectionCount = 0;
+    m_index = nullptr;
+    m_lanes = nullptr;
+    m_times = nullptr;
+    m_timesSize = 0;
+}
+
+std::int64_t CompiledChart::getSectionBaseTime(size_t section) const {
+    return static_cast<std::int64_t>(readU64(m_index + section * kIndexEntrySize));
+}
+
+size_t CompiledChart::findSection(double songTimeMs) const {
+    if (m_sectionCount == 0) {
+        return 0;
+    }
+    const double chartTime = (songTimeMs - m_offsetMs) * kTimeUnitsPerMs;
+
+    // Last section whose first note is at or before the time
+    size_t low = 0;
+    size_t high = m_sectionCount;
+    while (high - low > 1) {
+        size_t mid = low + (high - low) / 2;
+        if (static_cast<double>(getSectionBaseTime(mid)) <= chartTime) {
+            low = mid;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+size_t CompiledChart::findNote(double songTimeMs) const {
+    if (m_noteCount == 0) {
+        return 0;
+    }
+
+    // A section's first note can equal the previous section's last, so start one section back
+    size_t section = findSection(songTimeMs);
+    if (section > 0) {
+        --section;
+    }
+
+    const double chartTimeMs = songTimeMs - m_offsetMs;
+    std::vector<ChartNote> notes;
+    for (; section < m_sectionCount; ++section) {
+        notes.clear();
+        if (!decodeSection(section, notes)) {
+            return m_noteCount;
+        }
+        for (size_t i = 0; i < notes.size(); ++i) {
+            if (notes[i].timeMs >= chartTimeMs) {
+                return section * m_notesPerSection + i;
+            }
+        }
+    }
+    return m_noteCount;
+}
+
+bool CompiledChart::decodeSection(size_t section, std::vector<ChartNote>& out) const {
+    if (section >= m_sectionCount) {
+        return false;
+    }
+    return decodeSectionRange(section, 0, m_notesPerSection, out);
+}
+
+bool CompiledChart::decodeNotes(size_t first, size_t count, std::vector<ChartNote>& out) const {
+    if (first > m_noteCount || count > m_noteCount - first) {
+        return false;
+    }
+    out.reserve(out.size() + count);
+
+    while (count > 0) {
+        size_t section = first / m_notesPerSection;
+        size_t skip = first % m_notesPerSection;
+        size_t take = std::min(count, m_notesPerSection - skip);
+        if (!decodeSectionRange(section, skip, take, out)) {
+            return false;
+        }
+        first += take;
+        count -= take;
+    }
+    return true;
+}
+
+bool CompiledChart::decodeSectionRange(size_t section, size_t skip, size_t count, std::vector<ChartNote>& out) const {
+    const size_t firstNote = section * m_notesPerSection;
+    const size_t sectionNotes = std::min(m_notesPerSection, m_noteCount - firstNote);
+    const size_t last = std::min(sectionNotes, skip + count);
+
+    const std::uint8_t* entry = m_index + section * kIndexEntrySize;
+    const std::uint8_t* cursor = m_times + readU64(entry + 8);
+    const std::uint8_t* end = m_times + m_timesSize;
+    std::uint64_t time = readU64(entry);
+
+    // Skipped notes still have to be walked - deltas are relative to the previous note
+    for (size_t i = 0; i < last; ++i) {
+        std::uint64_t delta = 0;
+        if (!readVarint(cursor, end, delta)) {
+            return false;
+        }
+        time += delta;
+        if (i < skip) {
+            continue;
+        }
+
+        std::uint8_t packed = m_lanes[firstNote + i];
+        out.push_back({static_cast<double>(time) / kTimeUnitsPerMs,
+                       static_cast<std::uint8_t>(packed & 0x0F),
+                       static_cast<NoteType>(packed >> 4)});
+    }
+    return true;
+}
+
+std::vector<double> CompiledChart::getNoteTimes() const {
+    std::vector<double> times;
+    times.reserve(m_noteCount);
+
+    const std::uint8_t* end = m_times + m_timesSize;
+    for (size_t section = 0; section < m_sectionCount; ++section) {
+        const std::uint8_t* entry = m_index + section * kIndexEntrySize;
+        const std::uint8_t* cursor = m_times + readU64(entry + 8);
+        std::uint64_t time = readU64(entry);
+        const size_t sectionNotes = std::min(m_notesPerSection, m_noteCount - section * m_notesPerSection);
+
+        for (size_t i = 0; i < sectionNotes; ++i) {
+            std::uint64_t delta = 0;
+            if (!readVarint(cursor, end, delta)) {
+                Logger::error("CompiledChart: corrupt note times in section " + std::to_string(section));
+                return {};
+            }
+            time += delta;
+            times.push_back(static_cast<double>(time) / kTimeUnitsPerMs + m_offsetMs);
+        }
+    }
+    return times;
+}
+
+CompiledChartWriter::CompiledChartWriter(std::uint32_t notesPerSection)
+    : m_notesPerSection(notesPerSection > 0 ? notesPerSection : CompiledChart::kDefaultNotesPerSection) {
+}
+
+bool CompiledChartWriter::build(const Chart& chart, std::vector<std::uint8_t>& out) const {
+    const std::vector<ChartNote>& notes = chart.getNotes();
+    const size_t sectionCount = (notes.size() + m_notesPerSection - 1) / m_notesPerSection;
+
+    std::vector<std::uint8_t> index;
+    std::vector<std::uint8_t> lanes;
+    std::vector<std::uint8_t> times;
+    index.reserve(sectionCount * kIndexEntrySize);
+    lanes.reserve(notes.size());
+    times.reserve(notes.size() * 2); // Most deltas fit in two or three bytes
+
+    std::uint64_t previous = 0;
+    for (size_t i = 0; i < notes.size(); ++i) {
+        const ChartNote& note = notes[i];
+        if (note.timeMs < 0.0) {
+            Logger::error("CompiledChartWriter: note " + std::to_string(i) + " has a negative time");
+            return false;
+        }
+        if (note.lane > CompiledChart::kMaxLane) {
+            Logger::error("CompiledChartWriter: note " + std::to_string(i) + " lane " + std::to_string(note.lane) +
+                          " is above " + std::to_string(CompiledChart::kMaxLane));
+            return false;
+        }
+
+        std::uint64_t time = static_cast<std::uint64_t>(std::llround(note.timeMs * CompiledChart::kTimeUnitsPerMs));
+        if (i % m_notesPerSection == 0) {
+            appendU64(index, time);
+            appendU64(index, times.size());
+            previous = time;
+        }
+        appendVarint(times, time - previous);
+        previous = time;
+        lanes.push_back(static_cast<std::uint8_t>(note.lane | (static_cast<std::uint8_t>(note.type) << 4)));
+    }
+
+    std::vector<std::uint8_t> metadata;
+    appendString(metadata, chart.getTitle());
+    appendString(metadata, chart.getMusicPath());
+
+    const std::uint64_t metadataOffset = kHeaderSize;
+    const std::uint64_t indexOffset = metadataOffset + metadata.size();
+    const std::uint64_t lanesOffset = indexOffset + index.size();
+    const std::uint64_t timesOffset = lanesOffset + lanes.size();
+
+    out.assign(kMagic, kMagic + sizeof(kMagic));
+    appendU32(out, CompiledChart::kVersion);
+    appendU32(out, static_cast<std::uint32_t>(notes.size()));
+    appendU32(out, m_notesPerSection);
+    appendU32(out, static_cast<std::uint32_t>(sectionCount));
+    appendU32(out, 0); // Reserved
+    appendF64(out, chart.getBpm());
+    appendF64(out, chart.getOffsetMs());
+    appendF64(out, chart.getScrollSpeed());
+    appendU64(out, metadataOffset);
+    appendU64(out, indexOffset);
+    appendU64(out, lanesOffset);
+    appendU64(out, timesOffset);
+    appendU64(out, times.size());
+
+    out.insert(out.end(), metadata.begin(), metadata.end());
+    out.insert(out.end(), index.begin(), index.end());
+    out.insert(out.end(), lanes.begin(), lanes.end());
+    out.insert(out.end(), times.begin(), times.end());
+    return true;
+}
+
+bool CompiledChartWriter::write(const Chart& chart, const std::string& filePath) const {
+    std::vector<std::uint8_t> bytes;
+    if (!build(chart, bytes)) {
+        return false;
+    }
+
+    std::ofstream out(filePath, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        Logger::error("CompiledChartWriter: cannot open " + filePath + " for writing");
+        return false;
+    }
+    out.write(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+    if (!out) {
+        Logger::error("CompiledChartWriter: failed writing " + filePath);
+        return false;
+    }
+    return true;
+}
@@ -1,7 +1,7 @@
 #include "Entity.hpp"
 
 // Constructor overload for raw SDL_Texture* (non-owning reference)
-Entity::Entity(float x, float y, SDL_Texture* texture) : x(x), y(y), texture_(nullptr), rawTexture_(texture) {
+Entity::Entity(float x, float y, SDL_Texture* texture) : x(x), y(y), texture_(nullptr), rawTexture_(texture), regionOrigin_{0, 0} {
 	currentFrame.x = 0;
 	currentFrame.y = 0;
 	// Automatically detect texture size with error checking
@@ -16,7 +16,7 @@ Entity::Entity(float x, float y, SDL_Texture* texture) : x(x), y(y), texture_(nu
 	}
 }
 
-Entity::Entity(float x, float y, SharedSDLTexture texture) : x(x), y(y), texture_(texture), rawTexture_(nullptr)
+Entity::Entity(float x, float y, SharedSDLTexture texture) : x(x), y(y), texture_(texture), rawTexture_(nullptr), regionOrigin_{0, 0}
 {
 	currentFrame.x = 0;
 	currentFrame.y = 0;
@@ -31,6 +31,19 @@ Entity::Entity(float x, float y, SharedSDLTexture texture) : x(x), y(y), texture
 		currentFrame.h = 0;
 	}
 }
+// Constructor for atlas regions (non-owning, the atlas owns the page texture)
+Entity::Entity(float x, float y, const TextureRegion& region) : x(x), y(y), texture_(nullptr), rawTexture_(region.texture), regionOrigin_{region.rect.x, region.rect.y}, textureHandle_(region.handle)
+{
+	currentFrame = region.rect;
+}
+void Entity::setTexture(const TextureRegion& region)
+{
+	rawTexture_ = region.texture;
+	texture_ = nullptr;
+	regionOrigin_ = {region.rect.x, region.rect.y};
+	textureHandle_ = region.handle;
+	currentFrame = region.rect;
+}
 void Entity::setCurrentFrameW(int w)
 {
 	currentFrame.w = w;
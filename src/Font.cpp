@@ -19,6 +19,26 @@ bool Font::load(const std::string& fontPath, int fontSz)
     return true;
 }
 
+bool Font::loadFromMemory(const void* data, size_t size, int fontSz)
+{
+    unload();
+
+    SDL_RWops* rw = SDL_RWFromConstMem(data, static_cast<int>(size));
+    if (!rw)
+    {
+        std::cerr << "Failed to wrap font memory: " << SDL_GetError() << std::endl;
+        return false;
+    }
+
+    font = TTF_OpenFontRW(rw, 1, fontSz); // freesrc = 1 closes the RWops along with the font
+    if (!font)
+    {
+        std::cerr << "Failed to load font from memory: " << TTF_GetError() << std::endl;
+        return false;
+    }
+    return true;
+}
+
 void Font::unload()
 {
     if (font)
@@ -47,3 +67,43 @@ SDL_Texture* Font::renderText(SDL_Renderer* renderer, const std::string& txt, SD
 
     return texture; // It's on the caller's part to destroy the texture 
 }
+
+SDL_Surface* Font::renderGlyph(Uint16 ch, SDL_Color color)
+{
+    if (!font)
+    {
+        return nullptr;
+    }
+
+    SDL_Surface* glyphSurface = TTF_RenderGlyph_Blended(font, ch, color);
+    if (!glyphSurface)
+    {
+        std::cerr << "Failed to render glyph " << ch << ": " << TTF_GetError() << std::endl;
+    }
+    return glyphSurface;
+}
+
+bool Font::getGlyphMetrics(Uint16 ch, int& minX, int& advance)
+{
+    if (!font)
+    {
+        return false;
+    }
+
+    int maxX, minY, maxY;
+    return TTF_GlyphMetrics(font, ch, &minX, &maxX, &minY, &maxY, &advance) == 0;
+}
+
+int Font::getKerning(Uint16 previous, Uint16 ch)
+{
+    if (!font)
+    {
+        return 0;
+    }
+    return TTF_GetFontKerningSizeGlyphs(font, previous, ch);
+}
+
+int Font::getLineHeight() const
+{
+    return font ? TTF_FontHeight(font) : 0;
+}
@@ -0,0 +1,119 @@
+#include "FramePacer.hpp"
+#include "Profiler.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <utility>
+
+FramePacer::FramePacer(double targetFps, bool vsync)
+    : m_frequency(SDL_GetPerformanceFrequency()), m_frameTicks(0), m_deadline(0), m_lastFrameEnd(0),
+      m_targetFps(0.0), m_spinMs(kDefaultSpinMs), m_lastFrameMs(0.0), m_vsync(vsync), m_historyNext(0), m_idleTicks(0) {
+    m_history.reserve(kHistorySize);
+    setTargetFps(targetFps);
+    reset();
+}
+
+void FramePacer::setTargetFps(double fps) {
+    m_targetFps = fps > 0.0 ? fps : 0.0;
+    m_frameTicks = m_targetFps > 0.0 ? static_cast<Uint64>(m_frequency / m_targetFps) : 0;
+}
+
+void FramePacer::reset() {
+    m_lastFrameEnd = SDL_GetPerformanceCounter();
+    m_deadline = m_lastFrameEnd + m_frameTicks;
+    m_lastFrameMs = 0.0;
+    m_history.clear();
+    m_historyNext = 0;
+}
+
+void FramePacer::endFrame() {
+    PROFILE_ZONE("FramePacer::endFrame");
+    if (!m_vsync && m_frameTicks > 0) {
+        waitUntil(m_deadline);
+
+        // Deadlines advance by whole frames so small overshoots do not accumulate;
+        // after a long stall (loading, window drag) restart from now instead of rushing to catch up
+        Uint64 now = SDL_GetPerformanceCounter();
+        m_deadline += m_frameTicks;
+        if (now > m_deadline) {
+            m_deadline = now + m_frameTicks;
+        }
+    } else {
+        // Nothing to wait on here (the present blocked instead), so the task gets one run per frame
+        runIdleTask();
+    }
+
+    Uint64 frameEnd = SDL_GetPerformanceCounter();
+    m_lastFrameMs = (frameEnd - m_lastFrameEnd) * 1000.0 / m_frequency;
+    m_lastFrameEnd = frameEnd;
+    record(m_lastFrameMs);
+}
+
+void FramePacer::setIdleTask(std::function<void()> task, double intervalMs) {
+    m_idleTask = std::move(task);
+    m_idleTicks = static_cast<Uint64>(std::max(intervalMs, 0.0) * m_frequency / 1000.0);
+}
+
+void FramePacer::runIdleTask() {
+    if (m_idleTask) {
+        m_idleTask();
+    }
+}
+
+void FramePacer::waitUntil(Uint64 deadline) {
+    const Uint64 spinTicks = static_cast<Uint64>(m_spinMs * m_frequency / 1000.0);
+
+    // Coarse sleep for everything but the tail; SDL_Delay may oversleep by the scheduler quantum.
+    // With an idle task the sleep is cut into slices so the task runs in between.
+    Uint64 now = SDL_GetPerformanceCounter();
+    while (now + spinTicks < deadline) {
+        Uint64 sleepTicks = deadline - spinTicks - now;
+        if (m_idleTask) {
+            m_idleTask();
+            sleepTicks = std::min(sleepTicks, m_idleTicks);
+        }
+        Uint32 sleepMs = static_cast<Uint32>(sleepTicks * 1000 / m_frequency);
+        if (sleepMs == 0) {
+            break;
+        }
+        SDL_Delay(sleepMs);
+        now = SDL_GetPerformanceCounter();
+    }
+
+    // Spin for the remainder
+    Uint64 nextIdle = now;
+    while ((now = SDL_GetPerformanceCounter()) < deadline) {
+        if (m_idleTask && now >= nextIdle) {
+            m_idleTask();
+            nextIdle = now + m_idleTicks;
+        }
+    }
+}
+
+void FramePacer::record(double frameMs) {
+    if (m_history.size() < kHistorySize) {
+        m_history.push_back(static_cast<float>(frameMs));
+    } else {
+        m_history[m_historyNext] = static_cast<float>(frameMs);
+    }
+    m_historyNext = (m_historyNext + 1) % kHistorySize;
+}
+
+FrameTimeStats FramePacer::getStats() const {
+    FrameTimeStats stats;
+    if (m_history.empty()) {
+        return stats;
+    }
+
+    std::vector<float> sorted(m_history);
+    std::sort(sorted.begin(), sorted.end());
+
+    stats.frames = sorted.size();
+    stats.minMs = sorted.front();
+    stats.maxMs = sorted.back();
+    stats.avgMs = std::accumulate(sorted.begin(), sorted.end(), 0.0) / sorted.size();
+    // Nearest-rank percentile
+    size_t p99Index = (sorted.size() * 99 + 99) / 100 - 1;
+    stats.p99Ms = sorted[p99Index];
+    return stats;
+}
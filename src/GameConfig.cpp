@@ -1,5 +1,10 @@
 #include "GameConfig.hpp"
-#include "AudioLogic.hpp"
+#include "CompiledChart.hpp"
+#include "Logger.hpp"
+#include "Profiler.hpp"
+
+#include <fstream>
+#include <sstream>
 
 GameConfig& GameConfig::getInstance()
 {
@@ -7,21 +12,82 @@ GameConfig& GameConfig::getInstance()
     return instance;
 }
 
-void GameConfig::initializeBeatTimings()
+bool GameConfig::initializeBeatTimings()
 {
     if (!gameplayConfig.noteBeats.empty())
-        return; // Already initialized
+        return true; // Already initialized
+    
+    if (CompiledChart::isCompiledChart(assetPaths.compiledChartPath))
+        return loadChart(assetPaths.compiledChartPath);
+    return loadChart(assetPaths.chartPath);
+}
+
+bool GameConfig::loadChart(const std::string& filePath)
+{
+    PROFILE_ZONE("GameConfig::loadChart");
+    if (!chart.loadFromFile(filePath)) {
+        Logger::error("Could not load note chart: " + filePath);
+        gameplayConfig.noteBeats.clear();
+        return false;
+    }
     
-    AudioLogic audioLogic;
-    gameplayConfig.noteBeats = {
-        audioLogic.msFromMscs(0,3,46), audioLogic.msFromMscs(0,7,75), audioLogic.msFromMscs(0,9,38), 
-        audioLogic.msFromMscs(0,10,61), audioLogic.msFromMscs(0,12,24), audioLogic.msFromMscs(0,13,06),
-        audioLogic.msFromMscs(0,13,87), audioLogic.msFromMscs(0,15,30), audioLogic.msFromMscs(0,17,95), 
-        audioLogic.msFromMscs(0,20,0), audioLogic.msFromMscs(0,21,22), audioLogic.msFromMscs(0,23,26),
-        audioLogic.msFromMscs(0,27,14), audioLogic.msFromMscs(0,28,57), audioLogic.msFromMscs(0,30,40), 
-        audioLogic.msFromMscs(0,31,93), audioLogic.msFromMscs(0,32,65), audioLogic.msFromMscs(0,34,69),
-        audioLogic.msFromMscs(0,35,91), audioLogic.msFromMscs(0,37,95), audioLogic.msFromMscs(0,41,83), 
-        audioLogic.msFromMscs(0,43,26), audioLogic.msFromMscs(0,45,10), audioLogic.msFromMscs(0,46,52),
-        audioLogic.msFromMscs(0,48,57)
-    };
-}
\ No newline at end of file
+    gameplayConfig.noteBeats = chart.getNoteTimes();
+    return true;
+}
+
+bool GameConfig::loadSettings()
+{
+    std::ifstream file(calibrationConfig.settingsPath);
+    if (!file) {
+        Logger::info("No settings file at " + calibrationConfig.settingsPath + ", using defaults");
+        return false;
+    }
+    
+    // One "key value" pair per line; '#' starts a comment
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(file, line)) {
+        ++lineNumber;
+        std::string::size_type comment = line.find('#');
+        if (comment != std::string::npos)
+            line.erase(comment);
+        
+        std::istringstream fields(line);
+        std::string key;
+        if (!(fields >> key))
+            continue;
+        
+        if (key == "input_offset_ms") {
+            double offsetMs = 0.0;
+            if (fields >> offsetMs)
+                audioConfig.inputOffsetMs = offsetMs;
+            else
+                Logger::warning(calibrationConfig.settingsPath + ":" + std::to_string(lineNumber) + ": expected a number after input_offset_ms");
+        } else if (key == "audio_buffer_samples") {
+            int frames = 0;
+            if (fields >> frames && frames > 0)
+                audioConfig.bufferSamples = frames;
+            else
+                Logger::warning(calibrationConfig.settingsPath + ":" + std::to_string(lineNumber) + ": expected a positive frame count after audio_buffer_samples");
+        } else {
+            Logger::warning(calibrationConfig.settingsPath + ":" + std::to_string(lineNumber) + ": unknown setting '" + key + "'");
+        }
+    }
+    
+    Logger::info("Loaded settings from " + calibrationConfig.settingsPath);
+    return true;
+}
+
+bool GameConfig::saveSettings() const
+{
+    std::ofstream file(calibrationConfig.settingsPath, std::ios::trunc);
+    if (!file) {
+        Logger::error("Could not write settings file: " + calibrationConfig.settingsPath);
+        return false;
+    }
+    
+    file << "# Meowstro settings - written by the game\n";
+    file << "input_offset_ms " << audioConfig.inputOffsetMs << "\n";
+    file << "audio_buffer_samples " << audioConfig.bufferSamples << "\n";
+    return static_cast<bool>(file);
+}
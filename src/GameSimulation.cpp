@@ -0,0 +1,341 @@
+#include "GameSimulation.hpp"
+#include "Profiler.hpp"
+
+#include <algorithm>
+#include <random>
+
+GameSimulation::GameSimulation()
+    : m_clock(nullptr)
+    , m_music(nullptr)
+    , m_simTimeMs(0.0)
+    , m_songTimeMs(0.0)
+    , m_interpolationAlpha(1.0f)
+    , m_animationSeconds(0.0f)
+    , m_firstFish(0)
+    , m_lastFish(0)
+    , m_maxFishWidth(0.0f)
+    , m_fishColumn(1)
+{
+}
+
+void GameSimulation::reset(const SimulationConfig& config) {
+    m_config = config;
+    m_config.fishVariants = std::max(m_config.fishVariants, 1);
+
+    m_rhythmLogic.setInputOffsetMs(m_config.inputOffsetMs);
+    m_judgement = JudgementEngine(m_config.perfectWindowMs, m_config.goodWindowMs);
+    m_judgement.load(m_config.noteTimesMs);
+    m_stats.resetStats();
+    m_replay.begin(m_config.seed, m_config.noteTimesMs, m_rhythmLogic.getInputOffsetMs(),
+                   m_judgement.getPerfectWindowMs(), m_judgement.getGoodWindowMs());
+
+    m_simTimeMs = 0.0;
+    m_songTimeMs = 0.0;
+    m_hookState = HookAnimationState();
+    m_hookState.throwDuration = m_config.throwDuration;
+    m_fisherState = FisherAnimationState();
+
+    // One fish per note; positions are set once a fish scrolls into the window.
+    // mt19937 output is fixed by the standard, so a seed gives the same variants on every platform.
+    std::mt19937 rng(m_config.seed);
+    m_fish.assign(m_config.noteTimesMs.size(), Fish());
+    for (Fish& fish : m_fish) {
+        fish.variant = static_cast<int>(rng() % m_config.fishVariants);
+        fish.baseY = fish.y = static_cast<float>(m_config.fishY);
+    }
+    m_fishPositions.assign(m_fish.size(), InterpolatedPosition());
+    m_firstFish = 0;
+    m_lastFish = 0;
+    m_caughtFish.clear();
+    m_maxFishWidth = 0.0f;
+    for (const auto& frameSize : m_config.fishFrameSizes) {
+        m_maxFishWidth = std::max(m_maxFishWidth, static_cast<float>(frameSize.first));
+    }
+
+    m_fisher = Body();
+    m_boat = Body();
+    m_hook = Body();
+    m_fisher.x = static_cast<float>(m_config.fisherPosition.first);
+    m_fisher.y = static_cast<float>(m_config.fisherPosition.second);
+    m_boat.x = static_cast<float>(m_config.boatPosition.first);
+    m_boat.y = static_cast<float>(m_config.boatPosition.second);
+    m_hook.x = static_cast<float>(m_config.hookPosition.first);
+    m_hook.y = static_cast<float>(m_config.hookPosition.second);
+
+    // Simulate the first step at song time 0 and start interpolation from there
+    stepSimulation();
+    for (Body* body : {&m_fisher, &m_boat, &m_hook}) {
+        body->position.snap(body->x, body->y);
+    }
+    m_interpolationAlpha = 1.0f;
+
+    m_snapshot = RenderSnapshot();
+    buildSnapshot();
+}
+
+const RenderSnapshot& GameSimulation::step(double songTimeMs, const std::vector<double>& pressTimesMs) {
+    PROFILE_ZONE("GameSimulation::step");
+    m_songTimeMs = songTimeMs;
+    m_snapshot.hits.clear();
+    m_snapshot.misses = 0;
+
+    // Presses first, at the time the key went down, so frame time is not added to the error.
+    // A key that went down before the song started counts as pressed at its start.
+    for (double pressTimeMs : pressTimesMs) {
+        judgePress(songTimeMs, std::max(std::min(pressTimeMs, songTimeMs), 0.0));
+    }
+
+    resolveMisses(songTimeMs);
+    advanceSimulation(songTimeMs);
+    buildSnapshot();
+    return m_snapshot;
+}
+
+const RenderSnapshot& GameSimulation::update(const std::vector<double>& pressTimesMs) {
+    return step(m_clock ? m_clock->songTimeMs() : 0.0, pressTimesMs);
+}
+
+bool GameSimulation::isFinished() const {
+    return m_music ? !m_music->isMusicPlaying() : m_judgement.isFinished();
+}
+
+void GameSimulation::finishReplay() {
+    // Every recorded event is at or before this time; the simulation steps can trail it
+    m_replay.finish(std::max(m_songTimeMs, m_simTimeMs), m_stats);
+}
+
+void GameSimulation::judgePress(double songTimeMs, double pressTimeMs) {
+    // Every press throws the hook, hit or not
+    if (!m_hookState.isThrowing) {
+        Animation::startFisherThrow(m_fisherState);
+
+        m_hookState.isThrowing = true;
+        m_hookState.isReturning = false;
+        m_hookState.throwStartTime = static_cast<std::uint32_t>(m_simTimeMs); // Simulation clock
+
+        int handX = static_cast<int>(m_fisher.x + 135);
+        int handY = static_cast<int>(m_fisher.y + 50);
+        m_hookState.hookStartX = handX;
+        m_hookState.hookStartY = handY;
+        m_hookState.hookTargetX = handX + 300;
+        m_hookState.hookTargetY = handY + 475;
+    }
+
+    // Judge against the earliest open note in the timing window, corrected by the calibrated offset
+    m_replay.recordPress(pressTimeMs);
+    JudgementResult result = m_judgement.judgeHit(m_rhythmLogic.applyInputOffset(pressTimeMs));
+    if (!result.isHit()) {
+        return;
+    }
+
+    const size_t index = static_cast<size_t>(result.noteIndex);
+    Fish& fish = m_fish[index];
+    if (index < m_firstFish || index >= m_lastFish) {
+        // Not moved outside the window, so put the popup where the fish would be now
+        fish.x = fish.baseX = fishScrollX(index);
+        fish.y = fish.baseY = static_cast<float>(m_config.fishY);
+        m_fishPositions[index].snap(fish.x, fish.y);
+    }
+    fish.caught = true;
+    fish.active = false;
+    fish.judgement = result.judgement;
+    fish.caughtAtMs = songTimeMs;
+    m_caughtFish.push_back(index);
+
+    m_stats++;
+    m_stats.increaseScore(judgementScore(result.judgement));
+    m_snapshot.hits.push_back(result);
+}
+
+void GameSimulation::resolveMisses(double songTimeMs) {
+    // Same offset as hits, so a late-calibrated player is not marked missed before their tap arrives
+    int misses = m_judgement.resolveMisses(m_rhythmLogic.applyInputOffset(songTimeMs));
+    if (misses > 0) {
+        m_replay.recordMissSweep(songTimeMs); // Sweeps that resolve nothing change nothing on playback
+    }
+    for (int i = 0; i < misses; ++i) {
+        m_stats--;
+    }
+    m_snapshot.misses += misses;
+}
+
+void GameSimulation::advanceSimulation(double songTimeMs) {
+    const double stepMs = m_config.stepMs;
+
+    // After a long stall, skip ahead instead of replaying every missed step
+    if (songTimeMs - m_simTimeMs > stepMs * m_config.maxSteps) {
+        m_simTimeMs = songTimeMs - stepMs;
+    }
+
+    while (m_simTimeMs + stepMs <= songTimeMs) {
+        m_simTimeMs += stepMs;
+        stepSimulation();
+    }
+
+    // Leftover time since the last step; the audio clock can briefly run behind it
+    float alpha = static_cast<float>((songTimeMs - m_simTimeMs) / stepMs);
+    m_interpolationAlpha = std::min(std::max(alpha, 0.0f), 1.0f);
+}
+
+void GameSimulation::stepSimulation() {
+    PROFILE_ZONE("GameSimulation::stepSimulation");
+    // Everything below reads the simulation clock, so results do not depend on frame rate
+    m_animationSeconds = static_cast<float>(m_simTimeMs / 1000.0);
+    const size_t firstEntered = updateFishWindow();
+    updateFishMovement();
+    updateFishVisibility();
+    updateAnimations();
+
+    // Fish that just entered the window start interpolating from where they are
+    for (size_t i = m_firstFish; i < m_lastFish; ++i) {
+        if (i < firstEntered) {
+            m_fishPositions[i].advance(m_fish[i].x, m_fish[i].y);
+        } else {
+            m_fishPositions[i].snap(m_fish[i].x, m_fish[i].y);
+        }
+    }
+    for (Body* body : {&m_fisher, &m_boat, &m_hook}) {
+        body->position.advance(body->x, body->y);
+    }
+}
+
+size_t GameSimulation::updateFishWindow() {
+    // A fish enters once its left edge is inside the right bound and leaves once even the widest
+    // variant is past the left bound. Returns the first fish that entered this step.
+    const size_t firstEntered = m_lastFish;
+    const float rightBound = m_config.culler.getRightBound();
+    const float leftBound = m_config.culler.getLeftBound() - m_maxFishWidth;
+    while (m_lastFish < m_fish.size() && fishScrollX(m_lastFish) < rightBound) {
+        m_lastFish++;
+    }
+    while (m_firstFish < m_lastFish && fishScrollX(m_firstFish) <= leftBound) {
+        m_firstFish++;
+    }
+    return std::max(firstEntered, m_firstFish);
+}
+
+float GameSimulation::fishScrollX(size_t index) const {
+    // Each fish reaches fishTargetX exactly at its note time
+    return static_cast<float>(m_config.fishTargetX + (m_config.noteTimesMs[index] - m_simTimeMs) * m_config.fishSpeed);
+}
+
+void GameSimulation::updateFishMovement() {
+    // Caught fish stay where they were caught
+    const float fishY = static_cast<float>(m_config.fishY);
+    for (size_t i = m_firstFish; i < m_lastFish; ++i) {
+        Fish& fish = m_fish[i];
+        if (fish.caught) {
+            continue;
+        }
+        fish.baseX = fishScrollX(i);
+        fish.baseY = fishY;
+        fish.x = fish.baseX;
+        fish.y = fish.baseY;
+    }
+}
+
+void GameSimulation::updateFishVisibility() {
+    m_fishCull = CullStats();
+
+    for (size_t i = m_firstFish; i < m_lastFish; ++i) {
+        Fish& fish = m_fish[i];
+        fish.active = false;
+        if (fish.caught) {
+            continue; // Caught fish are replaced by their score popup
+        }
+
+        std::pair<int, int> frameSize = {0, 0};
+        if (fish.variant < static_cast<int>(m_config.fishFrameSizes.size())) {
+            frameSize = m_config.fishFrameSizes[fish.variant];
+        }
+        if (m_config.culler.isVisible(fish.baseX, fish.baseY, static_cast<float>(frameSize.first), static_cast<float>(frameSize.second))) {
+            fish.active = true;
+            m_fishCull.visible++;
+        }
+    }
+
+    // Every other uncaught fish is culled, most of them without being looked at
+    m_fishCull.culled = static_cast<int>(m_fish.size()) - m_stats.getHits() - m_fishCull.visible;
+}
+
+void GameSimulation::updateAnimations() {
+    PROFILE_ZONE("GameSimulation::updateAnimations");
+    m_fisher.column = Animation::stepFisherThrow(m_fisherState, m_config.stepMs);
+
+    int hookX = 0;
+    int hookY = 0;
+    if (Animation::stepHookThrow(m_hookState, static_cast<std::uint32_t>(m_simTimeMs), hookX, hookY)) {
+        m_hook.x = static_cast<float>(hookX);
+        m_hook.y = static_cast<float>(hookY);
+    }
+
+    // Sway is a function of absolute time, so skipped fish pick up the right offset once active
+    SwayOffset sway = Animation::sway(m_animationSeconds);
+    if (!m_hookState.isThrowing) {
+        m_hook.x = static_cast<float>(m_config.hookPosition.first + sway.x);
+        m_hook.y = static_cast<float>(m_config.hookPosition.second + sway.y);
+    }
+    m_boat.x = static_cast<float>(m_config.boatPosition.first + sway.x);
+    m_boat.y = static_cast<float>(m_config.boatPosition.second + sway.y);
+    m_fisher.x = static_cast<float>(m_config.fisherPosition.first + sway.x);
+    m_fisher.y = static_cast<float>(m_config.fisherPosition.second + sway.y);
+
+    for (size_t i = m_firstFish; i < m_lastFish; ++i) {
+        Fish& fish = m_fish[i];
+        if (fish.active) {
+            SwayOffset fishSway = Animation::sway(m_animationSeconds, static_cast<float>(i));
+            fish.x = fish.baseX + fishSway.x;
+            fish.y = fish.baseY + fishSway.y;
+        }
+    }
+
+    // Swim cycle (columns 1-3 of the sheet) follows the simulation clock
+    m_fishColumn = 1 + static_cast<int>(m_simTimeMs / m_config.fishFrameMs) % 3;
+}
+
+void GameSimulation::buildSnapshot() {
+    // Draw between the last two simulation steps so motion is smooth at any frame rate
+    const float alpha = m_interpolationAlpha;
+
+    m_snapshot.songTimeMs = m_songTimeMs;
+    m_snapshot.fishColumn = m_fishColumn;
+    m_snapshot.score = m_stats.getScore();
+    m_snapshot.fishCull = m_fishCull;
+
+    // Popups stay where the fish was caught until hitPopupMs has passed
+    m_caughtFish.erase(std::remove_if(m_caughtFish.begin(), m_caughtFish.end(), [this](size_t i) {
+        return m_songTimeMs - m_fish[i].caughtAtMs >= m_config.hitPopupMs;
+    }), m_caughtFish.end());
+
+    m_snapshot.fish.clear();
+    for (size_t i : m_caughtFish) {
+        FishSnapshot view;
+        view.x = m_fishPositions[i].x;
+        view.y = m_fishPositions[i].y;
+        view.noteIndex = static_cast<int>(i);
+        view.variant = m_fish[i].variant;
+        view.view = FishView::HitPopup;
+        view.judgement = m_fish[i].judgement;
+        m_snapshot.fish.push_back(view);
+    }
+    for (size_t i = m_firstFish; i < m_lastFish; ++i) {
+        if (!m_fish[i].active) {
+            continue;
+        }
+        FishSnapshot view;
+        view.x = m_fishPositions[i].lerpX(alpha);
+        view.y = m_fishPositions[i].lerpY(alpha);
+        view.noteIndex = static_cast<int>(i);
+        view.variant = m_fish[i].variant;
+        m_snapshot.fish.push_back(view);
+    }
+
+    const std::pair<Body*, SpriteSnapshot*> bodies[] = {
+        {&m_fisher, &m_snapshot.fisher}, {&m_boat, &m_snapshot.boat}, {&m_hook, &m_snapshot.hook}
+    };
+    for (const auto& body : bodies) {
+        body.second->x = body.first->position.lerpX(alpha);
+        body.second->y = body.first->position.lerpY(alpha);
+        body.second->column = body.first->column;
+    }
+}
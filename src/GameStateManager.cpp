@@ -3,8 +3,10 @@
 #include "ResourceManager.hpp"
 #include "GameConfig.hpp"
 #include "Logger.hpp"
+#include "Profiler.hpp"
 
 #include <iostream>
+#include <cstdio>
 
 GameStateManager::GameStateManager(RenderWindow& window, ResourceManager& resourceManager, InputHandler& inputHandler)
     : currentState(GameState::MainMenu)
@@ -12,7 +14,12 @@ GameStateManager::GameStateManager(RenderWindow& window, ResourceManager& resour
     , window(window)
     , resourceManager(resourceManager)
     , inputHandler(inputHandler)
+    , framePacer(GameConfig::getInstance().getVisualConfig().targetFps)
 {
+    // VSync only replaces the pacer's waiting if the renderer actually accepted it
+    if (GameConfig::getInstance().getVisualConfig().vsync) {
+        framePacer.setVSync(window.setVSync(true));
+    }
 }
 
 void GameStateManager::run()
@@ -59,13 +66,19 @@ void GameStateManager::updateState()
 
 void GameStateManager::runMainMenu()
 {
-    MenuResult result = menuSystem.runMainMenu(window, resourceManager, inputHandler);
+    // The song can decode while the player is in the menu
+    rhythmGame.prepareSong();
+    MenuResult result = menuSystem.runMainMenu(window, resourceManager, inputHandler, framePacer);
+    logFrameStats("Main menu");
     
     switch (result) {
         case MenuResult::StartGame:
             resetGameStats();
             transitionTo(GameState::Playing);
             break;
+        case MenuResult::Calibrate:
+            runCalibration();
+            break;
         case MenuResult::QuitGame:
             transitionTo(GameState::Quit);
             break;
@@ -74,36 +87,83 @@ void GameStateManager::runMainMenu()
     }
 }
 
+void GameStateManager::runCalibration()
+{
+    // A sub-screen of the main menu; returning leaves the state at MainMenu
+    Logger::info("Entering Calibration");
+    MenuResult result = menuSystem.runCalibration(window, resourceManager, inputHandler, framePacer);
+    logFrameStats("Calibration");
+    
+    if (result == MenuResult::QuitGame) {
+        transitionTo(GameState::Quit);
+    }
+}
+
 void GameStateManager::runGameplay()
 {
     // Initialize the rhythm game
     rhythmGame.initialize(window, resourceManager, gameStats);
     bool exitEarly = false;
+    framePacer.reset();
+    
+    // Keys are captured as SDL queues them, with the pacer pumping events while it waits
+    const auto& gameplayConfig = GameConfig::getInstance().getGameplayConfig();
+    const bool sampling = gameplayConfig.inputSampling;
+    if (sampling) {
+        inputSampler.start();
+        framePacer.setIdleTask([this]() { inputSampler.pump(); }, gameplayConfig.inputPumpIntervalMs);
+    }
+    
     // Main gameplay loop
     while (currentState == GameState::Playing && isRunning()) {
+        PROFILE_ZONE("Gameplay frame");
         exitEarly = false;
         
-        // Process all SDL events this frame
-        while (SDL_PollEvent(&event)) {
-            InputAction action = inputHandler.processInput(event, GameState::Playing);
+        {
+            PROFILE_ZONE("Poll events");
+            
+            // Process all SDL events this frame (only window close when the sampler has the keys)
+            while (SDL_PollEvent(&event)) {
+                if (sampling && event.type != SDL_QUIT && !InputHandler::isPerfOverlayToggle(event)) {
+                    continue;
+                }
+                InputEvent input = inputHandler.processEvent(event, GameState::Playing);
+                if (input.action == InputAction::TogglePerfOverlay) {
+                    window.getPerfOverlay().toggle();
+                    continue;
+                }
+                
+                // Process each action immediately instead of only keeping the last one
+                if (input.action != InputAction::None) {
+                    if (!rhythmGame.update(input, inputHandler)) {
+                        // Game ended (music finished or quit)
+                        exitEarly = true;
+                        break;
+                    }
+                }
+            }
             
-            // Process each action immediately instead of only keeping the last one
-            if (action != InputAction::None) {
-                if (!rhythmGame.update(action, inputHandler)) {
-                    // Game ended (music finished or quit)
+            // Sampled keys, oldest first
+            InputRecord record;
+            while (sampling && !exitEarly && inputSampler.poll(record)) {
+                InputEvent input = inputHandler.processGameInput(record);
+                if (input.action != InputAction::None && !rhythmGame.update(input, inputHandler)) {
                     exitEarly = true;
-                    break;
                 }
             }
         }
         
         // Update game logic even when no input events occurred
-        if (!exitEarly && !rhythmGame.update(InputAction::None, inputHandler)) {
+        if (!exitEarly && !rhythmGame.update(InputEvent(), inputHandler)) {
             exitEarly = true;
         }
         
-        // Render the game
+        // Render the game (a VSync present blocks without pumping, so pump right before it)
+        if (framePacer.isVSync()) {
+            framePacer.runIdleTask();
+        }
         rhythmGame.render(window);
+        framePacer.endFrame();
         
         // Check if we should exit the gameplay state
         if (rhythmGame.isGameOver(exitEarly)) {
@@ -111,8 +171,17 @@ void GameStateManager::runGameplay()
         }
     }
     
+    if (sampling) {
+        framePacer.setIdleTask(nullptr);
+        inputSampler.stop();
+        if (inputSampler.getDroppedCount() > 0) {
+            Logger::warning("Input queue overflowed, dropped " + std::to_string(inputSampler.getDroppedCount()) + " key events");
+        }
+    }
+    
     // Clean up rhythm game resources (stop music, etc.)
     rhythmGame.cleanup();
+    logFrameStats("Gameplay");
     
     // Logger::logObject(LogLevel::INFO, gameStats); I need to update the formatting of cout gamestats
     
@@ -121,7 +190,8 @@ void GameStateManager::runGameplay()
 
 void GameStateManager::runEndScreen()
 {
-    MenuResult result = menuSystem.runEndScreen(window, resourceManager, gameStats, inputHandler);
+    MenuResult result = menuSystem.runEndScreen(window, resourceManager, gameStats, inputHandler, framePacer);
+    logFrameStats("End screen");
     
     switch (result) {
         case MenuResult::RetryGame:
@@ -142,4 +212,17 @@ void GameStateManager::runEndScreen()
 void GameStateManager::resetGameStats()
 {
     gameStats.resetStats();
+}
+
+void GameStateManager::logFrameStats(const char* loopName) const
+{
+    FrameTimeStats stats = framePacer.getStats();
+    if (stats.frames == 0) {
+        return;
+    }
+    
+    char buffer[160];
+    snprintf(buffer, sizeof(buffer), "%s frame times over %zu frames: min %.2f ms, avg %.2f ms, p99 %.2f ms, max %.2f ms",
+             loopName, stats.frames, stats.minMs, stats.avgMs, stats.p99Ms, stats.maxMs);
+    Logger::info(buffer);
 }
\ No newline at end of file
@@ -0,0 +1,134 @@
+#include "GlyphAtlas.hpp"
+#include "Logger.hpp"
+
+GlyphAtlas::GlyphAtlas()
+    : m_texture(nullptr), m_pageWidth(0), m_pageHeight(0), m_lineHeight(0) {
+}
+
+bool GlyphAtlas::build(SDL_Renderer* renderer, Font& font, int pageSize) {
+    m_atlas.release();
+    m_texture = nullptr;
+    m_glyphs.fill(Glyph());
+    m_kerning.assign(kGlyphCount * kGlyphCount, 0);
+
+    if (!renderer) {
+        Logger::error("GlyphAtlas::build called with null renderer");
+        return false;
+    }
+
+    m_lineHeight = font.getLineHeight();
+    const SDL_Color white = {255, 255, 255, 255};
+
+    std::vector<std::pair<std::string, SDL_Surface*>> surfaces;
+    surfaces.reserve(kGlyphCount);
+
+    for (int code = kFirstGlyph; code <= kLastGlyph; ++code) {
+        Glyph& glyph = m_glyphs[code - kFirstGlyph];
+        int minX = 0;
+        int advance = 0;
+        if (!font.getGlyphMetrics(static_cast<Uint16>(code), minX, advance)) {
+            continue;
+        }
+        glyph.advance = advance;
+        glyph.offsetX = minX < 0 ? minX : 0; // Rendered bitmaps start at the pen unless the glyph overhangs left
+
+        // Whitespace has an advance but nothing to draw
+        SDL_Surface* surface = font.renderGlyph(static_cast<Uint16>(code), white);
+        if (surface) {
+            surfaces.emplace_back(std::to_string(code), surface);
+        }
+    }
+
+    bool packed = m_atlas.build(renderer, surfaces, pageSize);
+    for (auto& surface : surfaces) {
+        SDL_FreeSurface(surface.second);
+    }
+
+    if (!packed || m_atlas.getPageCount() != 1) {
+        Logger::error("GlyphAtlas failed to pack glyphs into a single page");
+        m_atlas.release();
+        return false;
+    }
+
+    m_texture = m_atlas.getPage(0);
+    SDL_QueryTexture(m_texture, nullptr, nullptr, &m_pageWidth, &m_pageHeight);
+
+    for (int code = kFirstGlyph; code <= kLastGlyph; ++code) {
+        TextureRegion region = m_atlas.find(std::to_string(code));
+        if (region.isValid()) {
+            m_glyphs[code - kFirstGlyph].src = region.rect;
+        }
+    }
+
+    for (int previous = kFirstGlyph; previous <= kLastGlyph; ++previous) {
+        for (int current = kFirstGlyph; current <= kLastGlyph; ++current) {
+            m_kerning[(previous - kFirstGlyph) * kGlyphCount + (current - kFirstGlyph)] =
+                font.getKerning(static_cast<Uint16>(previous), static_cast<Uint16>(current));
+        }
+    }
+
+    return true;
+}
+
+int GlyphAtlas::kerning(char previous, char current) const {
+    if (!isSupported(previous) || !isSupported(current) || m_kerning.empty()) {
+        return 0;
+    }
+    return m_kerning[(previous - kFirstGlyph) * kGlyphCount + (current - kFirstGlyph)];
+}
+
+int GlyphAtlas::measureText(const std::string& text) const {
+    int width = 0;
+    char previous = 0;
+    for (char ch : text) {
+        if (!isSupported(ch)) continue;
+        width += kerning(previous, ch) + m_glyphs[ch - kFirstGlyph].advance;
+        previous = ch;
+    }
+    return width;
+}
+
+void GlyphAtlas::appendQuads(const std::string& text, float x, float y, SDL_Color color,
+                             std::vector<SDL_Vertex>& vertices, std::vector<int>& indices) const {
+    if (!isValid()) {
+        return;
+    }
+
+    const float invWidth = 1.0f / m_pageWidth;
+    const float invHeight = 1.0f / m_pageHeight;
+    float penX = x;
+    char previous = 0;
+
+    for (char ch : text) {
+        if (!isSupported(ch)) continue;
+
+        const Glyph& glyph = m_glyphs[ch - kFirstGlyph];
+        penX += kerning(previous, ch);
+        previous = ch;
+
+        if (glyph.src.w > 0 && glyph.src.h > 0) {
+            float left = penX + glyph.offsetX;
+            float right = left + glyph.src.w;
+            float bottom = y + glyph.src.h;
+            float u0 = glyph.src.x * invWidth;
+            float v0 = glyph.src.y * invHeight;
+            float u1 = (glyph.src.x + glyph.src.w) * invWidth;
+            float v1 = (glyph.src.y + glyph.src.h) * invHeight;
+
+            int base = static_cast<int>(vertices.size());
+            vertices.push_back({{left, y}, color, {u0, v0}});
+            vertices.push_back({{right, y}, color, {u1, v0}});
+            vertices.push_back({{right, bottom}, color, {u1, v1}});
+            vertices.push_back({{left, bottom}, color, {u0, v1}});
+
+            indices.push_back(base);
+            indices.push_back(base + 1);
+            indices.push_back(base + 2);
+            indices.push_back(base);
+            indices.push_back(base + 2);
+            indices.push_back(base + 3);
+        }
+
+        penX += glyph.advance;
+    }
+}
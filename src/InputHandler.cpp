@@ -1,4 +1,5 @@
 #include "InputHandler.hpp"
+#include "SongClock.hpp"
 
 InputHandler::InputHandler()
     : spaceKeyDown(false)
@@ -12,6 +13,9 @@ InputAction InputHandler::processInput(SDL_Event& event, GameState currentState)
     if (event.type == SDL_QUIT) {
         return InputAction::Quit;
     }
+    if (isPerfOverlayToggle(event)) {
+        return InputAction::TogglePerfOverlay;
+    }
     
     // Delegate to appropriate state handler
     switch (currentState) {
@@ -26,6 +30,30 @@ InputAction InputHandler::processInput(SDL_Event& event, GameState currentState)
     }
 }
 
+InputEvent InputHandler::processEvent(SDL_Event& event, GameState currentState)
+{
+    InputEvent input;
+    input.action = processInput(event, currentState);
+    if (input.action != InputAction::None) {
+        input.timestampMs = eventTimeMs(event);
+    }
+    return input;
+}
+
+bool InputHandler::isPerfOverlayToggle(const SDL_Event& event)
+{
+    return event.type == SDL_KEYDOWN && event.key.keysym.sym == SDLK_F3 && !event.key.repeat;
+}
+
+double InputHandler::eventTimeMs(const SDL_Event& event)
+{
+    // SDL stamps events with SDL_GetTicks(); carry the event's age over to the performance counter
+    double nowMs = SongClock::hostTimeMs();
+    Uint32 ticks = SDL_GetTicks();
+    Uint32 ageMs = SDL_TICKS_PASSED(ticks, event.common.timestamp) ? ticks - event.common.timestamp : 0;
+    return nowMs - ageMs;
+}
+
 bool InputHandler::isKeyPressed(SDL_Scancode key) const
 {
     return keyboardState[key] != 0;
@@ -80,6 +108,27 @@ InputAction InputHandler::processGameInput(const SDL_Event& event)
     return InputAction::None;
 }
 
+InputEvent InputHandler::processGameInput(const InputRecord& record)
+{
+    InputEvent input;
+    if (record.action == InputAction::Select) {
+        // Same held-key rule as processGameInput(SDL_Event)
+        if (record.pressed && !spaceKeyDown) {
+            spaceKeyDown = true;
+            input.action = InputAction::Select;
+        } else if (!record.pressed) {
+            spaceKeyDown = false;
+        }
+    } else if (record.pressed) {
+        input.action = record.action;
+    }
+    
+    if (input.action != InputAction::None) {
+        input.timestampMs = record.timestampMs;
+    }
+    return input;
+}
+
 InputAction InputHandler::processEndScreenInput(const SDL_Event& event)
 {
     if (event.type == SDL_KEYDOWN) {
@@ -0,0 +1,73 @@
+#include "InputSampler.hpp"
+#include "SongClock.hpp"
+
+InputSampler::InputSampler()
+    : m_dropped(0), m_running(false) {
+}
+
+InputSampler::~InputSampler() {
+    stop();
+}
+
+void InputSampler::start() {
+    if (m_running) {
+        return;
+    }
+    m_queue.clear();
+    m_dropped.store(0, std::memory_order_relaxed);
+    SDL_AddEventWatch(&InputSampler::eventWatch, this);
+    m_running = true;
+}
+
+void InputSampler::stop() {
+    if (!m_running) {
+        return;
+    }
+    SDL_DelEventWatch(&InputSampler::eventWatch, this);
+    m_running = false;
+}
+
+void InputSampler::pump() {
+    SDL_PumpEvents();
+}
+
+bool InputSampler::poll(InputRecord& record) {
+    return m_queue.pop(record);
+}
+
+bool InputSampler::translate(const SDL_Event& event, double timestampMs, InputRecord& record) {
+    if (event.type != SDL_KEYDOWN && event.type != SDL_KEYUP) {
+        return false;
+    }
+    if (event.key.repeat) {
+        return false;
+    }
+
+    switch (event.key.keysym.sym) {
+        case SDLK_SPACE:
+            record.action = InputAction::Select;
+            record.lane = 0;
+            break;
+        case SDLK_ESCAPE:
+            record.action = InputAction::Quit;
+            record.lane = 0;
+            break;
+        default:
+            return false;
+    }
+    record.pressed = event.type == SDL_KEYDOWN;
+    record.timestampMs = timestampMs;
+    return true;
+}
+
+int SDLCALL InputSampler::eventWatch(void* userdata, SDL_Event* event) {
+    // Called from inside SDL_PumpEvents as each event is queued - keep this short
+    InputRecord record;
+    if (translate(*event, SongClock::hostTimeMs(), record)) {
+        InputSampler* sampler = static_cast<InputSampler*>(userdata);
+        if (!sampler->m_queue.push(record)) {
+            sampler->m_dropped.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+    return 0; // Return value is ignored for watches
+}
@@ -0,0 +1,91 @@
+#include "JudgementEngine.hpp"
+#include "Logger.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+JudgementEngine::JudgementEngine(double perfectWindowMs, double goodWindowMs)
+    : m_cursor(0), m_perfectWindowMs(perfectWindowMs), m_goodWindowMs(goodWindowMs) {
+}
+
+bool JudgementEngine::load(const std::vector<double>& noteTimesMs) {
+    if (!std::is_sorted(noteTimesMs.begin(), noteTimesMs.end())) {
+        Logger::error("JudgementEngine::load called with unsorted note times");
+        m_noteTimes.clear();
+        m_resolved.clear();
+        m_cursor = 0;
+        return false;
+    }
+
+    m_noteTimes = noteTimesMs;
+    reset();
+    return true;
+}
+
+void JudgementEngine::reset() {
+    m_resolved.assign(m_noteTimes.size(), 0);
+    m_cursor = 0;
+}
+
+void JudgementEngine::seek(double timeMs) {
+    auto first = std::lower_bound(m_noteTimes.begin(), m_noteTimes.end(), timeMs - m_goodWindowMs);
+    m_cursor = static_cast<size_t>(first - m_noteTimes.begin());
+    std::fill(m_resolved.begin(), m_resolved.begin() + m_cursor, 1);
+    std::fill(m_resolved.begin() + m_cursor, m_resolved.end(), 0);
+}
+
+JudgementResult JudgementEngine::judgeHit(double timeMs) {
+    JudgementResult result;
+
+    // Notes before the window may still be waiting for resolveMisses(); skip them with a binary search
+    auto first = std::lower_bound(m_noteTimes.begin() + m_cursor, m_noteTimes.end(), timeMs - m_goodWindowMs);
+    for (size_t i = static_cast<size_t>(first - m_noteTimes.begin()); i < m_noteTimes.size(); ++i) {
+        double delta = timeMs - m_noteTimes[i];
+        if (delta < -m_goodWindowMs) {
+            break; // Past the window - every later note is later still
+        }
+        if (m_resolved[i]) {
+            continue;
+        }
+
+        m_resolved[i] = 1;
+        result.noteIndex = static_cast<int>(i);
+        result.deltaMs = delta;
+        result.judgement = std::fabs(delta) <= m_perfectWindowMs ? Judgement::Perfect : Judgement::Good;
+        advanceCursor();
+        break;
+    }
+
+    return result;
+}
+
+int JudgementEngine::resolveMisses(double timeMs, std::vector<int>* missedNotes) {
+    int misses = 0;
+    while (m_cursor < m_noteTimes.size()) {
+        if (!m_resolved[m_cursor]) {
+            if (timeMs <= m_noteTimes[m_cursor] + m_goodWindowMs) {
+                break; // Earliest unresolved note can still be hit
+            }
+            m_resolved[m_cursor] = 1;
+            ++misses;
+            if (missedNotes) {
+                missedNotes->push_back(static_cast<int>(m_cursor));
+            }
+        }
+        ++m_cursor;
+    }
+    return misses;
+}
+
+bool JudgementEngine::isResolved(int noteIndex) const {
+    if (noteIndex < 0 || noteIndex >= static_cast<int>(m_resolved.size())) {
+        return false;
+    }
+    return m_resolved[noteIndex] != 0;
+}
+
+void JudgementEngine::advanceCursor() {
+    while (m_cursor < m_resolved.size() && m_resolved[m_cursor]) {
+        ++m_cursor;
+    }
+}
@@ -0,0 +1,22 @@
+// SDL error helpers, kept apart from Logger.cpp so meowstro_core can log without linking SDL
+#include "Logger.hpp"
+#include <SDL.h>
+#include <SDL_image.h>
+#include <SDL_ttf.h>
+#include <SDL_mixer.h>
+
+void Logger::logSDLError(LogLevel level, const std::string& context) {
+    log(level, context + ": " + std::string(SDL_GetError()));
+}
+
+void Logger::logSDLImageError(LogLevel level, const std::string& context) {
+    log(level, context + ": " + std::string(IMG_GetError()));
+}
+
+void Logger::logSDLTTFError(LogLevel level, const std::string& context) {
+    log(level, context + ": " + std::string(TTF_GetError()));
+}
+
+void Logger::logSDLMixerError(LogLevel level, const std::string& context) {
+    log(level, context + ": " + std::string(Mix_GetError()));
+}
@@ -1,18 +1,26 @@
 #include "MenuSystem.hpp"
 #include "GameConfig.hpp"
+#include "Calibration.hpp"
+#include "SongClock.hpp"
+#include "Audio.hpp"
+#include "Logger.hpp"
+#include "Profiler.hpp"
 
 #include <iostream>
 #include <sstream>
 #include <iomanip>
+#include <cmath>
+#include <cstdio>
 
 MenuSystem::MenuSystem() 
     : currentMenuType(MenuType::MainMenu)
     , currentOption(0)
     , menuActive(false)
+    , firstFrameLogged(false)
 {
 }
 
-MenuResult MenuSystem::runMainMenu(RenderWindow& window, ResourceManager& resourceManager, InputHandler& inputHandler) {
+MenuResult MenuSystem::runMainMenu(RenderWindow& window, ResourceManager& resourceManager, InputHandler& inputHandler, FramePacer& framePacer) {
     resetMenuState(MenuType::MainMenu);
     
     const auto& config = GameConfig::getInstance();
@@ -20,23 +28,38 @@ MenuResult MenuSystem::runMainMenu(RenderWindow& window, ResourceManager& resour
     const auto& fontSizes = config.getFontSizes();
     const auto& visualConfig = config.getVisualConfig();
     
-    // Create menu textures
-    SDL_Texture* quitTexture = resourceManager.createTextTexture(assetPaths.fontPath, fontSizes.quitButton, "QUIT", visualConfig.YELLOW);
-    SDL_Texture* startTexture = resourceManager.createTextTexture(assetPaths.fontPath, fontSizes.menuButtons, "START", visualConfig.YELLOW);
-    SDL_Texture* logoTexture = resourceManager.createTextTexture(assetPaths.fontPath, fontSizes.menuLogo, "MEOWSTRO", visualConfig.YELLOW);
-    SDL_Texture* logoCatTexture = resourceManager.loadTexture(assetPaths.menuCatTexture);
-    SDL_Texture* selectedTexture = resourceManager.loadTexture(assetPaths.selectCatTexture);
+    // Create menu textures - fonts and text are interned once, entities keep the handles
+    FontHandle quitFont = resourceManager.acquireFont(assetPaths.fontPath, fontSizes.quitButton);
+    FontHandle buttonFont = resourceManager.acquireFont(assetPaths.fontPath, fontSizes.menuButtons);
+    FontHandle logoFont = resourceManager.acquireFont(assetPaths.fontPath, fontSizes.menuLogo);
+    TextureRegion quitTexture = resourceManager.getRegion(resourceManager.acquireTextTexture(quitFont, "QUIT", visualConfig.YELLOW));
+    TextureRegion startTexture = resourceManager.getRegion(resourceManager.acquireTextTexture(buttonFont, "START", visualConfig.YELLOW));
+    TextureRegion calibrateTexture = resourceManager.getRegion(resourceManager.acquireTextTexture(buttonFont, "CALIBRATE", visualConfig.YELLOW));
+    TextureRegion logoTexture = resourceManager.getRegion(resourceManager.acquireTextTexture(logoFont, "MEOWSTRO", visualConfig.YELLOW));
+    TextureRegion logoCatTexture = resourceManager.getTextureRegion(assetPaths.menuCatTexture);
+    TextureRegion selectedTexture = resourceManager.getTextureRegion(assetPaths.selectCatTexture);
+    
+    // Keep this menu's textures out of cache eviction while it is shown
+    ScopedTexturePins pins(resourceManager, { quitTexture.handle, startTexture.handle, calibrateTexture.handle,
+                                              logoTexture.handle, logoCatTexture.handle, selectedTexture.handle });
     
     // Create menu entities
     Entity quit(850, 800, quitTexture);
     Entity logo(715, 350, logoTexture);
     Entity start(850, 625, startTexture);
+    Entity calibrate(850, 712, calibrateTexture);
     Entity logoCat(660, 200, logoCatTexture);
     Sprite selectCat(760, 500, selectedTexture, 1, 1);
     
+    // Gameplay images keep decoding in the background; show progress while they do
+    GlyphAtlas* loadingGlyphs = resourceManager.getGlyphAtlas(assetPaths.fontPath, fontSizes.gameScore);
+    const double uploadBudgetMs = config.getResourceConfig().uploadBudgetMs;
+    
     SDL_Event event;
+    framePacer.reset();
     
     while (menuActive) {
+        PROFILE_ZONE("Main menu frame");
         while (SDL_PollEvent(&event)) {
             InputAction action = inputHandler.processInput(event, GameState::MainMenu);
             
@@ -45,16 +68,22 @@ MenuResult MenuSystem::runMainMenu(RenderWindow& window, ResourceManager& resour
                     return MenuResult::QuitGame;
                     
                 case InputAction::Select:
-                    // currentOption: 0 = start, 1 = quit
+                    // currentOption: 0 = start, 1 = calibrate, 2 = quit
                     if (currentOption == 0) {
                         return MenuResult::StartGame;
+                    } else if (currentOption == 1) {
+                        return MenuResult::Calibrate;
                     } else {
                         return MenuResult::QuitGame;
                     }
                     
                 case InputAction::MenuUp:
                 case InputAction::MenuDown:
-                    handleMenuNavigation(action, 2); // 2 options: start/quit
+                    handleMenuNavigation(action, 3); // 3 options: start/calibrate/quit
+                    break;
+                    
+                case InputAction::TogglePerfOverlay:
+                    window.getPerfOverlay().toggle();
                     break;
                     
                 case InputAction::None:
@@ -72,14 +101,29 @@ MenuResult MenuSystem::runMainMenu(RenderWindow& window, ResourceManager& resour
         window.render(logoCat);
         window.render(logo);
         window.render(start);
+        window.render(calibrate);
         window.render(quit);
+        if (loadingGlyphs && resourceManager.hasPendingAsyncLoads()) {
+            int percent = static_cast<int>(resourceManager.getAsyncLoadProgress() * 100.0f);
+            window.renderText(*loadingGlyphs, "LOADING " + std::to_string(percent) + "%", 40, 1000, visualConfig.YELLOW);
+        }
         window.display();
+        
+        if (!firstFrameLogged) {
+            // SDL_GetTicks counts from SDL_Init, so this covers window creation and all startup loading
+            Logger::info("Cold start: first menu frame after " + std::to_string(SDL_GetTicks()) + " ms (" +
+                         (resourceManager.hasAssetPack() ? "asset pack" : "loose files") + ")");
+            firstFrameLogged = true;
+        }
+        
+        resourceManager.pumpAsyncUploads(uploadBudgetMs);
+        framePacer.endFrame();
     }
     
     return MenuResult::None;
 }
 
-MenuResult MenuSystem::runEndScreen(RenderWindow& window, ResourceManager& resourceManager, GameStats& stats, InputHandler& inputHandler) {
+MenuResult MenuSystem::runEndScreen(RenderWindow& window, ResourceManager& resourceManager, GameStats& stats, InputHandler& inputHandler, FramePacer& framePacer) {
     resetMenuState(MenuType::EndScreen);
     
     const auto& config = GameConfig::getInstance();
@@ -87,34 +131,43 @@ MenuResult MenuSystem::runEndScreen(RenderWindow& window, ResourceManager& resou
     const auto& fontSizes = config.getFontSizes();
     const auto& visualConfig = config.getVisualConfig();
     
-    // Create stats textures
-    SDL_Texture* statsTexture = resourceManager.createTextTexture(assetPaths.fontPath, fontSizes.gameStats, "GAME STATS", visualConfig.YELLOW);
-    SDL_Texture* scoreTexture = resourceManager.createTextTexture(assetPaths.fontPath, fontSizes.gameScore, "SCORE", visualConfig.YELLOW);
-    SDL_Texture* numberTexture = resourceManager.createTextTexture(assetPaths.fontPath, fontSizes.gameScore, formatScore(stats.getScore()), visualConfig.YELLOW);
-    SDL_Texture* hitsTexture = resourceManager.createTextTexture(assetPaths.fontPath, fontSizes.gameScore, "HITS", visualConfig.YELLOW);
-    SDL_Texture* numHitsTexture = resourceManager.createTextTexture(assetPaths.fontPath, fontSizes.gameScore, std::to_string(stats.getHits()), visualConfig.YELLOW);
-    SDL_Texture* accuracyTexture = resourceManager.createTextTexture(assetPaths.fontPath, fontSizes.gameScore, "ACCURACY", visualConfig.YELLOW);
-    SDL_Texture* accPercentTexture = resourceManager.createTextTexture(assetPaths.fontPath, fontSizes.gameScore, (std::to_string(stats.getAccuracy()) + "%"), visualConfig.YELLOW);
-    SDL_Texture* missTexture = resourceManager.createTextTexture(assetPaths.fontPath, fontSizes.gameScore, "MISSES", visualConfig.YELLOW);
-    SDL_Texture* numMissTexture = resourceManager.createTextTexture(assetPaths.fontPath, fontSizes.gameScore, std::to_string(stats.getMisses()), visualConfig.YELLOW);
+    // Create stats textures - one font lookup per size, then indexed handles
+    FontHandle statsFont = resourceManager.acquireFont(assetPaths.fontPath, fontSizes.gameStats);
+    FontHandle scoreFont = resourceManager.acquireFont(assetPaths.fontPath, fontSizes.gameScore);
+    TextureRegion statsTexture = resourceManager.getRegion(resourceManager.acquireTextTexture(statsFont, "GAME STATS", visualConfig.YELLOW));
+    TextureRegion scoreTexture = resourceManager.getRegion(resourceManager.acquireTextTexture(scoreFont, "SCORE", visualConfig.YELLOW));
+    TextureRegion hitsTexture = resourceManager.getRegion(resourceManager.acquireTextTexture(scoreFont, "HITS", visualConfig.YELLOW));
+    TextureRegion accuracyTexture = resourceManager.getRegion(resourceManager.acquireTextTexture(scoreFont, "ACCURACY", visualConfig.YELLOW));
+    TextureRegion missTexture = resourceManager.getRegion(resourceManager.acquireTextTexture(scoreFont, "MISSES", visualConfig.YELLOW));
+    
+    // Per-game numbers are drawn from the glyph atlas instead of creating a texture per value
+    GlyphAtlas* statGlyphs = resourceManager.getGlyphAtlas(assetPaths.fontPath, fontSizes.gameScore);
+    const std::string numberText = formatScore(stats.getScore());
+    const std::string numHitsText = std::to_string(stats.getHits());
+    const std::string accPercentText = std::to_string(stats.getAccuracy()) + "%";
+    const std::string numMissText = std::to_string(stats.getMisses());
     
     // Create menu textures
-    SDL_Texture* quitTexture = resourceManager.createTextTexture(assetPaths.fontPath, fontSizes.quitButton, "QUIT", visualConfig.YELLOW);
-    SDL_Texture* retryTexture = resourceManager.createTextTexture(assetPaths.fontPath, fontSizes.quitButton, "RETRY", visualConfig.YELLOW);
-    SDL_Texture* logoTexture = resourceManager.createTextTexture(assetPaths.fontPath, fontSizes.menuLogo, "MEOWSTRO", visualConfig.YELLOW);
-    SDL_Texture* selectedTexture = resourceManager.loadTexture(assetPaths.selectCatTexture);
-    SDL_Texture* logoCatTexture = resourceManager.loadTexture(assetPaths.menuCatTexture);
+    FontHandle quitFont = resourceManager.acquireFont(assetPaths.fontPath, fontSizes.quitButton);
+    FontHandle logoFont = resourceManager.acquireFont(assetPaths.fontPath, fontSizes.menuLogo);
+    TextureRegion quitTexture = resourceManager.getRegion(resourceManager.acquireTextTexture(quitFont, "QUIT", visualConfig.YELLOW));
+    TextureRegion retryTexture = resourceManager.getRegion(resourceManager.acquireTextTexture(quitFont, "RETRY", visualConfig.YELLOW));
+    TextureRegion logoTexture = resourceManager.getRegion(resourceManager.acquireTextTexture(logoFont, "MEOWSTRO", visualConfig.YELLOW));
+    TextureRegion selectedTexture = resourceManager.getTextureRegion(assetPaths.selectCatTexture);
+    TextureRegion logoCatTexture = resourceManager.getTextureRegion(assetPaths.menuCatTexture);
+    
+    // Keep this screen's textures out of cache eviction while it is shown
+    ScopedTexturePins pins(resourceManager, { statsTexture.handle, scoreTexture.handle, hitsTexture.handle,
+                                              accuracyTexture.handle, missTexture.handle, quitTexture.handle,
+                                              retryTexture.handle, logoTexture.handle, selectedTexture.handle,
+                                              logoCatTexture.handle });
     
     // Create entities
     Entity titleStats(785, 325, statsTexture);
     Entity score(650, 400, scoreTexture);
-    Entity number(1150, 400, numberTexture);
     Entity hits(650, 500, hitsTexture);
-    Entity numHits(1150, 500, numHitsTexture);
     Entity accuracy(650, 600, accuracyTexture);
-    Entity accPercent(1150, 600, accPercentTexture);
     Entity misses(650, 700, missTexture);
-    Entity numMisses(1150, 700, numMissTexture);
     
     Entity quit(875, 900, quitTexture);
     Entity logo(735, 150, logoTexture);
@@ -123,8 +176,10 @@ MenuResult MenuSystem::runEndScreen(RenderWindow& window, ResourceManager& resou
     Sprite selectCat(775, 700, selectedTexture, 1, 1);
     
     SDL_Event event;
+    framePacer.reset();
     
     while (menuActive) {
+        PROFILE_ZONE("End screen frame");
         while (SDL_PollEvent(&event)) {
             InputAction action = inputHandler.processInput(event, GameState::EndScreen);
             
@@ -145,6 +200,10 @@ MenuResult MenuSystem::runEndScreen(RenderWindow& window, ResourceManager& resou
                     handleMenuNavigation(action, 2); // 2 options: retry/quit
                     break;
                     
+                case InputAction::TogglePerfOverlay:
+                    window.getPerfOverlay().toggle();
+                    break;
+                    
                 case InputAction::None:
                 default:
                     break;
@@ -163,19 +222,186 @@ MenuResult MenuSystem::runEndScreen(RenderWindow& window, ResourceManager& resou
         window.render(quit);
         window.render(titleStats);
         window.render(score);
-        window.render(number);
         window.render(hits);
-        window.render(numHits);
         window.render(accuracy);
-        window.render(accPercent);
         window.render(misses);
-        window.render(numMisses);
+        if (statGlyphs) {
+            window.renderText(*statGlyphs, numberText, 1150, 400, visualConfig.YELLOW);
+            window.renderText(*statGlyphs, numHitsText, 1150, 500, visualConfig.YELLOW);
+            window.renderText(*statGlyphs, accPercentText, 1150, 600, visualConfig.YELLOW);
+            window.renderText(*statGlyphs, numMissText, 1150, 700, visualConfig.YELLOW);
+        }
         window.display();
+        framePacer.endFrame();
     }
     
     return MenuResult::None;
 }
 
+MenuResult MenuSystem::runCalibration(RenderWindow& window, ResourceManager& resourceManager, InputHandler& inputHandler, FramePacer& framePacer) {
+    resetMenuState(MenuType::Calibration);
+    
+    auto& config = GameConfig::getInstance();
+    const auto& assetPaths = config.getAssetPaths();
+    const auto& fontSizes = config.getFontSizes();
+    const auto& visualConfig = config.getVisualConfig();
+    const auto& calibrationConfig = config.getCalibrationConfig();
+    
+    FontHandle logoFont = resourceManager.acquireFont(assetPaths.fontPath, fontSizes.menuLogo);
+    TextureRegion titleTexture = resourceManager.getRegion(resourceManager.acquireTextTexture(logoFont, "CALIBRATION", visualConfig.YELLOW));
+    TextureRegion logoCatTexture = resourceManager.getTextureRegion(assetPaths.menuCatTexture);
+    ScopedTexturePins pins(resourceManager, { titleTexture.handle, logoCatTexture.handle });
+    
+    Entity title(680, 350, titleTexture);
+    Entity logoCat(660, 200, logoCatTexture);
+    
+    // Instructions and results change during the run, so they come from the glyph atlas
+    GlyphAtlas* glyphs = resourceManager.getGlyphAtlas(assetPaths.fontPath, fontSizes.gameScore);
+    
+    // SDL_mixer reference-counts Mix_OpenAudio, so this shares the device gameplay already opened
+    Audio clickAudio;
+    if (!clickAudio.isValid()) {
+        Logger::error("Calibration needs audio output");
+        return MenuResult::GoToMainMenu;
+    }
+    
+    Calibration calibration(static_cast<size_t>(calibrationConfig.leadInClicks),
+                            static_cast<size_t>(calibrationConfig.minTaps), calibrationConfig.outlierMads);
+    const double clickIntervalMs = 60000.0 / calibrationConfig.clickBpm;
+    int clicksPlayed = 0;
+    double nextClickMs = 0.0;
+    bool running = false;
+    std::string resultText;
+    std::string detailText;
+    
+    auto startRun = [&]() {
+        calibration.reset();
+        clicksPlayed = 0;
+        nextClickMs = SongClock::hostTimeMs() + clickIntervalMs; // One beat of silence first
+        running = true;
+    };
+    
+    auto tickMetronome = [&]() {
+        if (!running || clicksPlayed >= calibrationConfig.clickCount) {
+            return;
+        }
+        double nowMs = SongClock::hostTimeMs();
+        if (nowMs < nextClickMs) {
+            return;
+        }
+        // The click is heard one output latency after it is handed to the mixer. SongClock already
+        // corrects song time for that, so only the remaining (input) latency goes into the offset.
+        clickAudio.playClick();
+        calibration.addClick(nowMs + clickAudio.getOutputLatencyMs());
+        ++clicksPlayed;
+        nextClickMs += clickIntervalMs;
+    };
+    
+    auto finishRun = [&]() {
+        running = false;
+        CalibrationResult result = calibration.compute();
+        char buffer[96];
+        if (result.valid && std::fabs(result.offsetMs) <= calibrationConfig.maxOffsetMs) {
+            config.setInputOffsetMs(result.offsetMs);
+            bool saved = config.saveSettings();
+            snprintf(buffer, sizeof(buffer), "OFFSET %+.1f MS   JITTER %.1f MS", result.offsetMs, result.jitterMs);
+            resultText = buffer;
+            snprintf(buffer, sizeof(buffer), "%zu TAPS, %zu IGNORED - %s", result.taps, result.rejected, saved ? "SAVED" : "NOT SAVED");
+            detailText = buffer;
+        } else {
+            resultText = "NOT ENOUGH STEADY TAPS";
+            snprintf(buffer, sizeof(buffer), "%zu TAPS, %zu IGNORED - OFFSET UNCHANGED", result.taps, result.rejected);
+            detailText = buffer;
+        }
+        
+        snprintf(buffer, sizeof(buffer), "Calibration: offset %.2f ms, jitter %.2f ms, %zu taps, %zu rejected%s",
+                 result.offsetMs, result.jitterMs, result.taps, result.rejected, result.valid ? "" : " (not applied)");
+        Logger::info(buffer);
+    };
+    
+    // Clicks and key events are serviced every millisecond while the pacer waits, not once per frame:
+    // pumping lets SDL stamp each tap when it happens, and clicks go out on the beat
+    framePacer.reset();
+    framePacer.setIdleTask([&]() {
+        SDL_PumpEvents();
+        tickMetronome();
+    });
+    startRun();
+    
+    MenuResult menuResult = MenuResult::None;
+    SDL_Event event;
+    
+    while (menuActive) {
+        PROFILE_ZONE("Calibration frame");
+        tickMetronome();
+        
+        while (SDL_PollEvent(&event)) {
+            if (event.type == SDL_QUIT) {
+                menuResult = MenuResult::QuitGame;
+                menuActive = false;
+                break;
+            }
+            if (event.type == SDL_KEYDOWN && event.key.repeat) {
+                continue; // A held key is not a tap
+            }
+            
+            InputEvent input = inputHandler.processEvent(event, GameState::MainMenu);
+            if (input.action == InputAction::TogglePerfOverlay) {
+                window.getPerfOverlay().toggle();
+                continue;
+            }
+            if (input.action == InputAction::Quit) {
+                menuResult = MenuResult::GoToMainMenu;
+                menuActive = false;
+                break;
+            }
+            if (input.action == InputAction::Select) {
+                if (running) {
+                    calibration.addTap(input.timestampMs);
+                } else {
+                    startRun();
+                }
+            }
+        }
+        
+        // Finish one interval after the last click so a late final tap still counts
+        if (running && clicksPlayed >= calibrationConfig.clickCount && SongClock::hostTimeMs() >= nextClickMs) {
+            finishRun();
+        }
+        
+        window.clear();
+        window.render(logoCat);
+        window.render(title);
+        if (glyphs) {
+            char buffer[64];
+            if (running) {
+                window.renderText(*glyphs, "TAP SPACE ON EACH CLICK", 640, 480, visualConfig.YELLOW);
+                if (clicksPlayed < calibrationConfig.leadInClicks) {
+                    window.renderText(*glyphs, "GET READY...", 640, 560, visualConfig.YELLOW);
+                } else {
+                    snprintf(buffer, sizeof(buffer), "CLICK %d / %d", clicksPlayed - calibrationConfig.leadInClicks,
+                             calibrationConfig.clickCount - calibrationConfig.leadInClicks);
+                    window.renderText(*glyphs, buffer, 640, 560, visualConfig.YELLOW);
+                }
+            } else {
+                window.renderText(*glyphs, resultText, 640, 480, visualConfig.YELLOW);
+                window.renderText(*glyphs, detailText, 640, 560, visualConfig.YELLOW);
+                window.renderText(*glyphs, "SPACE: AGAIN   ESC: BACK", 640, 800, visualConfig.YELLOW);
+            }
+            snprintf(buffer, sizeof(buffer), "CURRENT OFFSET %+.1f MS", config.getAudioConfig().inputOffsetMs);
+            window.renderText(*glyphs, buffer, 640, 680, visualConfig.YELLOW);
+        }
+        if (framePacer.isVSync()) {
+            framePacer.runIdleTask();
+        }
+        window.display();
+        framePacer.endFrame();
+    }
+    
+    framePacer.setIdleTask(nullptr);
+    return menuResult;
+}
+
 // Future menu implementations
 MenuResult MenuSystem::runPauseMenu(RenderWindow& window, ResourceManager& resourceManager, InputHandler& inputHandler) {
     // TODO: Implement pause menu for future expansion
@@ -211,6 +437,8 @@ void MenuSystem::updateSelectorPosition(Sprite& selector, MenuType menuType) {
         case MenuType::MainMenu:
             if (currentOption == 0) {
                 selector.setLoc(760, 600); // Start position
+            } else if (currentOption == 1) {
+                selector.setLoc(760, 687); // Calibrate position
             } else {
                 selector.setLoc(760, 775); // Quit position
             }
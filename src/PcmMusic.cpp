@@ -0,0 +1,170 @@
+#include "PcmMusic.hpp"
+#include "SongClock.hpp"
+#include "Logger.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+PcmMusic::PcmMusic()
+    : m_decodeDone(false)
+    , m_chunk(nullptr)
+    , m_frequency(0)
+    , m_format(0)
+    , m_channels(0)
+    , m_cursorSequence(0)
+    , m_cursorBytes(0)
+    , m_cursorHostMs(0.0)
+    , m_playing(false)
+    , m_frameBytes(0)
+    , m_hooked(false) {
+}
+
+PcmMusic::~PcmMusic() {
+    release();
+}
+
+void PcmMusic::startDecode(const std::string& filePath) {
+    if (filePath == m_path && (m_worker.joinable() || m_chunk)) {
+        return;
+    }
+
+    release();
+    m_path = filePath;
+    m_decodeDone.store(false, std::memory_order_relaxed);
+    m_worker = std::thread(&PcmMusic::decode, this, filePath);
+}
+
+bool PcmMusic::waitForDecode() {
+    if (m_worker.joinable()) {
+        m_worker.join();
+    }
+    return m_chunk != nullptr;
+}
+
+void PcmMusic::decode(std::string filePath) {
+    // Worker thread: Mix_LoadWAV decodes the whole file and converts it to the device format
+    const double startMs = SongClock::hostTimeMs();
+    Mix_Chunk* chunk = nullptr;
+    if (Mix_QuerySpec(&m_frequency, &m_format, &m_channels) == 0) {
+        Logger::error("PcmMusic: audio device is not open, cannot decode " + filePath);
+    } else {
+        chunk = Mix_LoadWAV(filePath.c_str());
+        if (!chunk) {
+            Logger::logSDLMixerError(LogLevel::ERROR, "Failed to decode music file: " + filePath);
+        }
+    }
+
+    if (chunk) {
+        const size_t frameBytes = static_cast<size_t>(SDL_AUDIO_BITSIZE(m_format) / 8) * m_channels;
+        m_stats.decodeMs = SongClock::hostTimeMs() - startMs;
+        m_stats.bytes = chunk->alen;
+        m_stats.durationMs = static_cast<double>(chunk->alen / frameBytes) * 1000.0 / m_frequency;
+
+        char buffer[256];
+        snprintf(buffer, sizeof(buffer), "Decoded %s to PCM in %.1f ms: %.1f MB for %.1f s of audio",
+                 filePath.c_str(), m_stats.decodeMs, m_stats.bytes / (1024.0 * 1024.0), m_stats.durationMs / 1000.0);
+        Logger::info(buffer);
+    }
+
+    m_chunk = chunk;
+    m_decodeDone.store(true, std::memory_order_release);
+}
+
+bool PcmMusic::play() {
+    if (!waitForDecode()) {
+        return false;
+    }
+
+    int frequency = 0;
+    Uint16 format = 0;
+    int channels = 0;
+    if (Mix_QuerySpec(&frequency, &format, &channels) == 0 ||
+        frequency != m_frequency || format != m_format || channels != m_channels) {
+        Logger::warning("Decoded music does not match the audio device format: " + m_path);
+        return false;
+    }
+
+    stop();
+    Mix_HaltMusic();
+
+    m_frameBytes = static_cast<size_t>(SDL_AUDIO_BITSIZE(format) / 8) * channels;
+    publishCursor(0, SongClock::hostTimeMs());
+    m_playing.store(true, std::memory_order_release);
+    Mix_HookMusic(&PcmMusic::mixHook, this);
+    m_hooked = true;
+    return true;
+}
+
+void PcmMusic::stop() {
+    if (m_hooked) {
+        Mix_HookMusic(nullptr, nullptr); // Waits for a running hook call to finish
+        m_hooked = false;
+    }
+    m_playing.store(false, std::memory_order_release);
+}
+
+MusicPosition PcmMusic::getPosition() const {
+    MusicPosition position;
+    if (m_frameBytes == 0 || m_frequency <= 0) {
+        position.positionMs = 0.0;
+        return position;
+    }
+
+    // Retry while the mixer callback is between its two stores, so the pair is from one callback
+    std::uint32_t sequence = 0;
+    size_t bytes = 0;
+    double hostMs = 0.0;
+    do {
+        sequence = m_cursorSequence.load(std::memory_order_acquire);
+        bytes = m_cursorBytes.load(std::memory_order_relaxed);
+        hostMs = m_cursorHostMs.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+    } while ((sequence & 1) != 0 || sequence != m_cursorSequence.load(std::memory_order_relaxed));
+
+    position.positionMs = static_cast<double>(bytes / m_frameBytes) * 1000.0 / m_frequency;
+    position.hostMs = hostMs;
+    return position;
+}
+
+void PcmMusic::publishCursor(size_t bytes, double hostMs) {
+    // Only one writer at a time: play() before the hook is installed, then the mixer callback
+    const std::uint32_t sequence = m_cursorSequence.load(std::memory_order_relaxed);
+    m_cursorSequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    m_cursorBytes.store(bytes, std::memory_order_relaxed);
+    m_cursorHostMs.store(hostMs, std::memory_order_relaxed);
+    m_cursorSequence.store(sequence + 2, std::memory_order_release);
+}
+
+void PcmMusic::release() {
+    stop();
+    if (m_worker.joinable()) {
+        m_worker.join();
+    }
+    if (m_chunk) {
+        Mix_FreeChunk(m_chunk);
+        m_chunk = nullptr;
+    }
+    m_path.clear();
+    m_stats = PcmMusicStats();
+    m_frameBytes = 0;
+}
+
+void SDLCALL PcmMusic::mixHook(void* userdata, Uint8* stream, int len) {
+    // Audio thread. The mixer has already filled stream with silence, so only the song is copied.
+    PcmMusic* music = static_cast<PcmMusic*>(userdata);
+    if (!music->m_playing.load(std::memory_order_acquire)) {
+        return;
+    }
+
+    const size_t total = music->m_chunk->alen;
+    const size_t cursor = music->m_cursorBytes.load(std::memory_order_relaxed);
+    const size_t count = std::min(static_cast<size_t>(len), total - cursor);
+    std::memcpy(stream, music->m_chunk->abuf + cursor, count);
+
+    music->publishCursor(cursor + count, SongClock::hostTimeMs());
+    if (cursor + count >= total) {
+        music->m_playing.store(false, std::memory_order_release);
+    }
+}
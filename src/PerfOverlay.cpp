@@ -0,0 +1,161 @@
+#include "PerfOverlay.hpp"
+#include "RenderWindow.hpp"
+#include "ResourceManager.hpp"
+#include "GlyphAtlas.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <numeric>
+
+namespace {
+
+constexpr int kMargin = 10;
+constexpr int kPadding = 8;
+constexpr int kPanelWidth = 380;
+constexpr int kTextLines = 5;
+constexpr double kFrameMs60 = 1000.0 / 60.0;
+constexpr double kFrameMs30 = 1000.0 / 30.0;
+
+constexpr SDL_Color kTextColor = {255, 255, 255, 255};
+constexpr SDL_Color kBarColors[3] = {{80, 220, 100, 255}, {240, 200, 60, 255}, {230, 70, 60, 255}};
+
+// Nearest-rank percentile of sorted frame times
+double percentile(const std::vector<float>& sorted, size_t percent) {
+    size_t index = (sorted.size() * percent + 99) / 100;
+    return sorted[index > 0 ? index - 1 : 0];
+}
+
+} // namespace
+
+PerfOverlay::PerfOverlay()
+    : m_enabled(false), m_glyphs(nullptr), m_historyNext(0), m_hasDrift(false), m_driftMs(0.0) {
+    m_history.reserve(kHistorySize);
+    m_sorted.reserve(kHistorySize);
+    for (auto& bars : m_bars) {
+        bars.reserve(kHistorySize);
+    }
+}
+
+void PerfOverlay::recordFrame(double frameMs) {
+    if (m_history.size() < kHistorySize) {
+        m_history.push_back(static_cast<float>(frameMs));
+    } else {
+        m_history[m_historyNext] = static_cast<float>(frameMs);
+    }
+    m_historyNext = (m_historyNext + 1) % kHistorySize;
+}
+
+PerfOverlayStats PerfOverlay::getStats() const {
+    PerfOverlayStats stats;
+    if (m_history.empty()) {
+        return stats;
+    }
+
+    m_sorted.assign(m_history.begin(), m_history.end());
+    std::sort(m_sorted.begin(), m_sorted.end());
+
+    stats.frames = m_sorted.size();
+    stats.lastMs = m_history[(m_historyNext + m_history.size() - 1) % m_history.size()];
+    double totalMs = std::accumulate(m_sorted.begin(), m_sorted.end(), 0.0);
+    stats.fps = totalMs > 0.0 ? 1000.0 * m_sorted.size() / totalMs : 0.0;
+    stats.p50Ms = percentile(m_sorted, 50);
+    stats.p99Ms = percentile(m_sorted, 99);
+    return stats;
+}
+
+void PerfOverlay::setClockDriftMs(double driftMs) {
+    m_driftMs = driftMs;
+    m_hasDrift = true;
+}
+
+void PerfOverlay::draw(RenderWindow& window, const RenderStats& frameStats, const TextureCacheStats* cacheStats) {
+    SDL_Renderer* renderer = window.getRenderer();
+    if (!renderer) {
+        return;
+    }
+
+    // The draw color doubles as the clear color, so it is put back afterwards
+    Uint8 r, g, b, a;
+    SDL_BlendMode blendMode;
+    SDL_GetRenderDrawColor(renderer, &r, &g, &b, &a);
+    SDL_GetRenderDrawBlendMode(renderer, &blendMode);
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+
+    const int lineHeight = m_glyphs ? m_glyphs->getLineHeight() : 0;
+    const int textHeight = lineHeight * kTextLines;
+    const SDL_Rect panel = {kMargin, kMargin, kPanelWidth, textHeight + kGraphHeight + kPadding * 3};
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 170);
+    SDL_RenderFillRect(renderer, &panel);
+
+    // Numbers, formatted into stack buffers and drawn from the glyph atlas
+    if (m_glyphs) {
+        const PerfOverlayStats stats = getStats();
+        const int x = panel.x + kPadding;
+        int y = panel.y + kPadding;
+        char text[64];
+
+        snprintf(text, sizeof(text), "FPS %.1f   FRAME %.2f MS", stats.fps, stats.lastMs);
+        drawLine(window, text, x, y);
+        y += lineHeight;
+
+        snprintf(text, sizeof(text), "P50 %.2f MS   P99 %.2f MS", stats.p50Ms, stats.p99Ms);
+        drawLine(window, text, x, y);
+        y += lineHeight;
+
+        snprintf(text, sizeof(text), "DRAWS %d   BINDS %d", frameStats.drawCalls, frameStats.textureBinds);
+        drawLine(window, text, x, y);
+        y += lineHeight;
+
+        if (cacheStats) {
+            snprintf(text, sizeof(text), "TEXTURES %zu   %.1f MB", cacheStats->liveTextures,
+                     cacheStats->liveBytes / (1024.0 * 1024.0));
+        } else {
+            snprintf(text, sizeof(text), "TEXTURES -");
+        }
+        drawLine(window, text, x, y);
+        y += lineHeight;
+
+        if (m_hasDrift) {
+            snprintf(text, sizeof(text), "CLOCK DRIFT %+.2f MS", m_driftMs);
+        } else {
+            snprintf(text, sizeof(text), "CLOCK DRIFT -");
+        }
+        drawLine(window, text, x, y);
+    }
+
+    // Oldest frame on the left, one pixel per frame, bucketed by color so each bucket is one fill call
+    const int graphX = panel.x + kPadding;
+    const int graphBottom = panel.y + kPadding * 2 + textHeight + kGraphHeight;
+    for (auto& bars : m_bars) {
+        bars.clear();
+    }
+    const size_t count = m_history.size();
+    const size_t oldest = count < kHistorySize ? 0 : m_historyNext;
+    for (size_t i = 0; i < count; ++i) {
+        const double frameMs = m_history[(oldest + i) % count];
+        const int height = std::max(1, static_cast<int>(std::min(frameMs / kGraphMaxMs, 1.0) * kGraphHeight));
+        const int bucket = frameMs <= kFrameMs60 ? 0 : (frameMs <= kFrameMs30 ? 1 : 2);
+        m_bars[bucket].push_back({graphX + static_cast<int>(i), graphBottom - height, 1, height});
+    }
+    for (int bucket = 0; bucket < 3; ++bucket) {
+        if (!m_bars[bucket].empty()) {
+            const SDL_Color& color = kBarColors[bucket];
+            SDL_SetRenderDrawColor(renderer, color.r, color.g, color.b, color.a);
+            SDL_RenderFillRects(renderer, m_bars[bucket].data(), static_cast<int>(m_bars[bucket].size()));
+        }
+    }
+
+    // 60 FPS budget line
+    const int budgetY = graphBottom - static_cast<int>(kFrameMs60 / kGraphMaxMs * kGraphHeight);
+    SDL_SetRenderDrawColor(renderer, 255, 255, 255, 120);
+    SDL_RenderDrawLine(renderer, graphX, budgetY, graphX + static_cast<int>(kHistorySize), budgetY);
+
+    SDL_SetRenderDrawColor(renderer, r, g, b, a);
+    SDL_SetRenderDrawBlendMode(renderer, blendMode);
+}
+
+void PerfOverlay::drawLine(RenderWindow& window, const char* text, int x, int y) {
+    // Reuses the string's capacity, so this does not allocate after the first frames
+    m_line.assign(text);
+    window.renderText(*m_glyphs, m_line, x, y, kTextColor);
+}
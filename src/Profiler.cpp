@@ -0,0 +1,246 @@
+#include "Profiler.hpp"
+#include "Logger.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+std::atomic<bool> Profiler::s_recording(false);
+
+namespace {
+
+struct ZoneEvent {
+    const char* name;
+    std::int64_t startNs;
+    std::int64_t endNs;
+};
+
+struct Chunk {
+    ZoneEvent events[Profiler::kChunkEvents];
+    std::atomic<Chunk*> next{nullptr};
+};
+
+// Written by its own thread only; the session code reads events [readCount, count) and frees the
+// chunks before readChunk, which the owning thread has moved past
+struct ThreadBuffer {
+    explicit ThreadBuffer(int id) : threadId(id), name("Thread " + std::to_string(id)), head(new Chunk()), tail(head) {}
+
+    ~ThreadBuffer() {
+        Chunk* chunk = head;
+        while (chunk) {
+            Chunk* next = chunk->next.load(std::memory_order_relaxed);
+            delete chunk;
+            chunk = next;
+        }
+    }
+
+    const int threadId;
+    std::string name;                   // Registry mutex
+    Chunk* head;                        // Registry mutex
+    Chunk* tail;                        // Owning thread
+    std::atomic<size_t> count{0};       // Events published by the owning thread
+    std::atomic<size_t> dropped{0};
+    std::atomic<size_t> sessionBase{0}; // count when the current session began; the per-session cap counts from here
+
+    // Session side, under the registry mutex: events before readCount belong to an earlier session.
+    // readChunk holds event readCount - 1 (head while nothing was read).
+    Chunk* readChunk = head;
+    size_t readCount = 0;
+    size_t droppedAtBegin = 0;
+};
+
+struct Registry {
+    std::mutex mutex;
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+    std::string tracePath;
+    std::int64_t sessionStartNs = 0;
+    bool active = false;
+};
+
+Registry& registry() {
+    static Registry instance;
+    return instance;
+}
+
+thread_local ThreadBuffer* t_buffer = nullptr;
+
+ThreadBuffer& threadBuffer() {
+    if (!t_buffer) {
+        Registry& reg = registry();
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        reg.buffers.push_back(std::make_unique<ThreadBuffer>(static_cast<int>(reg.buffers.size()) + 1));
+        t_buffer = reg.buffers.back().get();
+    }
+    return *t_buffer;
+}
+
+// Visit the events published since the read position and move the read position past them
+template <typename Visit>
+void consume(ThreadBuffer& buffer, Visit visit) {
+    const size_t count = buffer.count.load(std::memory_order_acquire);
+    for (; buffer.readCount < count; ++buffer.readCount) {
+        const size_t offset = buffer.readCount % Profiler::kChunkEvents;
+        if (offset == 0 && buffer.readCount > 0) {
+            buffer.readChunk = buffer.readChunk->next.load(std::memory_order_acquire);
+        }
+        visit(buffer.readChunk->events[offset]);
+    }
+}
+
+// Start the next session at the end of the buffer, freeing the chunks only earlier sessions used
+void skipToEnd(ThreadBuffer& buffer) {
+    consume(buffer, [](const ZoneEvent&) {});
+    while (buffer.head != buffer.readChunk) {
+        Chunk* next = buffer.head->next.load(std::memory_order_relaxed);
+        delete buffer.head;
+        buffer.head = next;
+    }
+    buffer.sessionBase.store(buffer.readCount, std::memory_order_relaxed);
+    buffer.droppedAtBegin = buffer.dropped.load(std::memory_order_relaxed);
+}
+
+void writeJsonString(std::ostream& out, const std::string& text) {
+    out << '"';
+    for (char c : text) {
+        if (c == '"' || c == '\\') {
+            out << '\\' << c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            char escaped[8];
+            snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned>(c));
+            out << escaped;
+        } else {
+            out << c;
+        }
+    }
+    out << '"';
+}
+
+} // namespace
+
+bool Profiler::beginSession(const std::string& tracePath) {
+    Registry& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    if (reg.active) {
+        Logger::warning("Profiler session already running, not starting another for " + tracePath);
+        return false;
+    }
+
+    for (auto& buffer : reg.buffers) {
+        skipToEnd(*buffer);
+    }
+    reg.tracePath = tracePath;
+    reg.sessionStartNs = nowNs();
+    reg.active = true;
+    s_recording.store(true, std::memory_order_relaxed);
+    return true;
+}
+
+bool Profiler::endSession() {
+    s_recording.store(false, std::memory_order_relaxed);
+
+    Registry& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    if (!reg.active) {
+        return false;
+    }
+    reg.active = false;
+
+    std::ofstream file(reg.tracePath, std::ios::trunc);
+    if (!file) {
+        Logger::error("Could not write profiler trace: " + reg.tracePath);
+        return false;
+    }
+
+    // Complete ("X") events with microsecond timestamps relative to the session start
+    file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    file << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"meowstro\"}}";
+
+    size_t written = 0;
+    size_t dropped = 0;
+    char line[160];
+    for (auto& bufferPtr : reg.buffers) {
+        ThreadBuffer& buffer = *bufferPtr;
+        file << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer.threadId << ",\"args\":{\"name\":";
+        writeJsonString(file, buffer.name);
+        file << "}}";
+
+        consume(buffer, [&](const ZoneEvent& event) {
+            if (event.startNs < reg.sessionStartNs) {
+                return; // Opened before the session began
+            }
+            file << ",\n{\"name\":";
+            writeJsonString(file, event.name ? event.name : "?");
+            snprintf(line, sizeof(line), ",\"cat\":\"meowstro\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%d}",
+                     (event.startNs - reg.sessionStartNs) / 1000.0, (event.endNs - event.startNs) / 1000.0, buffer.threadId);
+            file << line;
+            written++;
+        });
+        dropped += buffer.dropped.load(std::memory_order_relaxed) - buffer.droppedAtBegin;
+        skipToEnd(buffer);
+    }
+    file << "\n]}\n";
+
+    if (!file) {
+        Logger::error("Failed writing profiler trace: " + reg.tracePath);
+        return false;
+    }
+
+    Logger::info("Saved profiler trace with " + std::to_string(written) + " zones to " + reg.tracePath);
+    if (dropped > 0) {
+        Logger::warning("Profiler buffers were full, dropped " + std::to_string(dropped) + " zones");
+    }
+    return true;
+}
+
+void Profiler::setThreadName(const std::string& name) {
+    ThreadBuffer& buffer = threadBuffer();
+    std::lock_guard<std::mutex> lock(registry().mutex);
+    buffer.name = name;
+}
+
+std::int64_t Profiler::nowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void Profiler::record(const char* name, std::int64_t startNs, std::int64_t endNs) {
+    ThreadBuffer& buffer = threadBuffer();
+    const size_t count = buffer.count.load(std::memory_order_relaxed);
+    if (count - buffer.sessionBase.load(std::memory_order_relaxed) >= kMaxEventsPerThread) {
+        buffer.dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    // A full chunk is linked before any event in the new one is published
+    const size_t offset = count % kChunkEvents;
+    if (offset == 0 && count > 0) {
+        Chunk* chunk = new Chunk();
+        buffer.tail->next.store(chunk, std::memory_order_release);
+        buffer.tail = chunk;
+    }
+
+    buffer.tail->events[offset] = {name, startNs, endNs};
+    buffer.count.store(count + 1, std::memory_order_release);
+}
+
+size_t Profiler::getRecordedCount() {
+    Registry& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    size_t recorded = 0;
+    for (auto& buffer : reg.buffers) {
+        recorded += buffer->count.load(std::memory_order_acquire) - buffer->readCount;
+    }
+    return recorded;
+}
+
+size_t Profiler::getDroppedCount() {
+    Registry& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    size_t dropped = 0;
+    for (auto& buffer : reg.buffers) {
+        dropped += buffer->dropped.load(std::memory_order_relaxed) - buffer->droppedAtBegin;
+    }
+    return dropped;
+}
@@ -1,10 +1,14 @@
 #include <iostream>
 #include "RenderWindow.hpp"
 #include "Logger.hpp"
+#include "Profiler.hpp"
+#include "GlyphAtlas.hpp"
+#include "ResourceManager.hpp"
 
 
 RenderWindow::RenderWindow(const char *title, int w, int h, Uint32 windowFlags) 
-    : window(nullptr), renderer(nullptr), m_valid(false)
+    : window(nullptr), renderer(nullptr), m_valid(false), m_lastTexture(nullptr), m_resourceManager(nullptr), m_culler(w, h),
+      m_lastPresentTicks(0)
 {
 	window = SDL_CreateWindow(title, SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED, w, h, windowFlags);
 	if (window == nullptr)
@@ -38,7 +42,8 @@ void RenderWindow::render(Entity& entity)
 		return;
 	}
 	
-	if (entity.getTexture() == nullptr) {
+	SDL_Texture* texture = resolveTexture(entity);
+	if (texture == nullptr) {
 		Logger::warning("RenderWindow::render called with null texture");
 		return;
 	}
@@ -51,13 +56,151 @@ void RenderWindow::render(Entity& entity)
 	destination.w = entity.getCurrentFrame().w;
 	destination.h = entity.getCurrentFrame().h;
 
-	SDL_RenderCopy(renderer, entity.getTexture(), &src, &destination);
+	render(texture, &src, destination);
+}
+void RenderWindow::render(SDL_Texture* texture, const SDL_Rect* src, const SDL_Rect& destination)
+{
+	if (!m_valid || !renderer || texture == nullptr) {
+		return;
+	}
+	
+	flushBatch();
+	m_frameStats.drawCalls++;
+	if (texture != m_lastTexture) {
+		m_frameStats.textureBinds++;
+		m_lastTexture = texture;
+	}
+	
+	SDL_RenderCopy(renderer, texture, src, &destination);
+}
+void RenderWindow::renderText(const GlyphAtlas& glyphs, const std::string& text, int x, int y, SDL_Color color)
+{
+	if (!m_valid || !renderer || !glyphs.isValid() || text.empty()) {
+		return;
+	}
+	
+	m_textVertices.clear();
+	m_textIndices.clear();
+	glyphs.appendQuads(text, static_cast<float>(x), static_cast<float>(y), color, m_textVertices, m_textIndices);
+	if (m_textIndices.empty()) {
+		return;
+	}
+	
+	flushBatch();
+	m_frameStats.drawCalls++;
+	if (glyphs.getTexture() != m_lastTexture) {
+		m_frameStats.textureBinds++;
+		m_lastTexture = glyphs.getTexture();
+	}
+	
+	SDL_RenderGeometry(renderer, glyphs.getTexture(), m_textVertices.data(), static_cast<int>(m_textVertices.size()),
+	                   m_textIndices.data(), static_cast<int>(m_textIndices.size()));
+}
+SDL_Texture* RenderWindow::resolveTexture(Entity& entity)
+{
+	// Cache-owned textures go through their handle: reloaded if evicted, skipped once released
+	if (m_resourceManager && entity.getTextureHandle().isValid()) {
+		return m_resourceManager->getTexture(entity.getTextureHandle());
+	}
+	return entity.getTexture();
+}
+void RenderWindow::submit(Entity& entity, int layer)
+{
+	if (!m_valid || !renderer) {
+		Logger::error("RenderWindow::submit called on invalid window");
+		return;
+	}
+	
+	// Cull before resolving the texture so off-screen entities cost a rect test only
+	SDL_Rect src = entity.getCurrentFrame();
+	SDL_FRect destination = {entity.getX(), entity.getY(), static_cast<float>(src.w), static_cast<float>(src.h)};
+	if (!m_culler.isVisible(destination)) {
+		m_frameStats.culledSprites++;
+		return;
+	}
+	
+	SDL_Texture* texture = resolveTexture(entity);
+	if (texture == nullptr) {
+		Logger::warning("RenderWindow::submit called with null texture");
+		return;
+	}
+	
+	m_frameStats.visibleSprites++;
+	m_batch.submit(texture, src, destination, {255, 255, 255, 255}, layer);
+}
+void RenderWindow::submit(SDL_Texture* texture, const SDL_Rect& src, const SDL_Rect& destination, int layer, SDL_Color color)
+{
+	if (!m_valid || !renderer || texture == nullptr) {
+		return;
+	}
+	
+	SDL_FRect dst = {static_cast<float>(destination.x), static_cast<float>(destination.y),
+	                 static_cast<float>(destination.w), static_cast<float>(destination.h)};
+	if (!m_culler.isVisible(dst)) {
+		m_frameStats.culledSprites++;
+		return;
+	}
+	
+	m_frameStats.visibleSprites++;
+	m_batch.submit(texture, src, dst, color, layer);
+}
+void RenderWindow::flushBatch()
+{
+	PROFILE_ZONE("RenderWindow::flushBatch");
+	if (m_batch.empty()) {
+		return;
+	}
+	if (!m_valid || !renderer) {
+		m_batch.clear();
+		return;
+	}
+	
+	SpriteBatch::FlushResult result = m_batch.flush(renderer, m_lastTexture);
+	m_frameStats.drawCalls += result.drawCalls;
+	m_frameStats.textureBinds += result.textureBinds;
+	m_frameStats.batchedSprites += result.sprites;
+	m_lastTexture = result.lastTexture;
+}
+bool RenderWindow::setVSync(bool enabled)
+{
+	if (!m_valid || !renderer) {
+		return false;
+	}
+	if (SDL_RenderSetVSync(renderer, enabled ? 1 : 0) != 0) {
+		Logger::logSDLError(LogLevel::WARNING, "Failed to change VSync");
+		return false;
+	}
+	return true;
 }
 void RenderWindow::display()
 {
+	PROFILE_ZONE("RenderWindow::display");
+	flushBatch();
+	m_lastFrameStats = m_frameStats;
+	
+	// Present-to-present time, so the overlay sees the same frame times whichever loop is running
+	Uint64 now = SDL_GetPerformanceCounter();
+	if (m_lastPresentTicks != 0) {
+		m_perfOverlay.recordFrame((now - m_lastPresentTicks) * 1000.0 / SDL_GetPerformanceFrequency());
+	}
+	m_lastPresentTicks = now;
+	
 	if (m_valid && renderer) {
+		if (m_perfOverlay.isEnabled()) {
+			TextureCacheStats cacheStats;
+			if (m_resourceManager) {
+				cacheStats = m_resourceManager->getTextureCacheStats();
+			}
+			m_perfOverlay.draw(*this, m_lastFrameStats, m_resourceManager ? &cacheStats : nullptr);
+		}
+		
+		PROFILE_ZONE("SDL_RenderPresent");
 		SDL_RenderPresent(renderer);
 	}
+	
+	m_perfOverlay.clearClockDrift();
+	m_frameStats = RenderStats();
+	m_lastTexture = nullptr;
 }
 
 RenderWindow::~RenderWindow()
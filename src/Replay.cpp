@@ -0,0 +1,264 @@
+#include "Replay.hpp"
+#include "GameSimulation.hpp"
+#include "Logger.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+
+namespace {
+
+std::string lineContext(const std::string& sourceName, int lineNumber) {
+    return sourceName + ":" + std::to_string(lineNumber);
+}
+
+} // namespace
+
+Replay::Replay()
+    : m_seed(0), m_noteCount(0), m_noteHash(0), m_inputOffsetMs(0.0),
+      m_perfectWindowMs(60.0), m_goodWindowMs(120.0), m_endSongTimeMs(0.0), m_loaded(false) {
+}
+
+void Replay::begin(std::uint32_t seed, const std::vector<double>& noteTimesMs, double inputOffsetMs,
+                   double perfectWindowMs, double goodWindowMs) {
+    clear();
+    m_seed = seed;
+    m_noteCount = noteTimesMs.size();
+    m_noteHash = hashNotes(noteTimesMs);
+    m_inputOffsetMs = inputOffsetMs;
+    m_perfectWindowMs = perfectWindowMs;
+    m_goodWindowMs = goodWindowMs;
+
+    // Room for a press and a miss sweep per note plus stray presses, so recording does not allocate mid-song
+    m_events.reserve(m_noteCount * 2 + 256);
+}
+
+void Replay::recordPress(double songTimeMs) {
+    m_events.push_back({ReplayEventType::Press, songTimeMs});
+}
+
+void Replay::recordMissSweep(double songTimeMs) {
+    m_events.push_back({ReplayEventType::MissSweep, songTimeMs});
+}
+
+void Replay::finish(double endSongTimeMs, const GameStats& stats) {
+    m_endSongTimeMs = endSongTimeMs;
+    m_stats = GameStats(stats.getScore(), stats.getCombo(), stats.getHits(), stats.getMisses());
+    m_loaded = true;
+}
+
+void Replay::clear() {
+    m_seed = 0;
+    m_noteCount = 0;
+    m_noteHash = 0;
+    m_inputOffsetMs = 0.0;
+    m_endSongTimeMs = 0.0;
+    m_stats.resetStats();
+    m_events.clear();
+    m_loaded = false;
+}
+
+bool Replay::saveToFile(const std::string& filePath) const {
+    std::ofstream file(filePath, std::ios::trunc);
+    if (!file) {
+        Logger::error("Could not write replay: " + filePath);
+        return false;
+    }
+    if (!save(file)) {
+        Logger::error("Failed writing replay: " + filePath);
+        return false;
+    }
+    Logger::info("Saved replay with " + std::to_string(m_events.size()) + " events to " + filePath);
+    return true;
+}
+
+bool Replay::save(std::ostream& output) const {
+    if (!m_loaded) {
+        return false;
+    }
+
+    // 17 significant digits reproduce every double exactly on load
+    output << std::setprecision(std::numeric_limits<double>::max_digits10);
+    output << "# Meowstro replay - written by the game\n";
+    output << "version " << kFormatVersion << "\n";
+    output << "seed " << m_seed << "\n";
+    output << "notes " << m_noteCount << " " << m_noteHash << "\n";
+    output << "input_offset_ms " << m_inputOffsetMs << "\n";
+    output << "windows " << m_perfectWindowMs << " " << m_goodWindowMs << "\n";
+    output << "end " << m_endSongTimeMs << "\n";
+    output << "result " << m_stats.getScore() << " " << m_stats.getHits() << " " << m_stats.getMisses() << "\n";
+    for (const ReplayEvent& event : m_events) {
+        output << (event.type == ReplayEventType::Press ? "p " : "m ") << event.songTimeMs << "\n";
+    }
+    return static_cast<bool>(output);
+}
+
+bool Replay::loadFromFile(const std::string& filePath) {
+    std::ifstream file(filePath);
+    if (!file) {
+        Logger::error("Failed to open replay: " + filePath);
+        clear();
+        return false;
+    }
+    return load(file, filePath);
+}
+
+bool Replay::load(std::istream& input, const std::string& sourceName) {
+    clear();
+
+    std::string line;
+    int lineNumber = 0;
+    int version = 0;
+    bool haveResult = false;
+    std::istringstream values;
+
+    while (std::getline(input, line)) {
+        ++lineNumber;
+
+        size_t comment = line.find('#');
+        if (comment != std::string::npos) {
+            line.erase(comment);
+        }
+        values.clear();
+        values.str(line);
+
+        std::string key;
+        if (!(values >> key)) {
+            continue;
+        }
+
+        bool ok = true;
+        if (key == "p" || key == "m") {
+            double timeMs = 0.0;
+            ok = static_cast<bool>(values >> timeMs);
+            if (ok) {
+                m_events.push_back({key == "p" ? ReplayEventType::Press : ReplayEventType::MissSweep, timeMs});
+            }
+        } else if (key == "version") {
+            ok = static_cast<bool>(values >> version);
+        } else if (key == "seed") {
+            ok = static_cast<bool>(values >> m_seed);
+        } else if (key == "notes") {
+            ok = static_cast<bool>(values >> m_noteCount >> m_noteHash);
+        } else if (key == "input_offset_ms") {
+            ok = static_cast<bool>(values >> m_inputOffsetMs);
+        } else if (key == "windows") {
+            ok = static_cast<bool>(values >> m_perfectWindowMs >> m_goodWindowMs);
+        } else if (key == "end") {
+            ok = static_cast<bool>(values >> m_endSongTimeMs);
+        } else if (key == "result") {
+            int score = 0;
+            int hits = 0;
+            int misses = 0;
+            ok = static_cast<bool>(values >> score >> hits >> misses);
+            if (ok) {
+                m_stats = GameStats(score, 0, hits, misses);
+                haveResult = true;
+            }
+        } else {
+            Logger::warning("Unknown replay key '" + key + "' at " + lineContext(sourceName, lineNumber));
+        }
+
+        if (!ok) {
+            Logger::error("Malformed '" + key + "' line at " + lineContext(sourceName, lineNumber));
+            clear();
+            return false;
+        }
+    }
+
+    if (version != kFormatVersion) {
+        Logger::error("Unsupported replay version " + std::to_string(version) + " in " + sourceName);
+        clear();
+        return false;
+    }
+    if (!haveResult) {
+        Logger::error("Replay has no result line: " + sourceName);
+        clear();
+        return false;
+    }
+    if (!std::isfinite(m_endSongTimeMs) || m_endSongTimeMs < 0.0) {
+        Logger::error("Replay has no valid end time: " + sourceName);
+        clear();
+        return false;
+    }
+
+    // The game only records events between the song start and the end of the recording
+    for (const ReplayEvent& event : m_events) {
+        if (!std::isfinite(event.songTimeMs) || event.songTimeMs < 0.0 || event.songTimeMs > m_endSongTimeMs) {
+            Logger::error("Replay event outside the song (" + std::to_string(event.songTimeMs) + " ms) in " + sourceName);
+            clear();
+            return false;
+        }
+    }
+
+    m_loaded = true;
+    return true;
+}
+
+ReplayResult Replay::play(const std::vector<double>& noteTimesMs, double stepMs) const {
+    ReplayResult result;
+    if (!m_loaded) {
+        return result;
+    }
+    if (noteTimesMs.size() != m_noteCount || hashNotes(noteTimesMs) != m_noteHash) {
+        Logger::error("Replay was recorded on a different chart");
+        return result;
+    }
+
+    SimulationConfig config;
+    config.noteTimesMs = noteTimesMs;
+    config.seed = m_seed;
+    config.perfectWindowMs = m_perfectWindowMs;
+    config.goodWindowMs = m_goodWindowMs;
+    config.inputOffsetMs = m_inputOffsetMs;
+    if (stepMs > 0.0) {
+        config.stepMs = stepMs;
+    }
+
+    // The same GameSimulation the game ran, on a clock that only moves when the replay says so
+    ManualClock clock;
+    GameSimulation simulation;
+    simulation.setClock(&clock);
+    simulation.reset(config);
+    result.valid = true;
+
+    // Events are applied in recorded order. The clock moves straight to each event and never
+    // back: a press can carry an earlier time than the sweep before it, and step() judges it at
+    // its own time either way. A step on a press also sweeps at the press time, which only
+    // resolves notes no later press could reach, so the totals match the recording.
+    std::vector<double> presses;
+    presses.reserve(1);
+    for (const ReplayEvent& event : m_events) {
+        clock.setTimeMs(std::max(clock.getTimeMs(), event.songTimeMs));
+        presses.clear();
+        if (event.type == ReplayEventType::Press) {
+            presses.push_back(event.songTimeMs);
+        }
+        simulation.update(presses);
+        ++result.steps;
+    }
+
+    GameStats& stats = result.stats;
+    stats = simulation.getStats();
+    result.matches = stats.getScore() == m_stats.getScore() &&
+                     stats.getHits() == m_stats.getHits() &&
+                     stats.getMisses() == m_stats.getMisses();
+    return result;
+}
+
+std::uint32_t Replay::hashNotes(const std::vector<double>& noteTimesMs) {
+    std::uint32_t hash = 2166136261u;
+    for (double timeMs : noteTimesMs) {
+        unsigned char bytes[sizeof(double)];
+        std::memcpy(bytes, &timeMs, sizeof(double));
+        for (unsigned char byte : bytes) {
+            hash ^= byte;
+            hash *= 16777619u;
+        }
+    }
+    return hash;
+}
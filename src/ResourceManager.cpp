@@ -1,9 +1,22 @@
 #include "ResourceManager.hpp"
 #include "Logger.hpp"
+#include "GameConfig.hpp"
+#include "Profiler.hpp"
 
 #include <iostream>
 
+namespace {
+
+std::uint32_t packColor(SDL_Color color) {
+    return (static_cast<std::uint32_t>(color.r) << 24) | (static_cast<std::uint32_t>(color.g) << 16) |
+           (static_cast<std::uint32_t>(color.b) << 8) | static_cast<std::uint32_t>(color.a);
+}
+
+} // namespace
+
 ResourceManager::ResourceManager(SDL_Renderer* renderer) : renderer(renderer), m_valid(false) {
+    cacheStats.budgetBytes = GameConfig::getInstance().getResourceConfig().textureCacheBudgetBytes;
+    
     if (renderer == nullptr) {
         Logger::error("ResourceManager: null renderer provided");
         return;
@@ -15,42 +28,195 @@ ResourceManager::~ResourceManager() {
     cleanup();
 }
 
-SDL_Texture* ResourceManager::loadTexture(const std::string& filePath) {
+bool ResourceManager::mountAssetPack(const std::string& packPath) {
+    PROFILE_ZONE("ResourceManager::mountAssetPack");
+    if (!assetPack.open(packPath)) {
+        Logger::info("No usable asset pack at " + packPath + ", loading assets from individual files");
+        return false;
+    }
+    
+    if (asyncLoader) {
+        asyncLoader->setAssetPack(&assetPack);
+    }
+    return true;
+}
+
+TextureHandle ResourceManager::acquireTexture(const std::string& filePath) {
     if (!m_valid) {
-        Logger::error("ResourceManager::loadTexture called on invalid ResourceManager");
-        return nullptr;
+        Logger::error("ResourceManager::acquireTexture called on invalid ResourceManager");
+        return TextureHandle();
     }
     
     if (filePath.empty()) {
-        Logger::error("ResourceManager::loadTexture called with empty file path");
-        return nullptr;
+        Logger::error("ResourceManager::acquireTexture called with empty file path");
+        return TextureHandle();
     }
     
-    // Check if texture already loaded and validate it
-    auto it = textures.find(filePath);
-    if (it != textures.end()) {
-        if (isTextureValid(it->second)) {
-            Logger::debug("Using cached texture: " + filePath);
-            return it->second;
-        } else {
-            Logger::warning("Cached texture is invalid, reloading: " + filePath);
-            textures.erase(it);
-        }
+    auto it = imageSlots.find(filePath);
+    if (it != imageSlots.end()) {
+        return makeHandle(it->second);
     }
     
-    // Load new texture
-    SDL_Texture* texture = IMG_LoadTexture(renderer, filePath.c_str());
+    // Register on first use - the slot remembers the path so eviction can reload it
+    TextureSlot source;
+    source.path = filePath;
+    cacheStats.misses++;
+    SDL_Texture* texture = createSlotTexture(source);
     if (!texture) {
-        Logger::logSDLImageError(LogLevel::ERROR, "Failed to load texture: " + filePath);
-        return nullptr;
+        return TextureHandle();
     }
     
-    // Cache the texture
-    textures[filePath] = texture;
+    std::uint32_t index = allocateSlot();
+    textureSlots[index].path = filePath;
+    imageSlots[filePath] = index;
+    makeResident(index, texture);
     Logger::debug("Loaded texture: " + filePath);
+    return makeHandle(index);
+}
+
+TextureHandle ResourceManager::acquireTextTexture(FontHandle font, const std::string& text, SDL_Color color) {
+    if (!m_valid) {
+        Logger::error("ResourceManager::acquireTextTexture called on invalid ResourceManager");
+        return TextureHandle();
+    }
+    
+    if (text.empty()) {
+        Logger::warning("ResourceManager::acquireTextTexture called with empty text");
+        return TextureHandle();
+    }
+    
+    if (!getFont(font)) {
+        Logger::error("ResourceManager::acquireTextTexture called with invalid font handle");
+        return TextureHandle();
+    }
+    
+    TextKey key{font.index, packColor(color), text};
+    auto it = textSlots.find(key);
+    if (it != textSlots.end()) {
+        return makeHandle(it->second);
+    }
+    
+    TextureSlot source;
+    source.font = font;
+    source.text = text;
+    source.color = color;
+    cacheStats.misses++;
+    SDL_Texture* texture = createSlotTexture(source);
+    if (!texture) {
+        Logger::error("Failed to create text texture for: " + text);
+        return TextureHandle();
+    }
+    
+    std::uint32_t index = allocateSlot();
+    TextureSlot& slot = textureSlots[index];
+    slot.font = font;
+    slot.text = text;
+    slot.color = color;
+    textSlots.emplace(std::move(key), index);
+    makeResident(index, texture);
+    Logger::debug("Created text texture: " + text);
+    return makeHandle(index);
+}
+
+FontHandle ResourceManager::acquireFont(const std::string& fontPath, int fontSize) {
+    std::string fontKey = generateFontKey(fontPath, fontSize);
+    
+    // Check if font already loaded
+    auto it = fontSlotsByKey.find(fontKey);
+    if (it != fontSlotsByKey.end()) {
+        return FontHandle{it->second, fontSlots[it->second].generation};
+    }
+    
+    // Load new font - packed font bytes stay mapped for the font's lifetime
+    PROFILE_ZONE("ResourceManager::acquireFont (load)");
+    auto font = std::make_unique<Font>();
+    const AssetPackEntry* packed = assetPack.find(fontPath);
+    bool loaded = (packed && packed->type == AssetPackEntryType::Font)
+        ? font->loadFromMemory(packed->data, packed->size, fontSize)
+        : font->load(fontPath, fontSize);
+    if (!loaded) {
+        return FontHandle();
+    }
+    
+    std::uint32_t index = static_cast<std::uint32_t>(fontSlots.size());
+    fontSlots.emplace_back();
+    fontSlots[index].font = std::move(font);
+    fontSlotsByKey[fontKey] = index;
+    return FontHandle{index, fontSlots[index].generation};
+}
+
+SDL_Texture* ResourceManager::getTexture(TextureHandle handle) {
+    TextureSlot* slot = findSlot(handle);
+    if (!slot) {
+        return nullptr; // Never issued or already released
+    }
+    
+    if (slot->texture) {
+        // Move to the front of the LRU list (no allocation, just relinks the node)
+        lruOrder.splice(lruOrder.begin(), lruOrder, slot->lruPosition);
+        cacheStats.hits++;
+        return slot->texture;
+    }
+    
+    // Evicted earlier - recreate from the slot's source
+    cacheStats.misses++;
+    SDL_Texture* texture = createSlotTexture(*slot);
+    if (!texture) {
+        return nullptr;
+    }
+    makeResident(handle.index, texture);
+    Logger::debug("Reloaded evicted texture: " + (slot->path.empty() ? slot->text : slot->path));
     return texture;
 }
 
+TextureRegion ResourceManager::getRegion(TextureHandle handle) {
+    TextureRegion region;
+    region.texture = getTexture(handle);
+    if (region.texture) {
+        region.handle = handle;
+        SDL_QueryTexture(region.texture, nullptr, nullptr, &region.rect.w, &region.rect.h);
+    }
+    return region;
+}
+
+Font* ResourceManager::getFont(FontHandle handle) const {
+    if (!handle.isValid() || handle.index >= fontSlots.size() || fontSlots[handle.index].generation != handle.generation) {
+        return nullptr;
+    }
+    return fontSlots[handle.index].font.get();
+}
+
+bool ResourceManager::isHandleValid(TextureHandle handle) const {
+    return findSlot(handle) != nullptr;
+}
+
+void ResourceManager::releaseTexture(TextureHandle handle) {
+    if (findSlot(handle)) {
+        releaseSlot(handle.index, true);
+    }
+}
+
+SDL_Texture* ResourceManager::loadTexture(const std::string& filePath) {
+    if (!m_valid) {
+        Logger::error("ResourceManager::loadTexture called on invalid ResourceManager");
+        return nullptr;
+    }
+    
+    if (filePath.empty()) {
+        Logger::error("ResourceManager::loadTexture called with empty file path");
+        return nullptr;
+    }
+    
+    // Already registered - resolve (reloads if it was evicted)
+    auto it = imageSlots.find(filePath);
+    if (it != imageSlots.end()) {
+        return getTexture(makeHandle(it->second));
+    }
+    
+    TextureHandle handle = acquireTexture(filePath);
+    return handle.isValid() ? textureSlots[handle.index].texture : nullptr;
+}
+
 SDL_Texture* ResourceManager::createTextTexture(const std::string& fontPath, int fontSize, const std::string& text, SDL_Color color) {
     if (!m_valid) {
         Logger::error("ResourceManager::createTextTexture called on invalid ResourceManager");
@@ -67,72 +233,247 @@ SDL_Texture* ResourceManager::createTextTexture(const std::string& fontPath, int
         return nullptr;
     }
     
-    std::string textKey = generateTextKey(fontPath, fontSize, text, color);
+    // Get or load font
+    FontHandle font = acquireFont(fontPath, fontSize);
+    if (!font.isValid()) {
+        Logger::error("Failed to get font for text texture: " + fontPath);
+        return nullptr;
+    }
+    
+    return getTexture(acquireTextTexture(font, text, color));
+}
+
+SDL_Texture* ResourceManager::createTextureFromSurface(const std::string& key, SDL_Surface* surface) {
+    if (!m_valid) {
+        Logger::error("ResourceManager::createTextureFromSurface called on invalid ResourceManager");
+        return nullptr;
+    }
+    
+    if (!surface) {
+        Logger::error("ResourceManager::createTextureFromSurface called with null surface: " + key);
+        return nullptr;
+    }
+    
+    // A synchronous load may have raced ahead of the async one
+    auto it = imageSlots.find(key);
+    if (it != imageSlots.end() && textureSlots[it->second].texture) {
+        return getTexture(makeHandle(it->second));
+    }
+    
+    SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
+    if (!texture) {
+        Logger::logSDLError(LogLevel::ERROR, "Failed to upload texture: " + key);
+        return nullptr;
+    }
+    
+    // Registered under the path, so after eviction it reloads like any other image
+    std::uint32_t index = it != imageSlots.end() ? it->second : allocateSlot();
+    textureSlots[index].path = key;
+    imageSlots[key] = index;
+    makeResident(index, texture);
+    Logger::debug("Uploaded texture: " + key);
+    return texture;
+}
+
+bool ResourceManager::buildAtlas(const std::string& atlasName, const std::vector<std::string>& imagePaths, int pageSize) {
+    PROFILE_ZONE("ResourceManager::buildAtlas");
+    if (!m_valid) {
+        Logger::error("ResourceManager::buildAtlas called on invalid ResourceManager");
+        return false;
+    }
     
-    // Check if text texture already exists and validate it
-    auto it = textures.find(textKey);
-    if (it != textures.end()) {
-        if (isTextureValid(it->second)) {
-            Logger::debug("Using cached text texture: " + text);
-            return it->second;
-        } else {
-            Logger::warning("Cached text texture is invalid, recreating: " + text);
-            textures.erase(it);
+    if (assetPack.isOpen()) {
+        // Wrap the mapped pixels as surfaces (no copy); anything not packed is decoded from disk
+        std::vector<std::pair<std::string, SDL_Surface*>> images;
+        for (const std::string& path : imagePaths) {
+            const AssetPackEntry* entry = assetPack.find(path);
+            SDL_Surface* surface = entry ? AsyncAssetLoader::wrapPackImage(*entry) : IMG_Load(path.c_str());
+            if (surface) {
+                images.emplace_back(path, surface);
+            } else {
+                Logger::logSDLImageError(LogLevel::ERROR, "Failed to load atlas image: " + path);
+            }
         }
+        
+        bool built = buildAtlas(atlasName, images, pageSize);
+        for (auto& image : images) {
+            SDL_FreeSurface(image.second);
+        }
+        return built;
     }
     
-    // Get or load font
-    Font* font = getFont(fontPath, fontSize);
-    if (!font) {
-        Logger::error("Failed to get font for text texture: " + fontPath);
+    auto atlas = std::make_unique<TextureAtlas>();
+    if (!atlas->build(renderer, imagePaths, pageSize)) {
+        Logger::warning("Failed to build atlas '" + atlasName + "', images will load as separate textures");
+        return false;
+    }
+    
+    atlases[atlasName] = std::move(atlas);
+    return true;
+}
+
+bool ResourceManager::buildAtlas(const std::string& atlasName, const std::vector<std::pair<std::string, SDL_Surface*>>& images, int pageSize) {
+    PROFILE_ZONE("ResourceManager::buildAtlas (upload)");
+    if (!m_valid) {
+        Logger::error("ResourceManager::buildAtlas called on invalid ResourceManager");
+        return false;
+    }
+    
+    auto atlas = std::make_unique<TextureAtlas>();
+    if (!atlas->build(renderer, images, pageSize)) {
+        Logger::warning("Failed to build atlas '" + atlasName + "', images will load as separate textures");
+        return false;
+    }
+    
+    atlases[atlasName] = std::move(atlas);
+    return true;
+}
+
+const TextureAtlas* ResourceManager::getAtlas(const std::string& atlasName) const {
+    auto it = atlases.find(atlasName);
+    return it != atlases.end() ? it->second.get() : nullptr;
+}
+
+void ResourceManager::addAtlas(const std::string& atlasName, std::unique_ptr<TextureAtlas> atlas) {
+    if (atlas) {
+        atlases[atlasName] = std::move(atlas);
+    }
+}
+
+TextureRegion ResourceManager::getTextureRegion(const std::string& filePath) {
+    for (const auto& pair : atlases) {
+        TextureRegion region = pair.second->find(filePath);
+        if (region.isValid()) {
+            return region;
+        }
+    }
+    
+    // Not packed - fall back to a standalone texture covering the whole image
+    auto it = imageSlots.find(filePath);
+    return getRegion(it != imageSlots.end() ? makeHandle(it->second) : acquireTexture(filePath));
+}
+
+AssetLoadHandle ResourceManager::loadTextureAsync(const std::string& filePath) {
+    return getAsyncLoader().requestImage(filePath);
+}
+
+AssetLoadHandle ResourceManager::buildAtlasAsync(const std::string& atlasName, const std::vector<std::string>& imagePaths, int pageSize) {
+    return getAsyncLoader().requestAtlas(atlasName, imagePaths, pageSize);
+}
+
+int ResourceManager::pumpAsyncUploads(double budgetMs) {
+    PROFILE_ZONE("ResourceManager::pumpAsyncUploads");
+    if (!asyncLoader || !m_valid) {
+        return 0;
+    }
+    return asyncLoader->pumpUploads(*this, budgetMs);
+}
+
+void ResourceManager::finishAsyncLoads() {
+    PROFILE_ZONE("ResourceManager::finishAsyncLoads");
+    if (!asyncLoader || !m_valid) {
+        return;
+    }
+    asyncLoader->finishAll(*this);
+}
+
+float ResourceManager::getAsyncLoadProgress() const {
+    return asyncLoader ? asyncLoader->getProgress() : 1.0f;
+}
+
+bool ResourceManager::hasPendingAsyncLoads() const {
+    return asyncLoader && !asyncLoader->isIdle();
+}
+
+AsyncAssetLoader& ResourceManager::getAsyncLoader() {
+    if (!asyncLoader) {
+        asyncLoader = std::make_unique<AsyncAssetLoader>(GameConfig::getInstance().getResourceConfig().loaderThreads);
+        if (assetPack.isOpen()) {
+            asyncLoader->setAssetPack(&assetPack);
+        }
+    }
+    return *asyncLoader;
+}
+
+SDL_Texture* ResourceManager::createPackTexture(const AssetPackEntry& entry) {
+    if (entry.type != AssetPackEntryType::Image) {
         return nullptr;
     }
     
-    // Create text texture
-    SDL_Texture* textTexture = font->renderText(renderer, text, color);
-    if (textTexture) {
-        textures[textKey] = textTexture;
-        Logger::debug("Created text texture: " + text);
-    } else {
-        Logger::error("Failed to create text texture for: " + text);
+    SDL_Texture* texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_STATIC, entry.width, entry.height);
+    if (!texture) {
+        Logger::logSDLError(LogLevel::ERROR, "Failed to create texture for packed image");
+        return nullptr;
+    }
+    
+    if (SDL_UpdateTexture(texture, nullptr, entry.data, entry.width * 4) != 0) {
+        Logger::logSDLError(LogLevel::ERROR, "Failed to upload packed image");
+        SDL_DestroyTexture(texture);
+        return nullptr;
     }
     
-    return textTexture;
+    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+    return texture;
 }
 
 Font* ResourceManager::getFont(const std::string& fontPath, int fontSize) {
+    return getFont(acquireFont(fontPath, fontSize));
+}
+
+GlyphAtlas* ResourceManager::getGlyphAtlas(const std::string& fontPath, int fontSize) {
+    if (!m_valid) {
+        Logger::error("ResourceManager::getGlyphAtlas called on invalid ResourceManager");
+        return nullptr;
+    }
+    
     std::string fontKey = generateFontKey(fontPath, fontSize);
     
-    // Check if font already loaded
-    auto it = fonts.find(fontKey);
-    if (it != fonts.end()) {
+    // Check if glyphs already rasterized
+    auto it = glyphAtlases.find(fontKey);
+    if (it != glyphAtlases.end()) {
         return it->second.get();
     }
     
-    // Load new font
-    auto font = std::make_unique<Font>();
-    if (!font->load(fontPath, fontSize)) {
+    Font* font = getFont(fontPath, fontSize);
+    if (!font) {
+        Logger::error("Failed to get font for glyph atlas: " + fontPath);
         return nullptr;
     }
     
-    // Cache the font and return raw pointer for API compatibility
-    Font* fontPtr = font.get();
-    fonts[fontKey] = std::move(font);
-    return fontPtr;
+    PROFILE_ZONE("ResourceManager::getGlyphAtlas (build)");
+    auto glyphs = std::make_unique<GlyphAtlas>();
+    if (!glyphs->build(renderer, *font)) {
+        Logger::error("Failed to build glyph atlas for: " + fontKey);
+        return nullptr;
+    }
+    
+    GlyphAtlas* glyphsPtr = glyphs.get();
+    glyphAtlases[fontKey] = std::move(glyphs);
+    Logger::debug("Built glyph atlas: " + fontKey);
+    return glyphsPtr;
 }
 
 void ResourceManager::cleanup() {
     Logger::info("ResourceManager cleaning up all resources");
-    // Clean up all textures
-    for (auto& pair : textures) {
-        if (pair.second) {
-            SDL_DestroyTexture(pair.second);
-        }
-    }
-    textures.clear();
+    // Stop workers first so nothing is uploaded into a half-destroyed cache
+    asyncLoader.reset();
+    
+    // Destroy all textures; outstanding handles go stale
+    releaseAllSlots(true);
+    
+    // Atlases destroy their own page textures
+    atlases.clear();
+    glyphAtlases.clear();
     
     // Clean up all fonts - unique_ptr handles deletion automatically
-    fonts.clear();
+    for (auto& slot : fontSlots) {
+        slot.font.reset();
+        slot.generation++;
+    }
+    fontSlotsByKey.clear();
+    
+    // Unmap last - packed fonts read from the mapping until they are closed
+    assetPack.close();
     Logger::debug("ResourceManager cleanup complete");
 }
 
@@ -140,44 +481,203 @@ void ResourceManager::clearCache() {
     Logger::info("ResourceManager clearing texture cache (keeping textures alive)");
     // Clear cache without destroying textures - useful for state resets
     // This allows textures to remain valid but forces reloading from disk
-    textures.clear();
-    fonts.clear();
+    releaseAllSlots(false);
+    for (auto& slot : fontSlots) {
+        slot.font.reset();
+        slot.generation++;
+    }
+    fontSlotsByKey.clear();
     Logger::debug("ResourceManager cache cleared");
 }
 
-bool ResourceManager::isTextureValid(SDL_Texture* texture) const {
-    if (!texture) {
-        return false;
+void ResourceManager::setTextureBudget(size_t budgetBytes) {
+    cacheStats.budgetBytes = budgetBytes;
+    evictToBudget(UINT32_MAX);
+}
+
+void ResourceManager::pinTexture(TextureHandle handle) {
+    if (TextureSlot* slot = findSlot(handle)) {
+        slot->pinCount++;
+    }
+}
+
+void ResourceManager::unpinTexture(TextureHandle handle) {
+    TextureSlot* slot = findSlot(handle);
+    if (slot && slot->pinCount > 0) {
+        slot->pinCount--;
     }
+}
 
-    return true;
+bool ResourceManager::isTexturePinned(TextureHandle handle) const {
+    const TextureSlot* slot = findSlot(handle);
+    return slot && slot->pinCount > 0;
+}
+
+SDL_Texture* ResourceManager::createSlotTexture(const TextureSlot& slot) {
+    // Every image load, text rasterization and reload after eviction comes through here
+    PROFILE_ZONE("ResourceManager::createSlotTexture");
+    if (!slot.path.empty()) {
+        // Straight from the pack when it has the image, otherwise decode the file
+        const AssetPackEntry* packed = assetPack.find(slot.path);
+        SDL_Texture* texture = packed ? createPackTexture(*packed) : IMG_LoadTexture(renderer, slot.path.c_str());
+        if (!texture) {
+            Logger::logSDLImageError(LogLevel::ERROR, "Failed to load texture: " + slot.path);
+        }
+        return texture;
+    }
     
-    // In Release builds, SDL_QueryTexture might behave differently
-    // For now, assume all non-null textures are valid to avoid cache invalidation
-    // This is safe because ResourceManager owns the textures and only destroys them in cleanup()
+    Font* font = getFont(slot.font);
+    return font ? font->renderText(renderer, slot.text, slot.color) : nullptr;
+}
+
+ResourceManager::TextureSlot* ResourceManager::findSlot(TextureHandle handle) {
+    if (!handle.isValid() || handle.index >= textureSlots.size()) {
+        return nullptr;
+    }
+    TextureSlot& slot = textureSlots[handle.index];
+    return (slot.registered && slot.generation == handle.generation) ? &slot : nullptr;
+}
+
+const ResourceManager::TextureSlot* ResourceManager::findSlot(TextureHandle handle) const {
+    if (!handle.isValid() || handle.index >= textureSlots.size()) {
+        return nullptr;
+    }
+    const TextureSlot& slot = textureSlots[handle.index];
+    return (slot.registered && slot.generation == handle.generation) ? &slot : nullptr;
+}
+
+std::uint32_t ResourceManager::allocateSlot() {
+    std::uint32_t index;
+    if (!freeTextureSlots.empty()) {
+        index = freeTextureSlots.back();
+        freeTextureSlots.pop_back();
+    } else {
+        index = static_cast<std::uint32_t>(textureSlots.size());
+        textureSlots.emplace_back();
+    }
+    textureSlots[index].registered = true;
+    return index;
+}
+
+TextureHandle ResourceManager::makeHandle(std::uint32_t index) const {
+    return TextureHandle{index, textureSlots[index].generation};
+}
+
+void ResourceManager::makeResident(std::uint32_t index, SDL_Texture* texture) {
+    TextureSlot& slot = textureSlots[index];
+    lruOrder.push_front(index);
+    slot.texture = texture;
+    slot.bytes = estimateTextureBytes(texture);
+    slot.lruPosition = lruOrder.begin();
+    cacheStats.liveTextures++;
+    cacheStats.liveBytes += slot.bytes;
     
-    /* Original validation code - disabled due to Release build issues
-    // Try to query the texture - if it's been destroyed, this will fail
-    int w, h;
-    Uint32 format;
-    int access;
-    int result = SDL_QueryTexture(texture, &format, &access, &w, &h);
+    evictToBudget(index);
+}
+
+void ResourceManager::evictSlot(std::uint32_t index, bool destroy) {
+    TextureSlot& slot = textureSlots[index];
+    if (!slot.texture) {
+        return;
+    }
     
-    if (result != 0) {
-        Logger::warning("Texture validation failed: " + std::string(SDL_GetError()));
-        return false;
+    cacheStats.liveTextures--;
+    cacheStats.liveBytes -= slot.bytes;
+    lruOrder.erase(slot.lruPosition);
+    if (destroy) {
+        SDL_DestroyTexture(slot.texture);
+    }
+    slot.texture = nullptr;
+    slot.bytes = 0;
+}
+
+void ResourceManager::releaseSlot(std::uint32_t index, bool destroy) {
+    evictSlot(index, destroy);
+    
+    TextureSlot& slot = textureSlots[index];
+    if (!slot.path.empty()) {
+        imageSlots.erase(slot.path);
+    } else {
+        TextKey key{slot.font.index, packColor(slot.color), slot.text};
+        textSlots.erase(key);
     }
     
-    return true;
-    */
+    // Bumping the generation is what turns outstanding handles stale
+    std::uint32_t generation = slot.generation + 1;
+    slot = TextureSlot();
+    slot.generation = generation == 0 ? 1 : generation;
+    freeTextureSlots.push_back(index);
+}
+
+void ResourceManager::releaseAllSlots(bool destroy) {
+    for (std::uint32_t index = 0; index < textureSlots.size(); ++index) {
+        if (textureSlots[index].registered) {
+            releaseSlot(index, destroy);
+        }
+    }
+    lruOrder.clear();
+    cacheStats.liveTextures = 0;
+    cacheStats.liveBytes = 0;
+}
+
+void ResourceManager::evictToBudget(std::uint32_t keepIndex) {
+    // Walk from least recently used; pinned textures and the one just handed out stay
+    auto it = lruOrder.end();
+    while (cacheStats.liveBytes > cacheStats.budgetBytes && it != lruOrder.begin()) {
+        --it;
+        std::uint32_t index = *it;
+        const TextureSlot& slot = textureSlots[index];
+        if (slot.pinCount > 0 || index == keepIndex) {
+            continue;
+        }
+        
+        it = std::next(it); // evictSlot invalidates the current node
+        Logger::debug("Evicting texture from cache: " + (slot.path.empty() ? slot.text : slot.path));
+        evictSlot(index, true);
+        cacheStats.evictions++;
+    }
+    
+    if (cacheStats.liveBytes > cacheStats.budgetBytes) {
+        Logger::warning("Texture cache over budget with only pinned textures left (" +
+                        std::to_string(cacheStats.liveBytes) + " / " + std::to_string(cacheStats.budgetBytes) + " bytes)");
+    }
+}
+
+size_t ResourceManager::estimateTextureBytes(SDL_Texture* texture) {
+    Uint32 format = 0;
+    int w = 0;
+    int h = 0;
+    if (!texture || SDL_QueryTexture(texture, &format, nullptr, &w, &h) != 0) {
+        return 0;
+    }
+    
+    int bytesPerPixel = SDL_BYTESPERPIXEL(format);
+    if (bytesPerPixel <= 0) {
+        bytesPerPixel = 4; // YUV and other planar formats - assume 32-bit
+    }
+    return static_cast<size_t>(w) * static_cast<size_t>(h) * static_cast<size_t>(bytesPerPixel);
 }
 
 std::string ResourceManager::generateFontKey(const std::string& fontPath, int fontSize) const {
     return fontPath + "_" + std::to_string(fontSize);
 }
 
-std::string ResourceManager::generateTextKey(const std::string& fontPath, int fontSize, const std::string& text, SDL_Color color) const {
-    return fontPath + "_" + std::to_string(fontSize) + "_" + text + "_" + 
-           std::to_string(color.r) + "_" + std::to_string(color.g) + "_" + 
-           std::to_string(color.b) + "_" + std::to_string(color.a);
-}
\ No newline at end of file
+size_t ResourceManager::TextKeyHash::operator()(const TextKey& key) const {
+    std::uint64_t mixed = (static_cast<std::uint64_t>(key.font) << 32) | key.color;
+    size_t hash = std::hash<std::string>()(key.text);
+    hash ^= static_cast<size_t>(mixed * 0x9e3779b97f4a7c15ULL) + (hash << 6) + (hash >> 2);
+    return hash;
+}
+
+ScopedTexturePins::ScopedTexturePins(ResourceManager& resourceManager, std::initializer_list<TextureHandle> textures)
+    : resourceManager(resourceManager), textures(textures) {
+    for (TextureHandle texture : this->textures) {
+        resourceManager.pinTexture(texture);
+    }
+}
+
+ScopedTexturePins::~ScopedTexturePins() {
+    for (TextureHandle texture : textures) {
+        resourceManager.unpinTexture(texture);
+    }
+}
@@ -1,35 +1,54 @@
 #include "RhythmGame.hpp"
 #include "GameConfig.hpp"
+#include "Logger.hpp"
+#include "Profiler.hpp"
 
 #include <iostream>
 #include <sstream>
 #include <iomanip>
 #include <cmath>
+#include <algorithm>
+#include <cstdio>
 #include <cstdlib>
-#include <SDL_mixer.h>
+#include <random>
+
+namespace {
+    // Draw order for the gameplay sprite batch (lower layers draw first)
+    enum RenderLayer {
+        LayerBackground = 0,
+        LayerFish,
+        LayerHitText,
+        LayerBoat,
+        LayerHook,
+        LayerFisher,
+        LayerHud
+    };
+}
+
+double AudioSongClock::songTimeMs() {
+    // The music position is -1 when SDL_mixer cannot report it; the clock then runs on host time
+    const MusicPosition position = m_audio.getMusicPosition();
+    return m_songClock.update(SongClock::hostTimeMs(), position.positionMs, position.hostMs);
+}
 
 RhythmGame::RhythmGame() 
     : m_resourceManager(nullptr)
     , m_gameStats(nullptr)
-    , m_songStartTime(0)
-    , m_lastFrameTime(0)
-    , m_targetFrameTime(0)
+    , m_clockSource(m_songClock, m_audioPlayer)
+    , m_musicState(m_audioPlayer)
+    , m_inputLatencyCount(0)
+    , m_inputLatencySumMs(0.0)
+    , m_inputLatencyMaxMs(0.0)
     , m_ocean(0, 0, nullptr)
     , m_scoreLabel(0, 0, nullptr)
-    , m_scoreNumber(0, 0, nullptr)
     , m_fisher(0, 0, nullptr, 1, 2)
     , m_boat(0, 0, nullptr, 1, 1)
     , m_hook(0, 0, nullptr, 1, 1)
-    , m_throwDuration(0)
-    , m_hookTargetX(0)
-    , m_hookTargetY(0)
-    , m_perfectHitTexture(nullptr)
-    , m_goodHitTexture(nullptr)
+    , m_scoreGlyphs(nullptr)
     , m_lastScore(-1)
 {
-    m_fishTextures[0] = nullptr;
-    m_fishTextures[1] = nullptr;
-    m_fishTextures[2] = nullptr;
+    m_simulation.setClock(&m_clockSource);
+    m_simulation.setMusicState(&m_musicState);
 }
 
 RhythmGame::~RhythmGame() {
@@ -37,44 +56,91 @@ RhythmGame::~RhythmGame() {
 }
 
 void RhythmGame::initialize(RenderWindow& window, ResourceManager& resourceManager, GameStats& stats) {
+    PROFILE_ZONE("RhythmGame::initialize");
     m_resourceManager = &resourceManager;
     m_gameStats = &stats;
     
-    auto& config = GameConfig::getInstance();
-    config.initializeBeatTimings();
-    
-    const auto& gameplayConfig = config.getGameplayConfig();
-    
-    // Initialize timing
-    m_songStartTime = SDL_GetTicks();
-    m_noteHitFlags.assign(gameplayConfig.numBeats * 2, false);
-    
-    // Initialize frame timing (60 FPS target)
-    m_targetFrameTime = SDL_GetPerformanceFrequency() / 20;
-    m_lastFrameTime = SDL_GetPerformanceCounter();
+    // Upload whatever gameplay images the menu did not get to (usually nothing)
+    resourceManager.finishAsyncLoads();
     
-    // Initialize animation system
-    m_animationSystem.initialize();
-    
-    // Clear fish hit tracking data from previous game
-    m_fishHits.clear();
-    m_fishHitTimes.clear();
-    m_fishHitTypes.clear();
+    auto& config = GameConfig::getInstance();
+    if (!config.initializeBeatTimings()) {
+        Logger::warning("Starting song without notes");
+    }
     
-    // Initialize animation parameters
-    m_throwDuration = gameplayConfig.throwDuration;
-    m_hookTargetX = gameplayConfig.hookTargetX;
-    m_hookTargetY = gameplayConfig.hookTargetY;
-    m_hookAnimationState.throwDuration = m_throwDuration;
+    m_pendingPresses.clear();
+    m_inputLatencyCount = 0;
+    m_inputLatencySumMs = 0.0;
+    m_inputLatencyMaxMs = 0.0;
     
     // Initialize textures and entities
+    unpinTextures();
     initializeTextures();
     initializeEntities();
-    initializeFish();
     
-    // Start music
+    // Fish variants come from a recorded seed so a replay can rebuild the same song
+    const std::uint32_t seed = std::random_device{}();
+    m_simulation.reset(makeSimulationConfig(window, seed));
+    *m_gameStats = m_simulation.getStats();
+    
+    // Hit sounds are loaded before the song so a hit only has to start a channel
     const auto& audioConfig = config.getAudioConfig();
-    m_audioPlayer.playBackgroundMusic(audioConfig.backgroundMusicPath);
+    if (!m_soundEffects.initialize(audioConfig.sfxVoices)) {
+        Logger::warning("Playing without hit sounds");
+    }
+    
+    // Start music (already decoded if prepareSong ran during the menu)
+    m_audioPlayer.playBackgroundMusic(getSongMusicPath());
+    m_songClock.setOutputLatencyMs(m_audioPlayer.getOutputLatencyMs());
+    m_songClock.start(SongClock::hostTimeMs());
+}
+
+SimulationConfig RhythmGame::makeSimulationConfig(const RenderWindow& window, std::uint32_t seed) {
+    const auto& config = GameConfig::getInstance();
+    const auto& gameplayConfig = config.getGameplayConfig();
+    const Chart& chart = config.getChart();
+    
+    AudioLogic rhythmLogic;
+    SimulationConfig simConfig;
+    simConfig.noteTimesMs = gameplayConfig.noteBeats;
+    simConfig.seed = seed;
+    simConfig.perfectWindowMs = rhythmLogic.getPERFECT();
+    simConfig.goodWindowMs = rhythmLogic.getGOOD();
+    simConfig.inputOffsetMs = config.getAudioConfig().inputOffsetMs;
+    simConfig.stepMs = gameplayConfig.simulationStepMs;
+    simConfig.maxSteps = gameplayConfig.maxSimulationSteps;
+    simConfig.fishSpeed = chart.getScrollSpeed() > 0.0 ? chart.getScrollSpeed() : gameplayConfig.fishSpeed;
+    simConfig.fishTargetX = gameplayConfig.fishTargetX;
+    simConfig.fishY = gameplayConfig.fishY;
+    simConfig.fishFrameMs = gameplayConfig.fishFrameMs;
+    simConfig.fishVariants = gameplayConfig.numFishTextures;
+    simConfig.culler = window.getCuller();
+    simConfig.throwDuration = gameplayConfig.throwDuration;
+    
+    // Each variant culls with its own frame size; sway is added to where initializeEntities placed the sprites
+    for (Sprite& sprite : m_fishSprites) {
+        SDL_Rect frame = sprite.getCurrentFrame();
+        simConfig.fishFrameSizes.push_back({frame.w, frame.h});
+    }
+    
+    simConfig.fisherPosition = {static_cast<int>(m_fisher.getX()), static_cast<int>(m_fisher.getY())};
+    simConfig.boatPosition = {static_cast<int>(m_boat.getX()), static_cast<int>(m_boat.getY())};
+    simConfig.hookPosition = {static_cast<int>(m_hook.getX()), static_cast<int>(m_hook.getY())};
+    return simConfig;
+}
+
+void RhythmGame::prepareSong() {
+    PROFILE_ZONE("RhythmGame::prepareSong");
+    if (!GameConfig::getInstance().initializeBeatTimings()) {
+        return; // initialize() reports it
+    }
+    m_audioPlayer.preloadMusic(getSongMusicPath());
+}
+
+std::string RhythmGame::getSongMusicPath() const {
+    const auto& config = GameConfig::getInstance();
+    const std::string& chartMusic = config.getChart().getMusicPath();
+    return chartMusic.empty() ? config.getAudioConfig().backgroundMusicPath : chartMusic;
 }
 
 void RhythmGame::initializeTextures() {
@@ -83,14 +149,21 @@ void RhythmGame::initializeTextures() {
     const auto& fontSizes = config.getFontSizes();
     const auto& visualConfig = config.getVisualConfig();
     
-    // Load fish textures
-    m_fishTextures[0] = m_resourceManager->loadTexture(assetPaths.blueFishTexture);
-    m_fishTextures[1] = m_resourceManager->loadTexture(assetPaths.greenFishTexture);
-    m_fishTextures[2] = m_resourceManager->loadTexture(assetPaths.goldFishTexture);
+    // Look up fish sheets (atlas regions when the sprite atlas was built)
+    m_fishTextures[0] = m_resourceManager->getTextureRegion(assetPaths.blueFishTexture);
+    m_fishTextures[1] = m_resourceManager->getTextureRegion(assetPaths.greenFishTexture);
+    m_fishTextures[2] = m_resourceManager->getTextureRegion(assetPaths.goldFishTexture);
     
     // Load hit feedback textures
-    m_perfectHitTexture = m_resourceManager->createTextTexture(assetPaths.fontPath, fontSizes.hitFeedback, "1000", visualConfig.RED);
-    m_goodHitTexture = m_resourceManager->createTextTexture(assetPaths.fontPath, fontSizes.hitFeedback, "500", visualConfig.RED);
+    FontHandle feedbackFont = m_resourceManager->acquireFont(assetPaths.fontPath, fontSizes.hitFeedback);
+    m_perfectHitText = m_resourceManager->getRegion(m_resourceManager->acquireTextTexture(feedbackFont, "1000", visualConfig.RED));
+    m_goodHitText = m_resourceManager->getRegion(m_resourceManager->acquireTextTexture(feedbackFont, "500", visualConfig.RED));
+    
+    pinTexture(m_perfectHitText.handle);
+    pinTexture(m_goodHitText.handle);
+    for (const auto& region : m_fishTextures) {
+        pinTexture(region.handle);
+    }
 }
 
 void RhythmGame::initializeEntities() {
@@ -99,284 +172,214 @@ void RhythmGame::initializeEntities() {
     const auto& fontSizes = config.getFontSizes();
     const auto& visualConfig = config.getVisualConfig();
     
-    // Load textures
-    SDL_Texture* oceanTexture = m_resourceManager->loadTexture(assetPaths.oceanTexture);
-    SDL_Texture* boatTexture = m_resourceManager->loadTexture(assetPaths.boatTexture);
-    SDL_Texture* fisherTexture = m_resourceManager->loadTexture(assetPaths.fisherTexture);
-    SDL_Texture* hookTexture = m_resourceManager->loadTexture(assetPaths.hookTexture);
-    SDL_Texture* scoreTexture = m_resourceManager->createTextTexture(assetPaths.fontPath, fontSizes.gameScore, "SCORE", visualConfig.BLACK);
-    SDL_Texture* numberTexture = m_resourceManager->createTextTexture(assetPaths.fontPath, fontSizes.gameNumbers, "000000", visualConfig.BLACK);
+    // Look up textures (atlas regions share one page, so these draw without texture switches)
+    TextureRegion oceanTexture = m_resourceManager->getTextureRegion(assetPaths.oceanTexture);
+    TextureRegion boatTexture = m_resourceManager->getTextureRegion(assetPaths.boatTexture);
+    TextureRegion fisherTexture = m_resourceManager->getTextureRegion(assetPaths.fisherTexture);
+    TextureRegion hookTexture = m_resourceManager->getTextureRegion(assetPaths.hookTexture);
+    FontHandle scoreFont = m_resourceManager->acquireFont(assetPaths.fontPath, fontSizes.gameScore);
+    TextureRegion scoreTexture = m_resourceManager->getRegion(m_resourceManager->acquireTextTexture(scoreFont, "SCORE", visualConfig.BLACK));
+    m_scoreGlyphs = m_resourceManager->getGlyphAtlas(assetPaths.fontPath, fontSizes.gameNumbers);
+    
+    pinTexture(oceanTexture.handle);
+    pinTexture(boatTexture.handle);
+    pinTexture(fisherTexture.handle);
+    pinTexture(hookTexture.handle);
+    pinTexture(scoreTexture.handle);
+    m_scoreText = formatScore(0);
+    m_lastScore = -1;
     
     // Initialize entities
     m_ocean = Entity(0, 0, oceanTexture);
     m_scoreLabel = Entity(1720, 100, scoreTexture);
-    m_scoreNumber = Entity(1720, 150, numberTexture);
     m_fisher = Sprite(300, 200, fisherTexture, 1, 2);
     m_boat = Sprite(150, 350, boatTexture, 1, 1);
     m_hook = Sprite(430, 215, hookTexture, 1, 1);
     
-    // Store base positions for sway effect
-    m_fisherBasePosition = {300, 200};
-    m_boatBasePosition = {150, 350};
-    m_hookBasePosition = {430, 215};
-}
-
-void RhythmGame::initializeFish() {
-    const auto& config = GameConfig::getInstance();
-    const auto& gameplayConfig = config.getGameplayConfig();
-    
-    m_fish.clear();
-    m_fish.reserve(gameplayConfig.numBeats);
-    m_fishBasePositions.clear();
-    m_fishBasePositions.reserve(gameplayConfig.numBeats);
-    
-    for (int i = 0; i < gameplayConfig.numBeats; ++i) {
-        int baseX = gameplayConfig.fishStartXLocations[i];
-        int baseY = 720;
-        
-        m_fish.emplace_back(Sprite(baseX, baseY, m_fishTextures[rand() % gameplayConfig.numFishTextures], 1, 6));
-        m_fishBasePositions.emplace_back(baseX, baseY);
+    // Fish are drawn from one sprite per variant, moved to each fish's snapshot position
+    const int fishY = config.getGameplayConfig().fishY;
+    m_fishSprites.clear();
+    for (const auto& region : m_fishTextures) {
+        m_fishSprites.emplace_back(Sprite(0, fishY, region, 1, 6));
     }
 }
 
-bool RhythmGame::update(InputAction action, InputHandler& inputHandler) {
-    const auto& config = GameConfig::getInstance();
-    const auto& visualConfig = config.getVisualConfig();
+bool RhythmGame::update(const InputEvent& input, InputHandler& inputHandler) {
+    PROFILE_ZONE("RhythmGame::update");
+    const InputAction action = input.action;
     
     // Handle input state
     if (action == InputAction::Quit || action == InputAction::Escape) {
         return false; // Game should end (ESC or window close)
     }
     
-    // Update animation timing with current performance counter
-    Uint64 currentPerformanceTime = SDL_GetPerformanceCounter();
-    m_animationSystem.updateTiming(currentPerformanceTime);
-    
-    double currentTime = getCurrentGameTimeMs();
-    
-    // Handle rhythm input - simplified logic
+    // Presses are queued at the song time the key went down, so frame time is not added to the error
     if (action == InputAction::Select) {
-        handleRhythmInput(currentTime);
+        double currentTime = m_clockSource.songTimeMs();
+        double pressTime = currentTime;
+        if (input.timestampMs >= 0.0) {
+            pressTime = std::min(m_songClock.toSongTime(input.timestampMs), currentTime);
+            
+            double latencyMs = SongClock::hostTimeMs() - input.timestampMs;
+            m_inputLatencyCount++;
+            m_inputLatencySumMs += latencyMs;
+            m_inputLatencyMaxMs = std::max(m_inputLatencyMaxMs, latencyMs);
+        }
+        m_pendingPresses.push_back(pressTime);
     }
     
-    // Only do these updates when no specific action is being processed
-    // (to avoid duplicate work when processing multiple events per frame)
+    // Only step once per frame, not once per event
     if (action == InputAction::None) {
-        // Check for missed notes
-        checkMissedNotes(currentTime);
+        // Judge queued presses, resolve misses and run the fixed-step simulation up to the song clock
+        const RenderSnapshot& snapshot = m_simulation.update(m_pendingPresses);
+        m_pendingPresses.clear();
         
-        // Update score display
+        playHitSounds(snapshot);
+        *m_gameStats = m_simulation.getStats();
         updateScore();
         
-        // Update animations and fish movement
-        updateAnimations();
-        updateFishMovement();
-        
         // Check if game should end (music stopped)
-        if (Mix_PlayingMusic() == 0) {
+        if (m_simulation.isFinished()) {
             return false;
         }
-        
-        // Maintain consistent frame rate (only when no input events)
-        Uint64 currentFrameTime = SDL_GetPerformanceCounter();
-        Uint64 frameTime = currentFrameTime - m_lastFrameTime;
-        
-        if (frameTime < m_targetFrameTime) {
-            Uint32 delayMs = (Uint32)((m_targetFrameTime - frameTime) * 1000 / SDL_GetPerformanceFrequency());
-            SDL_Delay(delayMs);
-        }
-        m_lastFrameTime = SDL_GetPerformanceCounter();
     }
     
     return true; // Continue game
 }
 
-
-void RhythmGame::handleRhythmInput(double currentTime) {
-    const auto& config = GameConfig::getInstance();
-    const auto& gameplayConfig = config.getGameplayConfig();
-    const std::vector<double>& noteBeats = gameplayConfig.noteBeats;
-    
-    // Handle hook throwing
-    if (!m_hookAnimationState.isThrowing) {
-        // Start fisher animation
-        m_animationSystem.startFisherThrow(m_fisherAnimationState);
-        
-        // Start hook throwing
-        m_hookAnimationState.isThrowing = true;
-        m_hookAnimationState.isReturning = false;
-        m_hookAnimationState.throwStartTime = SDL_GetTicks();
-        
-        int handX = m_fisher.getX() + 135;
-        int handY = m_fisher.getY() + 50;
-        m_hookAnimationState.hookStartX = handX;
-        m_hookAnimationState.hookStartY = handY;
-        m_hookAnimationState.hookTargetX = handX + 300;
-        m_hookAnimationState.hookTargetY = handY + 475;
-    }
-    
-    // Check rhythm timing
-    for (int i = 0; i < noteBeats.size(); ++i) {
-        // Skip notes that have already been hit
-        if (m_noteHitFlags[i]) continue;
-        
-        double expected = noteBeats[i];
-        double delta = fabs(currentTime - expected);
-        
-        if (delta <= m_rhythmLogic.getGOOD()) {
-            short int scoreType = m_rhythmLogic.checkHit(expected, currentTime);
-            m_noteHitFlags[i] = true;
-            m_fishHits.insert(i);
-            m_fishHitTimes[i] = SDL_GetTicks();
-            
-            if (scoreType == 2) { // Perfect
-                (*m_gameStats)++;
-                m_gameStats->increaseScore(1000);
-                m_fishHitTypes[i] = true;
-            }
-            else if (scoreType == 1) { // Good
-                (*m_gameStats)++;
-                m_gameStats->increaseScore(500);
-                m_fishHitTypes[i] = false;
-            }
-            break;
-        }
-    }
-}
-
-void RhythmGame::checkMissedNotes(double currentTime) {
-    const auto& config = GameConfig::getInstance();
-    const auto& gameplayConfig = config.getGameplayConfig();
-    const std::vector<double>& noteBeats = gameplayConfig.noteBeats;
-    
-    for (int i = 0; i < noteBeats.size(); ++i) {
-        if (m_noteHitFlags[i]) continue;
-        
-        double noteTime = noteBeats[i];
-        if (currentTime > noteTime + m_rhythmLogic.getGOOD()) {
-            (*m_gameStats)--;
-            m_noteHitFlags[i] = true;
-        }
+void RhythmGame::playHitSounds(const RenderSnapshot& snapshot) {
+    for (const JudgementResult& hit : snapshot.hits) {
+        m_soundEffects.play(hit.judgement == Judgement::Perfect ? SoundId::HitPerfect : SoundId::HitGood);
     }
 }
 
 void RhythmGame::updateScore() {
-    int currentScore = m_gameStats->getScore();
+    int currentScore = m_simulation.getSnapshot().score;
     if (currentScore != m_lastScore) {
-        const auto& config = GameConfig::getInstance();
-        const auto& assetPaths = config.getAssetPaths();
-        const auto& fontSizes = config.getFontSizes();
-        const auto& visualConfig = config.getVisualConfig();
-        
-        std::string strNum = formatScore(currentScore);
-        SDL_Texture* numberTexture = m_resourceManager->createTextTexture(assetPaths.fontPath, fontSizes.gameNumbers, strNum, visualConfig.BLACK);
-        m_scoreNumber.setTexture(numberTexture);
+        // No texture work here - the glyph atlas already holds every digit
+        m_scoreText = formatScore(currentScore);
         m_lastScore = currentScore;
     }
 }
 
-void RhythmGame::updateAnimations() {
-    // Update fisher animation
-    m_animationSystem.updateFisherAnimation(m_fisher, m_fisherAnimationState);
-    
-    // Update hook animation
-    m_animationSystem.updateHookAnimation(m_hook, m_hookAnimationState);
-    
-    // Update sway effects
-    m_animationSystem.updateHookSway(m_hook, m_hookBasePosition, m_hookAnimationState);
-    m_animationSystem.updateSwayEffects(m_boat, m_boatBasePosition);
-    m_animationSystem.updateSwayEffects(m_fisher, m_fisherBasePosition);
-    m_animationSystem.updateSwayEffects(m_fish, m_fishBasePositions);
-}
-
-void RhythmGame::updateFishMovement() {
-    const auto& config = GameConfig::getInstance();
-    const auto& gameplayConfig = config.getGameplayConfig();
-    
-    // Move fish (only if not hit)
-    for (int i = 0; i < gameplayConfig.numBeats; i++) {
-        if (m_fishHits.count(i)) {
-            continue; // Skip hit fish
-        }
-        
-        // Move fish left (same as original)
-        m_fish[i].moveLeft(10);
-        
-        // Update base position after movement (for sway effects)
-        m_fishBasePositions[i].first = m_fish[i].getX();
-        m_fishBasePositions[i].second = m_fish[i].getY();
-    }
-    
-    // Animate fish frames using animation system (for all fish including hit ones)
-    // The animation system will handle the frame updates
-    for (int i = 0; i < gameplayConfig.numBeats; i++) {
-        if (!m_fishHits.count(i)) {
-            m_fish[i]++;
-            if (m_fish[i].getCol() == 4) {
-                m_fish[i].resetFrame();
-            }
-        }
-    }
-}
-
-
-
-
 void RhythmGame::render(RenderWindow& window) {
+    PROFILE_ZONE("RhythmGame::render");
+    // The snapshot is already interpolated between the last two simulation steps
+    const RenderSnapshot& snapshot = m_simulation.getSnapshot();
+    m_fisher.setLoc(snapshot.fisher.x, snapshot.fisher.y);
+    m_fisher.setFrame(1, snapshot.fisher.column);
+    m_boat.setLoc(snapshot.boat.x, snapshot.boat.y);
+    m_hook.setLoc(snapshot.hook.x, snapshot.hook.y);
+    
     window.clear();
+    window.getPerfOverlay().setClockDriftMs(m_songClock.getDriftMs());
     
-    // Render background
-    window.render(m_ocean);
+    // Everything is queued into the sprite batch and drawn one call per (layer, texture)
+    window.submit(m_ocean, LayerBackground);
     
-    // Render fish with hit feedback
-    Uint32 currentTicks = SDL_GetTicks();
-    renderFish(window, currentTicks);
+    // Fish with hit feedback
+    renderFish(window, snapshot);
     
-    // Render game objects
-    window.render(m_boat);
-    window.render(m_hook);
-    window.render(m_fisher);
-    window.render(m_scoreLabel);
-    window.render(m_scoreNumber);
+    // Game objects
+    window.submit(m_boat, LayerBoat);
+    window.submit(m_hook, LayerHook);
+    window.submit(m_fisher, LayerFisher);
+    window.submit(m_scoreLabel, LayerHud);
+    
+    // Glyph text flushes the batch first, so it lands on top
+    if (m_scoreGlyphs) {
+        window.renderText(*m_scoreGlyphs, m_scoreText, 1720, 150, GameConfig::getInstance().getVisualConfig().BLACK);
+    }
     
     window.display();
 }
 
-void RhythmGame::renderFish(RenderWindow& window, Uint32 currentTicks) {
-    const auto& config = GameConfig::getInstance();
-    const auto& gameplayConfig = config.getGameplayConfig();
-    
-    for (int i = 0; i < gameplayConfig.numBeats; i++) {
-        if (m_fishHits.count(i)) {
-            // Fish was hit - calculate time since hit
-            Uint32 timeSinceHit = currentTicks - m_fishHitTimes[i];
+void RhythmGame::renderFish(RenderWindow& window, const RenderSnapshot& snapshot) {
+    PROFILE_ZONE("RhythmGame::renderFish");
+    // The snapshot only holds what is on screen: popups and fish the simulation did not cull
+    for (const FishSnapshot& fish : snapshot.fish) {
+        if (fish.view == FishView::HitPopup) {
+            // Show score text instead of the caught fish
+            const TextureRegion& scoreText = fish.judgement == Judgement::Perfect ? m_perfectHitText : m_goodHitText;
+            
+            SDL_Rect textRect;
+            textRect.x = static_cast<int>(fish.x);
+            textRect.y = static_cast<int>(fish.y) - 30;
+            textRect.w = scoreText.rect.w;
+            textRect.h = scoreText.rect.h;
             
-            if (timeSinceHit < 1000) {
-                // Show score text instead of fish for 1 second
-                SDL_Texture* scoreTex = m_fishHitTypes[i] ? m_perfectHitTexture : m_goodHitTexture;
-                
-                SDL_Rect textRect;
-                textRect.x = m_fish[i].getX();
-                textRect.y = m_fish[i].getY() - 30;
-                SDL_QueryTexture(scoreTex, NULL, NULL, &textRect.w, &textRect.h);
-                
-                SDL_RenderCopy(window.getRenderer(), scoreTex, NULL, &textRect);
-            }
-            continue; // Skip rendering the fish itself
+            window.submit(m_resourceManager->getTexture(scoreText.handle), scoreText.rect, textRect, LayerHitText);
+        }
+        else if (fish.variant < static_cast<int>(m_fishSprites.size())) {
+            Sprite& sprite = m_fishSprites[fish.variant];
+            sprite.setLoc(fish.x, fish.y);
+            sprite.setFrame(1, snapshot.fishColumn);
+            window.submit(sprite, LayerFish);
         }
-        
-        // Render normal fish (movement happens in updateFishMovement)
-        window.render(m_fish[i]);
     }
 }
 
 bool RhythmGame::isGameOver(bool exitEarly) const {
-    return Mix_PlayingMusic() == 0 || exitEarly;
+    return !m_audioPlayer.isMusicPlaying() || exitEarly;
 }
 
 void RhythmGame::cleanup() {
     // Stop background music (like the original gameLoop does)
     m_audioPlayer.stopBackgroundMusic();
+    
+    const SongClockStats& clockStats = m_songClock.getStats();
+    char buffer[160];
+    snprintf(buffer, sizeof(buffer), "Song clock drift over %zu audio steps: mean %.2f ms, max %.2f ms, rate %.5f, %zu resyncs",
+             clockStats.samples, clockStats.meanErrorMs, clockStats.maxErrorMs, clockStats.rate, clockStats.resyncs);
+    Logger::info(buffer);
+    
+    if (m_inputLatencyCount > 0) {
+        snprintf(buffer, sizeof(buffer), "Input latency (event queued to judged) over %zu presses: avg %.2f ms, max %.2f ms",
+                 m_inputLatencyCount, m_inputLatencySumMs / m_inputLatencyCount, m_inputLatencyMaxMs);
+        Logger::info(buffer);
+    }
+    
+    const AudioDeviceSpec deviceSpec = m_audioPlayer.getDeviceSpec();
+    snprintf(buffer, sizeof(buffer), "Audio output: %d-frame buffer at %d Hz, %.1f ms latency, %zu underruns",
+             deviceSpec.bufferSamples, deviceSpec.frequency, deviceSpec.outputLatencyMs, m_audioPlayer.getUnderrunCount());
+    Logger::info(buffer);
+    
+    const SoundEffectStats& sfxStats = m_soundEffects.getStats();
+    if (sfxStats.played > 0 || sfxStats.failed > 0) {
+        snprintf(buffer, sizeof(buffer), "Hit sounds: %zu played, %zu voices stolen, %zu failed",
+                 sfxStats.played, sfxStats.stolen, sfxStats.failed);
+        Logger::info(buffer);
+    }
+    
+    const std::string& replayPath = GameConfig::getInstance().getGameplayConfig().replayPath;
+    if (!replayPath.empty()) {
+        m_simulation.finishReplay();
+        m_simulation.getReplay().saveToFile(replayPath);
+    }
+    
+    // Sounds belong to the current device, so release them before it may be reopened
+    m_soundEffects.shutdown();
+    m_audioPlayer.recoverFromUnderruns(); // Takes effect from the next song
+    
+    // Gameplay textures may be evicted again once we leave the song
+    unpinTextures();
+}
+
+void RhythmGame::pinTexture(TextureHandle texture) {
+    // Atlas regions carry no handle - their pages are never evicted
+    if (texture.isValid()) {
+        m_resourceManager->pinTexture(texture);
+        m_pinnedTextures.push_back(texture);
+    }
+}
+
+void RhythmGame::unpinTextures() {
+    if (m_resourceManager) {
+        for (TextureHandle texture : m_pinnedTextures) {
+            m_resourceManager->unpinTexture(texture);
+        }
+    }
+    m_pinnedTextures.clear();
 }
 
 std::string RhythmGame::formatScore(int score) {
@@ -384,14 +387,3 @@ std::string RhythmGame::formatScore(int score) {
     ss << std::setw(6) << std::setfill('0') << score;
     return ss.str();
 }
-
-double RhythmGame::getCurrentGameTimeMs() const {
-    // Try to get precise audio position first
-    double audioTimeMs = m_audioPlayer.getMusicPositionMs();
-    if (audioTimeMs >= 0.0) {
-        return audioTimeMs;
-    }
-    
-    // Fallback to SDL_GetTicks timing
-    return SDL_GetTicks() - m_songStartTime;
-}
\ No newline at end of file
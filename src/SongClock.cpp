@@ -0,0 +1,108 @@
+#include "SongClock.hpp"
+
+#include <SDL.h>
+
+#include <algorithm>
+#include <cmath>
+
+SongClock::SongClock()
+    : m_outputLatencyMs(0.0) {
+    start(0.0);
+}
+
+void SongClock::start(double hostMs) {
+    m_startHostMs = hostMs;
+    m_lastTimeMs = 0.0;
+    m_lastHostMs = hostMs;
+    m_lastAudioMs = -1.0;
+    m_sampleCount = 0;
+    m_sampleNext = 0;
+    m_fitHost = hostMs;
+    m_fitAudio = 0.0;
+    m_fitRate = 1.0;
+    m_hasFit = false;
+    m_stats = SongClockStats();
+    m_errorSumMs = 0.0;
+}
+
+double SongClock::update(double hostMs, double audioMs, double audioHostMs) {
+    // A new audio step: measure how far off the prediction was, then fold it into the fit
+    if (audioMs >= 0.0 && audioMs != m_lastAudioMs) {
+        m_lastAudioMs = audioMs;
+        audioMs -= m_outputLatencyMs; // Position being heard now
+        const double sampleHostMs = audioHostMs >= 0.0 ? audioHostMs : hostMs;
+        if (m_hasFit) {
+            double error = std::fabs(audioMs - predict(sampleHostMs));
+            if (error > kResyncThresholdMs) {
+                m_sampleCount = 0;
+                m_sampleNext = 0;
+                m_stats.resyncs++;
+            } else {
+                m_stats.samples++;
+                m_errorSumMs += error;
+                m_stats.meanErrorMs = m_errorSumMs / m_stats.samples;
+                m_stats.maxErrorMs = std::max(m_stats.maxErrorMs, error);
+            }
+        }
+        addSample(sampleHostMs, audioMs);
+        refit();
+    }
+
+    double timeMs = toSongTime(hostMs);
+    m_lastTimeMs = std::max(m_lastTimeMs, timeMs);
+    m_lastHostMs = hostMs;
+    return m_lastTimeMs;
+}
+
+double SongClock::toSongTime(double hostMs) const {
+    return m_hasFit ? predict(hostMs) : hostMs - m_startHostMs;
+}
+
+double SongClock::predict(double hostMs) const {
+    return m_fitAudio + m_fitRate * (hostMs - m_fitHost);
+}
+
+void SongClock::addSample(double hostMs, double audioMs) {
+    m_sampleHost[m_sampleNext] = hostMs;
+    m_sampleAudio[m_sampleNext] = audioMs;
+    m_sampleNext = (m_sampleNext + 1) % kWindowSize;
+    m_sampleCount = std::min(m_sampleCount + 1, kWindowSize);
+}
+
+void SongClock::refit() {
+    // Host times are taken relative to the newest sample so the sums stay well conditioned
+    const size_t newest = (m_sampleNext + kWindowSize - 1) % kWindowSize;
+    const double originHost = m_sampleHost[newest];
+
+    double meanX = 0.0;
+    double meanY = 0.0;
+    for (size_t i = 0; i < m_sampleCount; ++i) {
+        meanX += m_sampleHost[i] - originHost;
+        meanY += m_sampleAudio[i];
+    }
+    meanX /= m_sampleCount;
+    meanY /= m_sampleCount;
+
+    double covariance = 0.0;
+    double variance = 0.0;
+    for (size_t i = 0; i < m_sampleCount; ++i) {
+        double dx = m_sampleHost[i] - originHost - meanX;
+        covariance += dx * (m_sampleAudio[i] - meanY);
+        variance += dx * dx;
+    }
+
+    // One sample (or samples at one instant) gives no slope - assume real time
+    double rate = variance > 1e-6 ? covariance / variance : 1.0;
+    rate = std::min(std::max(rate, 1.0 - kMaxRateError), 1.0 + kMaxRateError);
+
+    m_fitHost = originHost;
+    m_fitAudio = meanY - rate * meanX;
+    m_fitRate = rate;
+    m_hasFit = true;
+    m_stats.rate = rate;
+}
+
+double SongClock::hostTimeMs() {
+    static const double msPerCount = 1000.0 / static_cast<double>(SDL_GetPerformanceFrequency());
+    return static_cast<double>(SDL_GetPerformanceCounter()) * msPerCount;
+}
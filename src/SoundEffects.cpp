@@ -0,0 +1,191 @@
+#include "SoundEffects.hpp"
+#include "GameConfig.hpp"
+#include "Logger.hpp"
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+namespace {
+
+constexpr double kPi = 3.14159265358979323846;
+
+// Synthesized fallbacks: a bright blip for Perfect, a lower one for Good
+const ToneSpec kPerfectTone = { 1320.0, 60.0, 15.0, 0.8 };
+const ToneSpec kGoodTone = { 880.0, 50.0, 12.0, 0.7 };
+
+} // namespace
+
+SoundEffects::SoundEffects()
+    : m_voices(0), m_ready(false) {
+}
+
+SoundEffects::~SoundEffects() {
+    shutdown();
+}
+
+bool SoundEffects::initialize(int voices) {
+    if (m_ready) {
+        return true;
+    }
+
+    int frequency = 0;
+    Uint16 format = 0;
+    int channels = 0;
+    if (Mix_QuerySpec(&frequency, &format, &channels) == 0) {
+        Logger::error("SoundEffects::initialize called without an open audio device");
+        return false;
+    }
+    if (voices <= 0) {
+        Logger::error("SoundEffects::initialize needs at least one voice");
+        return false;
+    }
+
+    // The pool is the first `voices` channels; reserving them keeps automatic channel picks off them
+    const int existing = Mix_AllocateChannels(-1);
+    if (Mix_AllocateChannels(existing + voices) != existing + voices) {
+        Logger::logSDLMixerError(LogLevel::ERROR, "Failed to allocate sound effect channels");
+        return false;
+    }
+    Mix_ReserveChannels(voices);
+    Mix_GroupChannels(0, voices - 1, kChannelGroup);
+    m_voices = voices;
+
+    const auto& config = GameConfig::getInstance();
+    const auto& assetPaths = config.getAssetPaths();
+    const int volume = config.getAudioConfig().sfxVolume;
+    if (!loadSound(SoundId::HitPerfect, assetPaths.perfectHitSoundPath, kPerfectTone, volume) ||
+        !loadSound(SoundId::HitGood, assetPaths.goodHitSoundPath, kGoodTone, volume)) {
+        m_ready = true; // Let shutdown release the channels and anything already loaded
+        shutdown();
+        return false;
+    }
+
+    m_stats = SoundEffectStats();
+    m_ready = true;
+    Logger::info("Sound effects ready on " + std::to_string(voices) + " voices");
+    return true;
+}
+
+void SoundEffects::shutdown() {
+    if (!m_ready) {
+        return;
+    }
+
+    Mix_HaltGroup(kChannelGroup);
+    for (Sound& sound : m_sounds) {
+        if (sound.chunk) {
+            Mix_FreeChunk(sound.chunk);
+            sound.chunk = nullptr;
+        }
+        sound.pcm.clear();
+    }
+
+    // Hand the channels back; any m_voices of them will do once they are untagged
+    Mix_GroupChannels(0, m_voices - 1, -1);
+    Mix_ReserveChannels(0);
+    const int total = Mix_AllocateChannels(-1);
+    if (total >= m_voices) {
+        Mix_AllocateChannels(total - m_voices);
+    }
+
+    m_voices = 0;
+    m_ready = false;
+}
+
+int SoundEffects::play(SoundId id) {
+    if (!m_ready) {
+        return -1;
+    }
+    Mix_Chunk* chunk = m_sounds[static_cast<size_t>(id)].chunk;
+
+    int channel = Mix_GroupAvailable(kChannelGroup);
+    if (channel < 0) {
+        // Every voice busy: cut off the one that has played longest
+        channel = Mix_GroupOldest(kChannelGroup);
+        if (channel >= 0) {
+            ++m_stats.stolen;
+        } else {
+            channel = Mix_GroupAvailable(kChannelGroup); // A voice finished in between
+        }
+    }
+
+    if (channel < 0 || Mix_PlayChannel(channel, chunk, 0) < 0) {
+        ++m_stats.failed; // No logging here - it would allocate on every failed hit
+        return -1;
+    }
+    ++m_stats.played;
+    return channel;
+}
+
+void SoundEffects::stopAll() {
+    if (m_ready) {
+        Mix_HaltGroup(kChannelGroup);
+    }
+}
+
+bool SoundEffects::loadSound(SoundId id, const std::string& filePath, const ToneSpec& fallback, int volume) {
+    Sound& sound = m_sounds[static_cast<size_t>(id)];
+
+    if (!filePath.empty()) {
+        sound.chunk = Mix_LoadWAV(filePath.c_str());
+        if (!sound.chunk) {
+            Logger::logSDLMixerError(LogLevel::WARNING, "Failed to load sound " + filePath + ", using a synthesized tone");
+        }
+    }
+
+    if (!sound.chunk) {
+        if (!synthesizeTone(fallback, sound.pcm)) {
+            return false;
+        }
+        sound.chunk = Mix_QuickLoad_RAW(sound.pcm.data(), static_cast<Uint32>(sound.pcm.size()));
+        if (!sound.chunk) {
+            Logger::logSDLMixerError(LogLevel::ERROR, "Failed to create synthesized sound");
+            sound.pcm.clear();
+            return false;
+        }
+    }
+
+    Mix_VolumeChunk(sound.chunk, volume);
+    return true;
+}
+
+bool SoundEffects::synthesizeTone(const ToneSpec& tone, std::vector<Uint8>& pcm) {
+    int frequency = 0;
+    Uint16 format = 0;
+    int channels = 0;
+    if (Mix_QuerySpec(&frequency, &format, &channels) == 0) {
+        Logger::logSDLMixerError(LogLevel::ERROR, "Failed to query audio format for a synthesized sound");
+        return false;
+    }
+
+    size_t sampleBytes = 0;
+    if (format == AUDIO_S16SYS) {
+        sampleBytes = sizeof(Sint16);
+    } else if (format == AUDIO_F32SYS) {
+        sampleBytes = sizeof(float);
+    } else {
+        Logger::error("Unsupported audio format for a synthesized sound: " + std::to_string(format));
+        return false;
+    }
+
+    // A decaying sine burst in whatever format the device was opened with
+    const int frames = static_cast<int>(frequency * tone.durationMs / 1000.0);
+    pcm.assign(static_cast<size_t>(frames) * channels * sampleBytes, 0);
+    Uint8* out = pcm.data();
+    for (int i = 0; i < frames; ++i) {
+        double t = static_cast<double>(i) / frequency;
+        double value = tone.volume * std::sin(2.0 * kPi * tone.toneHz * t) * std::exp(-t * 1000.0 / tone.decayMs);
+        for (int c = 0; c < channels; ++c) {
+            if (sampleBytes == sizeof(Sint16)) {
+                Sint16 sample = static_cast<Sint16>(value * 32767.0);
+                std::memcpy(out, &sample, sizeof(sample));
+            } else {
+                float sample = static_cast<float>(value);
+                std::memcpy(out, &sample, sizeof(sample));
+            }
+            out += sampleBytes;
+        }
+    }
+    return true;
+}
@@ -11,14 +11,22 @@ Sprite::Sprite(float x, float y, SDL_Texture* texture, int maxRow, int maxCol) :
 	currentFrame.w = frameWidth;
 	currentFrame.h = frameHeight;
 }
+Sprite::Sprite(float x, float y, const TextureRegion& region, int maxRow, int maxCol) : Entity(x, y, region), maxRow(maxRow), maxCol(maxCol), row(1), col(1)
+{
+	frameWidth = region.rect.w / maxCol;
+	frameHeight = region.rect.h / maxRow;
+
+	currentFrame.w = frameWidth;
+	currentFrame.h = frameHeight;
+}
 void Sprite::setFrame(int row, int col)
 {
 	if (row >= 1 && row <= maxRow && col >= 1 && col <= maxCol)
 	{
 		this->row = row;
 		this->col = col;
-		currentFrame.x = (this->col - 1) * frameWidth;
-		currentFrame.y = (this->row - 1) * frameHeight;
+		currentFrame.x = regionOrigin_.x + (this->col - 1) * frameWidth;
+		currentFrame.y = regionOrigin_.y + (this->row - 1) * frameHeight;
 	}
 }
 Sprite Sprite::operator++(int)
@@ -0,0 +1,91 @@
+#include "SpriteBatch.hpp"
+#include "Logger.hpp"
+
+#include <algorithm>
+#include <functional>
+
+void SpriteBatch::submit(SDL_Texture* texture, const SDL_Rect& src, const SDL_FRect& dst, SDL_Color color, int layer) {
+    if (texture == nullptr || src.w <= 0 || src.h <= 0 || dst.w <= 0.0f || dst.h <= 0.0f) {
+        return;
+    }
+    m_quads.push_back({texture, src, dst, color, layer});
+}
+
+SpriteBatch::FlushResult SpriteBatch::flush(SDL_Renderer* renderer, SDL_Texture* lastTexture) {
+    FlushResult result;
+    result.lastTexture = lastTexture;
+    if (renderer == nullptr || m_quads.empty()) {
+        m_quads.clear();
+        return result;
+    }
+
+    // Stable so quads sharing a layer and texture keep their submission order
+    std::stable_sort(m_quads.begin(), m_quads.end(), [](const Quad& a, const Quad& b) {
+        if (a.layer != b.layer) {
+            return a.layer < b.layer;
+        }
+        return std::less<SDL_Texture*>()(a.texture, b.texture);
+    });
+
+    size_t groupStart = 0;
+    while (groupStart < m_quads.size()) {
+        const Quad& first = m_quads[groupStart];
+        size_t groupEnd = groupStart + 1;
+        while (groupEnd < m_quads.size() && m_quads[groupEnd].layer == first.layer &&
+               m_quads[groupEnd].texture == first.texture) {
+            ++groupEnd;
+        }
+
+        // One size query per group instead of per sprite
+        int texW = 0;
+        int texH = 0;
+        if (SDL_QueryTexture(first.texture, nullptr, nullptr, &texW, &texH) != 0 || texW <= 0 || texH <= 0) {
+            Logger::logSDLError(LogLevel::WARNING, "SpriteBatch skipped a group with an invalid texture");
+            groupStart = groupEnd;
+            continue;
+        }
+        const float invWidth = 1.0f / texW;
+        const float invHeight = 1.0f / texH;
+
+        m_vertices.clear();
+        m_indices.clear();
+        for (size_t i = groupStart; i < groupEnd; ++i) {
+            const Quad& quad = m_quads[i];
+            float left = quad.dst.x;
+            float top = quad.dst.y;
+            float right = left + quad.dst.w;
+            float bottom = top + quad.dst.h;
+            float u0 = quad.src.x * invWidth;
+            float v0 = quad.src.y * invHeight;
+            float u1 = (quad.src.x + quad.src.w) * invWidth;
+            float v1 = (quad.src.y + quad.src.h) * invHeight;
+
+            int base = static_cast<int>(m_vertices.size());
+            m_vertices.push_back({{left, top}, quad.color, {u0, v0}});
+            m_vertices.push_back({{right, top}, quad.color, {u1, v0}});
+            m_vertices.push_back({{right, bottom}, quad.color, {u1, v1}});
+            m_vertices.push_back({{left, bottom}, quad.color, {u0, v1}});
+
+            m_indices.push_back(base);
+            m_indices.push_back(base + 1);
+            m_indices.push_back(base + 2);
+            m_indices.push_back(base);
+            m_indices.push_back(base + 2);
+            m_indices.push_back(base + 3);
+        }
+
+        SDL_RenderGeometry(renderer, first.texture, m_vertices.data(), static_cast<int>(m_vertices.size()),
+                           m_indices.data(), static_cast<int>(m_indices.size()));
+
+        result.drawCalls++;
+        result.sprites += static_cast<int>(groupEnd - groupStart);
+        if (first.texture != result.lastTexture) {
+            result.textureBinds++;
+            result.lastTexture = first.texture;
+        }
+        groupStart = groupEnd;
+    }
+
+    m_quads.clear();
+    return result;
+}
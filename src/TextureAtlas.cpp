@@ -0,0 +1,256 @@
+#include "TextureAtlas.hpp"
+#include "Logger.hpp"
+
+#include <SDL_image.h>
+#include <algorithm>
+#include <numeric>
+
+AtlasPacker::AtlasPacker(int pageWidth, int pageHeight, int padding)
+    : m_pageWidth(pageWidth), m_pageHeight(pageHeight), m_padding(padding), m_pageCount(0) {
+}
+
+std::vector<AtlasPacker::Placement> AtlasPacker::pack(const std::vector<std::pair<int, int>>& sizes) {
+    std::vector<Placement> placements(sizes.size());
+    m_pageCount = 0;
+
+    // Tallest first keeps shelves tight
+    std::vector<size_t> order(sizes.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&sizes](size_t a, size_t b) {
+        return sizes[a].second > sizes[b].second;
+    });
+
+    int page = -1;
+    int cursorX = 0;
+    int shelfY = 0;
+    int shelfHeight = 0;
+
+    for (size_t index : order) {
+        int w = sizes[index].first;
+        int h = sizes[index].second;
+
+        if (w <= 0 || h <= 0 || w > m_pageWidth || h > m_pageHeight) {
+            continue; // Left as page -1, caller decides what to do with it
+        }
+
+        // Start a new shelf when the current one is full
+        if (page >= 0 && cursorX + w > m_pageWidth) {
+            shelfY += shelfHeight + m_padding;
+            cursorX = 0;
+            shelfHeight = 0;
+        }
+
+        // Start a new page when there is no vertical room left
+        if (page < 0 || shelfY + h > m_pageHeight) {
+            page++;
+            cursorX = 0;
+            shelfY = 0;
+            shelfHeight = 0;
+        }
+
+        placements[index].page = page;
+        placements[index].x = cursorX;
+        placements[index].y = shelfY;
+
+        cursorX += w + m_padding;
+        shelfHeight = std::max(shelfHeight, h);
+    }
+
+    m_pageCount = page + 1;
+    return placements;
+}
+
+TextureAtlas::TextureAtlas()
+    : m_renderer(nullptr), m_nextUpload(0) {
+}
+
+TextureAtlas::~TextureAtlas() {
+    release();
+}
+
+bool TextureAtlas::build(SDL_Renderer* renderer, const std::vector<std::string>& imagePaths, int pageSize) {
+    std::vector<std::pair<std::string, SDL_Surface*>> images;
+    images.reserve(imagePaths.size());
+
+    for (const auto& path : imagePaths) {
+        SDL_Surface* surface = IMG_Load(path.c_str());
+        if (!surface) {
+            Logger::logSDLImageError(LogLevel::WARNING, "TextureAtlas skipping image: " + path);
+            continue;
+        }
+        images.emplace_back(path, surface);
+    }
+
+    bool result = build(renderer, images, pageSize);
+
+    for (auto& image : images) {
+        SDL_FreeSurface(image.second);
+    }
+    return result;
+}
+
+bool TextureAtlas::build(SDL_Renderer* renderer, const std::vector<std::pair<std::string, SDL_Surface*>>& images, int pageSize) {
+    if (!beginBuild(renderer, images, pageSize)) {
+        return false;
+    }
+    while (isBuilding()) {
+        uploadNext();
+    }
+    return !m_regions.empty();
+}
+
+bool TextureAtlas::beginBuild(SDL_Renderer* renderer, const std::vector<std::pair<std::string, SDL_Surface*>>& images, int pageSize) {
+    release();
+
+    if (!renderer) {
+        Logger::error("TextureAtlas::build called with null renderer");
+        return false;
+    }
+
+    if (images.empty()) {
+        Logger::warning("TextureAtlas::build called with no images");
+        return false;
+    }
+
+    // Never exceed what the renderer can actually hold in one texture
+    SDL_RendererInfo info;
+    if (SDL_GetRendererInfo(renderer, &info) == 0) {
+        if (info.max_texture_width > 0) pageSize = std::min(pageSize, info.max_texture_width);
+        if (info.max_texture_height > 0) pageSize = std::min(pageSize, info.max_texture_height);
+    }
+
+    std::vector<std::pair<int, int>> sizes;
+    sizes.reserve(images.size());
+    for (const auto& image : images) {
+        sizes.emplace_back(image.second ? image.second->w : 0, image.second ? image.second->h : 0);
+    }
+
+    AtlasPacker packer(pageSize, pageSize);
+    std::vector<AtlasPacker::Placement> placements = packer.pack(sizes);
+
+    // Size each page to what was actually used so small atlases stay small
+    std::vector<std::pair<int, int>> pageExtents(packer.getPageCount(), {0, 0});
+    for (size_t i = 0; i < placements.size(); ++i) {
+        const auto& placement = placements[i];
+        if (placement.page < 0) continue;
+        auto& extent = pageExtents[placement.page];
+        extent.first = std::max(extent.first, placement.x + sizes[i].first);
+        extent.second = std::max(extent.second, placement.y + sizes[i].second);
+    }
+
+    // Pages start fully transparent so the padding between images never samples garbage
+    std::vector<Uint8> clearPixels;
+    for (const auto& extent : pageExtents) {
+        SDL_Texture* page = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_STATIC, extent.first, extent.second);
+        if (!page) {
+            Logger::logSDLError(LogLevel::ERROR, "TextureAtlas failed to create page");
+        } else {
+            clearPixels.assign(static_cast<size_t>(extent.first) * extent.second * 4, 0);
+            SDL_UpdateTexture(page, nullptr, clearPixels.data(), extent.first * 4);
+            SDL_SetTextureBlendMode(page, SDL_BLENDMODE_BLEND);
+            m_pages.push_back(page);
+        }
+        m_packedPages.push_back(page);
+    }
+
+    for (size_t i = 0; i < images.size(); ++i) {
+        if (!images[i].second) continue;
+        const auto& placement = placements[i];
+        m_pending.push_back({images[i].first, images[i].second, placement.page,
+                             {placement.x, placement.y, sizes[i].first, sizes[i].second}});
+    }
+
+    m_renderer = renderer;
+    if (!isBuilding()) {
+        finishBuild();
+    }
+    return true;
+}
+
+void TextureAtlas::uploadNext() {
+    if (!isBuilding()) {
+        return;
+    }
+
+    const PendingImage& image = m_pending[m_nextUpload++];
+    if (image.page < 0) {
+        // Too large for a page - give it a texture of its own so lookups still work
+        SDL_Texture* standalone = SDL_CreateTextureFromSurface(m_renderer, image.surface);
+        if (!standalone) {
+            Logger::logSDLError(LogLevel::WARNING, "TextureAtlas failed to create texture for: " + image.key);
+        } else {
+            m_pages.push_back(standalone);
+            m_regions[image.key] = TextureRegion{standalone, image.rect, TextureHandle()};
+        }
+    } else if (SDL_Texture* page = m_packedPages[image.page]) {
+        // Copy pixels as-is, including alpha, into the image's rect of the page
+        SDL_Surface* source = image.surface;
+        SDL_Surface* converted = nullptr;
+        if (source->format->format != SDL_PIXELFORMAT_RGBA32) {
+            converted = SDL_ConvertSurfaceFormat(source, SDL_PIXELFORMAT_RGBA32, 0);
+            source = converted;
+        }
+
+        if (!source || SDL_LockSurface(source) != 0) {
+            Logger::logSDLError(LogLevel::WARNING, "TextureAtlas failed to convert: " + image.key);
+        } else {
+            if (SDL_UpdateTexture(page, &image.rect, source->pixels, source->pitch) != 0) {
+                Logger::logSDLError(LogLevel::WARNING, "TextureAtlas failed to upload: " + image.key);
+            } else {
+                m_regions[image.key] = TextureRegion{page, image.rect, TextureHandle()};
+            }
+            SDL_UnlockSurface(source);
+        }
+
+        if (converted) {
+            SDL_FreeSurface(converted);
+        }
+    }
+
+    if (!isBuilding()) {
+        finishBuild();
+    }
+}
+
+void TextureAtlas::finishBuild() {
+    m_pending.clear();
+    m_nextUpload = 0;
+    m_packedPages.clear();
+    m_renderer = nullptr;
+
+    Logger::info("TextureAtlas packed " + std::to_string(m_regions.size()) + " images into " +
+                 std::to_string(m_pages.size()) + " page(s)");
+}
+
+TextureRegion TextureAtlas::find(const std::string& key) const {
+    auto it = m_regions.find(key);
+    if (it == m_regions.end()) {
+        return TextureRegion{};
+    }
+    return it->second;
+}
+
+bool TextureAtlas::contains(const std::string& key) const {
+    return m_regions.find(key) != m_regions.end();
+}
+
+SDL_Texture* TextureAtlas::getPage(int index) const {
+    if (index < 0 || index >= static_cast<int>(m_pages.size())) {
+        return nullptr;
+    }
+    return m_pages[index];
+}
+
+void TextureAtlas::release() {
+    for (SDL_Texture* page : m_pages) {
+        if (page) {
+            SDL_DestroyTexture(page);
+        }
+    }
+    m_pages.clear();
+    m_regions.clear();
+    m_packedPages.clear();
+    m_pending.clear();
+    m_nextUpload = 0;
+    m_renderer = nullptr;
+}
@@ -16,8 +16,12 @@
 #include "Audio.hpp"
 #include "Font.hpp"
 #include "Logger.hpp"
+#include "Replay.hpp"
+#include "Profiler.hpp"
 #include "Exceptions.hpp"
 
+#include <chrono>
+#include <cstdio>
 #include <unordered_map>
 #include <unordered_set>
 #include <iostream>
@@ -27,8 +31,74 @@
 #include <random>
 #include <cstdlib>
 
+// Re-judge a recorded song against the current chart and rules without a window or audio.
+// Returns EXIT_SUCCESS when the replayed stats match the recording.
+static int runReplay(const std::string& replayPath)
+{
+	Replay replay;
+	if (!replay.loadFromFile(replayPath)) {
+		return EXIT_FAILURE;
+	}
+
+	auto& config = GameConfig::getInstance();
+	if (!config.initializeBeatTimings()) {
+		return EXIT_FAILURE;
+	}
+	const auto& gameplayConfig = config.getGameplayConfig();
+
+	const auto start = std::chrono::steady_clock::now();
+	ReplayResult result = replay.play(gameplayConfig.noteBeats, gameplayConfig.simulationStepMs);
+	const double wallMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	if (!result.valid) {
+		return EXIT_FAILURE;
+	}
+
+	const GameStats& recorded = replay.getRecordedStats();
+	char buffer[200];
+	snprintf(buffer, sizeof(buffer), "Replayed %.1f s of song (%zu steps, seed %u) in %.2f ms: score %d/%d, hits %d/%d, misses %d/%d (replayed/recorded)",
+			 replay.getEndSongTimeMs() / 1000.0, result.steps, replay.getSeed(), wallMs,
+			 result.stats.getScore(), recorded.getScore(), result.stats.getHits(), recorded.getHits(),
+			 result.stats.getMisses(), recorded.getMisses());
+	if (result.matches) {
+		Logger::info(buffer);
+		return EXIT_SUCCESS;
+	}
+	Logger::error(buffer);
+	return EXIT_FAILURE;
+}
+
 int main(int argc, char** argv)
 {
+	// Headless playback: no SDL subsystems are started
+	for (int i = 1; i + 1 < argc; ++i) {
+		if (std::string(argv[i]) == "--replay") {
+			return runReplay(argv[i + 1]);
+		}
+	}
+
+	// CPU profile of the whole run, written as a Chrome trace on exit
+	std::string tracePath;
+	for (int i = 1; i + 1 < argc; ++i) {
+		if (std::string(argv[i]) == "--profile") {
+			tracePath = argv[i + 1];
+		}
+	}
+	if (!tracePath.empty()) {
+#if MEOWSTRO_PROFILING
+		Profiler::setThreadName("Main");
+		Profiler::beginSession(tracePath);
+#else
+		Logger::warning("Built without MEOWSTRO_PROFILING, no trace will be written");
+#endif
+	}
+
+	// Songs are only recorded for --replay when asked to
+	for (int i = 1; i + 1 < argc; ++i) {
+		if (std::string(argv[i]) == "--record") {
+			GameConfig::getInstance().setReplayPath(argv[i + 1]);
+		}
+	}
+
 	try {
 		// Initialize SDL subsystems - fail fast on critical errors
 		if (SDL_Init(SDL_INIT_VIDEO) != EXIT_SUCCESS) {
@@ -45,7 +115,8 @@ int main(int argc, char** argv)
 		
 		Logger::info("SDL subsystems initialized successfully");
 
-		const auto& config = GameConfig::getInstance();
+		auto& config = GameConfig::getInstance();
+		config.loadSettings(); // Calibrated input offset from an earlier run, if any
 		const auto& windowConfig = config.getWindowConfig();
 		RenderWindow window(windowConfig.title, windowConfig.width, windowConfig.height, windowConfig.flags);
 		
@@ -57,26 +128,51 @@ int main(int argc, char** argv)
 		if (!resourceManager.isValid()) {
 			throw InitializationException("Failed to create resource manager");
 		}
+		window.setResourceManager(&resourceManager);
+		window.setCullMargin(config.getVisualConfig().cullMargin);
+		
+		// The overlay's glyphs are rasterized now so showing it never creates a texture
+		window.getPerfOverlay().setGlyphs(resourceManager.getGlyphAtlas(config.getAssetPaths().fontPath, config.getFontSizes().perfOverlay));
+		window.getPerfOverlay().setEnabled(config.getVisualConfig().perfOverlay);
+		
+		// Map the baked asset pack unless loose files were requested (for comparing cold-start times)
+		bool useAssetPack = true;
+		for (int i = 1; i < argc; ++i) {
+			if (std::string(argv[i]) == "--loose-assets") {
+				useAssetPack = false;
+			}
+		}
+		if (useAssetPack) {
+			resourceManager.mountAssetPack(config.getAssetPaths().assetPackPath);
+		}
+		
+		// Menu images are packed up front; gameplay images decode on worker threads while the menu runs.
+		// Either atlas falls back to per-image textures on failure.
+		const int atlasPageSize = config.getVisualConfig().atlasPageSize;
+		resourceManager.buildAtlas("menu", config.getAssetPaths().getMenuImagePaths(), atlasPageSize);
+		resourceManager.buildAtlasAsync("gameplay", config.getAssetPaths().getGameplayImagePaths(), atlasPageSize);
 		
 		InputHandler inputHandler;
-		srand(static_cast<unsigned int>(time(NULL)));
 		
 		Logger::info("Game systems initialized, starting game loop");
 		
 		// Create the game state manager and run the game
 		GameStateManager gameStateManager(window, resourceManager, inputHandler);
 		gameStateManager.run();
+		Profiler::endSession();
 		
 		Logger::info("Game ended successfully");
 		
 	} catch (const InitializationException& e) {
 		Logger::error(e.what());
+		Profiler::endSession();
 		TTF_Quit();
 		IMG_Quit();
 		SDL_Quit();
 		return EXIT_FAILURE;
 	} catch (const std::exception& e) {
 		Logger::error("Unexpected error: " + std::string(e.what()));
+		Profiler::endSession();
 		TTF_Quit();
 		IMG_Quit();
 		SDL_Quit();
@@ -0,0 +1,118 @@
+// Allocation tests - a separate executable because they replace the global operator new and
+// SDL's allocator for the whole process, which the other suites should not run on.
+#include <gtest/gtest.h>
+#include <SDL.h>
+#include <SDL_mixer.h>
+#include "SoundEffects.hpp"
+#include "support/AudioDeviceTest.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+// Counts allocations made by the thread that holds an AllocationCounter
+thread_local bool t_countAllocations = false;
+std::atomic<size_t> g_allocations(0);
+
+void countAllocation() {
+    if (t_countAllocations) {
+        g_allocations.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+// SDL_malloc and friends (used by SDL_mixer) forward to the allocator SDL started with
+SDL_malloc_func g_sdlMalloc = nullptr;
+SDL_calloc_func g_sdlCalloc = nullptr;
+SDL_realloc_func g_sdlRealloc = nullptr;
+SDL_free_func g_sdlFree = nullptr;
+
+void* SDLCALL countingMalloc(size_t size) {
+    countAllocation();
+    return g_sdlMalloc(size);
+}
+
+void* SDLCALL countingCalloc(size_t count, size_t size) {
+    countAllocation();
+    return g_sdlCalloc(count, size);
+}
+
+void* SDLCALL countingRealloc(void* memory, size_t size) {
+    countAllocation();
+    return g_sdlRealloc(memory, size);
+}
+
+void SDLCALL forwardFree(void* memory) {
+    g_sdlFree(memory);
+}
+
+// Counts this thread's allocations for its lifetime; the flag is cleared even when an assertion returns early
+class AllocationCounter {
+public:
+    AllocationCounter() { t_countAllocations = true; }
+    ~AllocationCounter() { t_countAllocations = false; }
+
+    AllocationCounter(const AllocationCounter&) = delete;
+    AllocationCounter& operator=(const AllocationCounter&) = delete;
+};
+
+} // namespace
+
+void* operator new(std::size_t size) {
+    countAllocation();
+    if (void* memory = std::malloc(size == 0 ? 1 : size)) {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept {
+    std::free(memory);
+}
+
+class SoundEffectsAllocationTest : public AudioDeviceTest {};
+
+// Stress: thousands of overlapping hits on a small pool - every one starts, by stealing the
+// oldest voice when needed, and none of them allocates through new or SDL_malloc
+TEST_F(SoundEffectsAllocationTest, StressOverlappingHits) {
+    constexpr int kVoices = 16;
+    constexpr int kBursts = 40;
+    constexpr int kHitsPerBurst = 250;
+
+    SoundEffects sfx;
+    ASSERT_TRUE(sfx.initialize(kVoices));
+
+    g_allocations.store(0);
+    for (int burst = 0; burst < kBursts; ++burst) {
+        {
+            AllocationCounter counter;
+            for (int i = 0; i < kHitsPerBurst; ++i) {
+                int channel = sfx.play(i % 3 == 0 ? SoundId::HitGood : SoundId::HitPerfect);
+                ASSERT_GE(channel, 0);
+                ASSERT_LT(channel, kVoices);
+            }
+        }
+        SDL_Delay(2); // Let the mixer run while voices are still sounding
+    }
+
+    const SoundEffectStats& stats = sfx.getStats();
+    EXPECT_EQ(stats.played, static_cast<size_t>(kBursts * kHitsPerBurst));
+    EXPECT_EQ(stats.failed, 0u);
+    EXPECT_GE(stats.stolen, static_cast<size_t>(kBursts * kHitsPerBurst - kVoices * kBursts));
+    EXPECT_EQ(g_allocations.load(), 0u);
+    EXPECT_LE(Mix_Playing(-1), kVoices);
+}
+
+int main(int argc, char** argv) {
+    // Installed before SDL allocates anything; frees go to the original allocator either way
+    SDL_GetMemoryFunctions(&g_sdlMalloc, &g_sdlCalloc, &g_sdlRealloc, &g_sdlFree);
+    SDL_SetMemoryFunctions(countingMalloc, countingCalloc, countingRealloc, forwardFree);
+
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <gtest/gtest.h>
+#include <SDL.h>
+#include <SDL_mixer.h>
+
+// Fixture for tests that need an open mixer. Runs against SDL's dummy audio driver so no sound
+// card is needed, and skips the test when even that cannot be opened.
+class AudioDeviceTest : public ::testing::Test {
+protected:
+    static constexpr int kDeviceRate = 44100;
+    static constexpr int kDeviceChannels = 2;   // 16-bit samples (MIX_DEFAULT_FORMAT)
+
+    void SetUp() override {
+        SDL_setenv("SDL_AUDIODRIVER", "dummy", 1);
+        if (SDL_InitSubSystem(SDL_INIT_AUDIO) != 0) {
+            GTEST_SKIP() << "SDL audio not available: " << SDL_GetError();
+        }
+        if (Mix_OpenAudio(kDeviceRate, MIX_DEFAULT_FORMAT, kDeviceChannels, 512) != 0) {
+            SDL_QuitSubSystem(SDL_INIT_AUDIO);
+            GTEST_SKIP() << "Audio device not available: " << Mix_GetError();
+        }
+        deviceOpen = true;
+    }
+
+    void TearDown() override {
+        if (deviceOpen) {
+            Mix_CloseAudio();
+            SDL_QuitSubSystem(SDL_INIT_AUDIO);
+        }
+    }
+
+    bool deviceOpen = false;
+};
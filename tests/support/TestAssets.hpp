@@ -0,0 +1,19 @@
+#pragma once
+
+#include <fstream>
+#include <string>
+
+// Assets live in the project root and tests may run from there or from build/. Returns the
+// configured path (e.g. "./assets/...") when it exists, else the same path one directory up,
+// else an empty string.
+inline std::string findAsset(const std::string& path) {
+    if (std::ifstream(path).good()) {
+        return path;
+    }
+    const std::string relative = path.compare(0, 2, "./") == 0 ? path.substr(2) : path;
+    const std::string parent = "../" + relative;
+    if (std::ifstream(parent).good()) {
+        return parent;
+    }
+    return std::string();
+}
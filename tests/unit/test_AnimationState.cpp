@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+#include "AnimationState.hpp"
+
+#include <cstdlib>
+
+// Test that interpolation blends from the previous step to the current one
+TEST(AnimationStateTest, InterpolatedPositionBlendsSteps) {
+    InterpolatedPosition position;
+    position.snap(100.0f, 50.0f);
+    EXPECT_FLOAT_EQ(position.lerpX(0.5f), 100.0f);
+
+    position.advance(90.0f, 60.0f);
+    EXPECT_FLOAT_EQ(position.lerpX(0.0f), 100.0f);
+    EXPECT_FLOAT_EQ(position.lerpX(1.0f), 90.0f);
+    EXPECT_FLOAT_EQ(position.lerpX(0.25f), 97.5f);
+    EXPECT_FLOAT_EQ(position.lerpY(0.5f), 55.0f);
+}
+
+// Test that the throw pose lasts the same time no matter how the simulation is stepped
+TEST(AnimationStateTest, FisherThrowPoseIsTimeBased) {
+    for (double stepMs : {1000.0 / 240.0, 1000.0 / 120.0, 1000.0 / 30.0}) {
+        FisherAnimationState state;
+        Animation::startFisherThrow(state);
+
+        int column = 2;
+        double elapsedMs = 0.0;
+        while (state.thrown && elapsedMs < 1000.0) {
+            column = Animation::stepFisherThrow(state, stepMs);
+            elapsedMs += stepMs;
+        }
+
+        EXPECT_FALSE(state.thrown);
+        EXPECT_EQ(column, 1);
+        EXPECT_GE(elapsedMs, FisherAnimationState::kThrowPoseMs);
+        EXPECT_LT(elapsedMs, FisherAnimationState::kThrowPoseMs + stepMs + 1e-6);
+    }
+}
+
+// Test that the hook follows the supplied clock out to the target and back
+TEST(AnimationStateTest, HookThrowFollowsClock) {
+    HookAnimationState state;
+    state.isThrowing = true;
+    state.throwStartTime = 1000;
+    state.throwDuration = 200;
+    state.hookStartX = 100;
+    state.hookStartY = 100;
+    state.hookTargetX = 300;
+    state.hookTargetY = 500;
+
+    int x = 0;
+    int y = 0;
+    ASSERT_TRUE(Animation::stepHookThrow(state, 1100, x, y));
+    EXPECT_EQ(x, 200);
+    EXPECT_EQ(y, 300);
+
+    // Reaching the target turns the throw around
+    ASSERT_TRUE(Animation::stepHookThrow(state, 1200, x, y));
+    EXPECT_TRUE(state.isReturning);
+    EXPECT_EQ(x, 300);
+
+    ASSERT_TRUE(Animation::stepHookThrow(state, 1300, x, y));
+    EXPECT_EQ(x, 200);
+
+    ASSERT_TRUE(Animation::stepHookThrow(state, 1400, x, y));
+    EXPECT_FALSE(state.isThrowing);
+
+    // An idle hook is left where it is
+    EXPECT_FALSE(Animation::stepHookThrow(state, 1500, x, y));
+}
+
+// Test that sway stays within a pixel and the phase keeps sprites out of lockstep
+TEST(AnimationStateTest, SwayIsSmallAndPhased) {
+    bool differs = false;
+    for (int step = 0; step < 240; ++step) {
+        const float timeSeconds = step / 120.0f;
+        SwayOffset first = Animation::sway(timeSeconds);
+        SwayOffset second = Animation::sway(timeSeconds, 1.0f);
+        EXPECT_LE(std::abs(first.x), 1);
+        EXPECT_LE(std::abs(first.y), 1);
+        differs = differs || first.x != second.x || first.y != second.y;
+    }
+    EXPECT_TRUE(differs);
+}
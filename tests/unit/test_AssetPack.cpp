@@ -0,0 +1,154 @@
+#include <gtest/gtest.h>
+#include <SDL.h>
+#include <SDL_image.h>
+#include <SDL_ttf.h>
+#include "AssetPack.hpp"
+#include "ResourceManager.hpp"
+#include "RenderWindow.hpp"
+#include "GameConfig.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <memory>
+
+// Test fixture for AssetPack tests - packs are written to the working directory and removed after
+class AssetPackTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        ASSERT_EQ(SDL_Init(SDL_INIT_VIDEO), 0) << "SDL_Init failed: " << SDL_GetError();
+        ASSERT_EQ(TTF_Init(), 0) << "TTF_Init failed: " << TTF_GetError();
+    }
+
+    void TearDown() override {
+        std::remove(packPath.c_str());
+        TTF_Quit();
+        SDL_Quit();
+    }
+
+    // Solid RGBA image with a marker in the first pixel so lookups can be told apart
+    static std::vector<Uint8> makePixels(int width, int height, Uint8 marker) {
+        std::vector<Uint8> pixels(static_cast<size_t>(width) * height * 4, 200);
+        pixels[0] = marker;
+        return pixels;
+    }
+
+    const std::string packPath = "test_assets.mwpk";
+};
+
+// Test that entries written by the writer come back intact and aligned from the mapping
+TEST_F(AssetPackTest, WriteAndMapRoundTrip) {
+    auto boat = makePixels(8, 4, 11);
+    auto hook = makePixels(3, 5, 22);
+    std::vector<std::uint8_t> fontBytes = {1, 2, 3, 4, 5};
+
+    AssetPackWriter writer;
+    writer.addImage("assets/images/boat.png", 8, 4, boat.data());
+    writer.addImage("assets/images/hook.png", 3, 5, hook.data());
+    writer.addFont("assets/fonts/test.ttf", fontBytes);
+    ASSERT_TRUE(writer.write(packPath));
+
+    AssetPack pack;
+    ASSERT_TRUE(pack.open(packPath));
+    EXPECT_EQ(pack.getEntryCount(), 3u);
+
+    // Config-style paths with a leading "./" resolve to the same entries
+    const AssetPackEntry* entry = pack.find("./assets/images/hook.png");
+    ASSERT_NE(entry, nullptr);
+    EXPECT_EQ(entry->type, AssetPackEntryType::Image);
+    EXPECT_EQ(entry->width, 3);
+    EXPECT_EQ(entry->height, 5);
+    EXPECT_EQ(entry->size, hook.size());
+    EXPECT_EQ(entry->data[0], 22);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(entry->data) % 16, 0u);
+
+    const AssetPackEntry* font = pack.find("assets/fonts/test.ttf");
+    ASSERT_NE(font, nullptr);
+    EXPECT_EQ(font->type, AssetPackEntryType::Font);
+    EXPECT_EQ(std::vector<std::uint8_t>(font->data, font->data + font->size), fontBytes);
+
+    EXPECT_EQ(pack.find("assets/images/missing.png"), nullptr);
+}
+
+// Test that missing and malformed files are rejected instead of mapped
+TEST_F(AssetPackTest, RejectsInvalidFiles) {
+    AssetPack pack;
+    EXPECT_FALSE(pack.open("nonexistent.mwpk"));
+
+    {
+        std::ofstream out(packPath, std::ios::binary);
+        out << "definitely not a pack file, just some text";
+    }
+    EXPECT_FALSE(pack.open(packPath));
+    EXPECT_FALSE(pack.isOpen());
+
+    // Valid header but truncated table of contents
+    auto pixels = makePixels(4, 4, 1);
+    AssetPackWriter writer;
+    writer.addImage("assets/a.png", 4, 4, pixels.data());
+    ASSERT_TRUE(writer.write(packPath));
+    std::ifstream in(packPath, std::ios::binary);
+    std::vector<char> bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    in.close();
+    {
+        std::ofstream out(packPath, std::ios::binary | std::ios::trunc);
+        out.write(bytes.data(), bytes.size() - 4);
+    }
+    EXPECT_FALSE(pack.open(packPath));
+}
+
+// Test that ResourceManager serves packed images without the PNG existing on disk
+TEST_F(AssetPackTest, ResourceManagerLoadsFromPack) {
+    auto pixels = makePixels(16, 8, 99);
+    AssetPackWriter writer;
+    writer.addImage("packed_only/sprite.png", 16, 8, pixels.data());
+    writer.addImage("packed_only/other.png", 4, 4, pixels.data());
+    ASSERT_TRUE(writer.write(packPath));
+
+    RenderWindow window("Pack Test", 100, 100, SDL_WINDOW_HIDDEN);
+    ASSERT_TRUE(window.isValid());
+    ResourceManager resourceManager(window.getRenderer());
+    ASSERT_TRUE(resourceManager.mountAssetPack(packPath));
+    EXPECT_TRUE(resourceManager.hasAssetPack());
+
+    SDL_Texture* texture = resourceManager.loadTexture("./packed_only/sprite.png");
+    ASSERT_NE(texture, nullptr);
+    int w = 0;
+    int h = 0;
+    SDL_QueryTexture(texture, nullptr, nullptr, &w, &h);
+    EXPECT_EQ(w, 16);
+    EXPECT_EQ(h, 8);
+
+    std::vector<std::string> atlasPaths = {"./packed_only/sprite.png", "./packed_only/other.png"};
+    ASSERT_TRUE(resourceManager.buildAtlas("packed", atlasPaths, 256));
+    TextureRegion region = resourceManager.getTextureRegion("./packed_only/other.png");
+    EXPECT_EQ(region.rect.w, 4);
+    EXPECT_EQ(region.rect.h, 4);
+
+    // Unpacked paths still go to disk (and fail here since the file does not exist)
+    EXPECT_EQ(resourceManager.loadTexture("./packed_only/not_packed.png"), nullptr);
+}
+
+// Test that fonts open straight from the mapped bytes
+TEST_F(AssetPackTest, ResourceManagerLoadsPackedFont) {
+    const std::string fontPath = findAsset(GameConfig::getInstance().getAssetPaths().fontPath);
+    std::ifstream fontFile(fontPath, std::ios::binary);
+    if (fontPath.empty() || !fontFile.good()) {
+        GTEST_SKIP() << "Font asset not available - test requires game assets";
+    }
+    std::vector<std::uint8_t> fontBytes((std::istreambuf_iterator<char>(fontFile)), std::istreambuf_iterator<char>());
+
+    AssetPackWriter writer;
+    writer.addFont("packed_only/font.ttf", fontBytes);
+    ASSERT_TRUE(writer.write(packPath));
+
+    RenderWindow window("Pack Test", 100, 100, SDL_WINDOW_HIDDEN);
+    ASSERT_TRUE(window.isValid());
+    ResourceManager resourceManager(window.getRenderer());
+    ASSERT_TRUE(resourceManager.mountAssetPack(packPath));
+
+    Font* font = resourceManager.getFont("./packed_only/font.ttf", 24);
+    ASSERT_NE(font, nullptr);
+    EXPECT_GT(font->getLineHeight(), 0);
+    EXPECT_NE(resourceManager.createTextTexture("./packed_only/font.ttf", 24, "123", {0, 0, 0, 255}), nullptr);
+}
@@ -0,0 +1,175 @@
+#include <gtest/gtest.h>
+#include <SDL.h>
+#include <SDL_image.h>
+#include "AsyncAssetLoader.hpp"
+#include "ResourceManager.hpp"
+#include "RenderWindow.hpp"
+
+#include <cstdio>
+#include <memory>
+
+// Test fixture for async loading - writes a few PNGs and owns a hidden render window
+class AsyncAssetLoaderTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        ASSERT_EQ(SDL_Init(SDL_INIT_VIDEO), 0) << "SDL_Init failed: " << SDL_GetError();
+        ASSERT_NE(IMG_Init(IMG_INIT_PNG) & IMG_INIT_PNG, 0) << "IMG_Init failed: " << IMG_GetError();
+
+        window = std::make_unique<RenderWindow>("Async Test", 100, 100, SDL_WINDOW_HIDDEN);
+        ASSERT_TRUE(window->isValid()) << "Failed to create test render window";
+
+        resourceManager = std::make_unique<ResourceManager>(window->getRenderer());
+        ASSERT_TRUE(resourceManager->isValid());
+
+        const int sizes[][2] = {{64, 32}, {48, 48}, {16, 80}, {100, 20}};
+        for (int i = 0; i < 4; ++i) {
+            std::string filename = "async_test_" + std::to_string(i) + ".png";
+            ASSERT_TRUE(createTestImage(filename, sizes[i][0], sizes[i][1]));
+            imagePaths.push_back(filename);
+        }
+    }
+
+    void TearDown() override {
+        resourceManager.reset();
+        window.reset();
+        for (const std::string& path : imagePaths) {
+            std::remove(path.c_str());
+        }
+        IMG_Quit();
+        SDL_Quit();
+    }
+
+    bool createTestImage(const std::string& filename, int width, int height) {
+        SDL_Surface* surface = SDL_CreateRGBSurfaceWithFormat(0, width, height, 32, SDL_PIXELFORMAT_RGBA32);
+        if (!surface) return false;
+        SDL_FillRect(surface, nullptr, SDL_MapRGBA(surface->format, 255, 128, 64, 255));
+        int result = IMG_SavePNG(surface, filename.c_str());
+        SDL_FreeSurface(surface);
+        return result == 0;
+    }
+
+    // Pump like a menu frame would until the handle completes (bounded so a bug cannot hang)
+    void pumpUntilDone(const AssetLoadHandle& handle) {
+        for (int frame = 0; frame < 5000 && !handle.isDone(); ++frame) {
+            resourceManager->pumpAsyncUploads(2.0);
+            SDL_Delay(1);
+        }
+    }
+
+    std::unique_ptr<RenderWindow> window;
+    std::unique_ptr<ResourceManager> resourceManager;
+    std::vector<std::string> imagePaths;
+};
+
+// Test that an async image ends up in the same cache slot a sync load would use
+TEST_F(AsyncAssetLoaderTest, ImageUploadsIntoCache) {
+    AssetLoadHandle handle = resourceManager->loadTextureAsync(imagePaths[0]);
+    EXPECT_TRUE(handle.isValid());
+
+    pumpUntilDone(handle);
+    ASSERT_TRUE(handle.isReady());
+    ASSERT_NE(handle.getTexture(), nullptr);
+
+    int w = 0;
+    int h = 0;
+    SDL_QueryTexture(handle.getTexture(), nullptr, nullptr, &w, &h);
+    EXPECT_EQ(w, 64);
+    EXPECT_EQ(h, 32);
+
+    // Already uploaded - the synchronous path is a cache hit
+    EXPECT_EQ(resourceManager->loadTexture(imagePaths[0]), handle.getTexture());
+    EXPECT_EQ(resourceManager->getTextureCacheStats().hits, 1u);
+}
+
+// Test that an async atlas is registered and serves regions once uploaded
+TEST_F(AsyncAssetLoaderTest, AtlasBuildsFromWorkerDecodes) {
+    AssetLoadHandle handle = resourceManager->buildAtlasAsync("async", imagePaths, 256);
+    EXPECT_TRUE(resourceManager->hasPendingAsyncLoads());
+
+    pumpUntilDone(handle);
+    ASSERT_TRUE(handle.isReady());
+    EXPECT_FALSE(resourceManager->hasPendingAsyncLoads());
+    EXPECT_FLOAT_EQ(resourceManager->getAsyncLoadProgress(), 1.0f);
+
+    const TextureAtlas* atlas = resourceManager->getAtlas("async");
+    ASSERT_NE(atlas, nullptr);
+    EXPECT_EQ(atlas->getRegionCount(), imagePaths.size());
+
+    TextureRegion region = resourceManager->getTextureRegion(imagePaths[2]);
+    EXPECT_EQ(region.texture, atlas->getPage(0));
+    EXPECT_EQ(region.rect.w, 16);
+    EXPECT_EQ(region.rect.h, 80);
+}
+
+// Test that finishing blocks until everything queued has been uploaded
+TEST_F(AsyncAssetLoaderTest, FinishAllCompletesEveryRequest) {
+    std::vector<AssetLoadHandle> handles;
+    for (const std::string& path : imagePaths) {
+        handles.push_back(resourceManager->loadTextureAsync(path));
+    }
+
+    resourceManager->finishAsyncLoads();
+
+    for (const auto& handle : handles) {
+        EXPECT_TRUE(handle.isReady());
+    }
+    EXPECT_FALSE(resourceManager->hasPendingAsyncLoads());
+    EXPECT_EQ(resourceManager->getTextureCacheStats().liveTextures, imagePaths.size());
+}
+
+// Test that a missing file fails its handle without affecting other requests
+TEST_F(AsyncAssetLoaderTest, MissingFileFails) {
+    AssetLoadHandle missing = resourceManager->loadTextureAsync("nonexistent_async.png");
+    AssetLoadHandle present = resourceManager->loadTextureAsync(imagePaths[1]);
+
+    resourceManager->finishAsyncLoads();
+
+    EXPECT_EQ(missing.getStatus(), AssetLoadStatus::Failed);
+    EXPECT_EQ(missing.getTexture(), nullptr);
+    EXPECT_TRUE(present.isReady());
+}
+
+// Test that the upload budget spreads work across frames instead of doing it all at once
+TEST_F(AsyncAssetLoaderTest, ZeroBudgetUploadsOnePerPump) {
+    AsyncAssetLoader loader(1);
+    std::vector<AssetLoadHandle> handles;
+    for (const std::string& path : imagePaths) {
+        handles.push_back(loader.requestImage(path));
+    }
+
+    size_t uploads = 0;
+    for (int frame = 0; frame < 5000 && !loader.isIdle(); ++frame) {
+        int count = loader.pumpUploads(*resourceManager, 0.0);
+        EXPECT_LE(count, 1);
+        uploads += count;
+        SDL_Delay(1);
+    }
+    EXPECT_EQ(uploads, imagePaths.size());
+    EXPECT_FLOAT_EQ(loader.getProgress(), 1.0f);
+}
+
+// Test that an atlas is uploaded an image per pump when the budget is spent, and only registered once complete
+TEST_F(AsyncAssetLoaderTest, ZeroBudgetSpreadsAtlasAcrossPumps) {
+    AsyncAssetLoader loader(1);
+    AssetLoadHandle handle = loader.requestAtlas("spread", imagePaths, 256);
+
+    size_t uploads = 0;
+    for (int frame = 0; frame < 5000 && !loader.isIdle(); ++frame) {
+        int count = loader.pumpUploads(*resourceManager, 0.0);
+        EXPECT_LE(count, 1);
+        uploads += count;
+        if (uploads > 0 && uploads < imagePaths.size()) {
+            EXPECT_FALSE(handle.isDone());
+            EXPECT_EQ(resourceManager->getAtlas("spread"), nullptr);
+            EXPECT_LT(loader.getProgress(), 1.0f);
+        }
+        SDL_Delay(1);
+    }
+    EXPECT_EQ(uploads, imagePaths.size());
+    ASSERT_TRUE(handle.isReady());
+
+    const TextureAtlas* atlas = resourceManager->getAtlas("spread");
+    ASSERT_NE(atlas, nullptr);
+    EXPECT_EQ(atlas->getRegionCount(), imagePaths.size());
+    EXPECT_EQ(atlas->getPageCount(), 1);
+}
@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+#include "Calibration.hpp"
+#include "AudioLogic.hpp"
+
+#include <cmath>
+
+namespace {
+
+// Clicks every 600 ms starting at 1000 ms host time
+Calibration clickTrack(int clicks, size_t leadIn = 4, size_t minTaps = 8) {
+    Calibration calibration(leadIn, minTaps, 3.0);
+    for (int i = 0; i < clicks; ++i) {
+        calibration.addClick(1000.0 + i * 600.0);
+    }
+    return calibration;
+}
+
+} // namespace
+
+// Test that steady late taps give their mean offset and spread
+TEST(CalibrationTest, MeasuresSteadyOffset) {
+    Calibration calibration = clickTrack(20);
+    for (int i = 4; i < 20; ++i) {
+        double jitter = (i % 2 == 0) ? 4.0 : -4.0;
+        calibration.addTap(1000.0 + i * 600.0 + 35.0 + jitter);
+    }
+
+    CalibrationResult result = calibration.compute();
+    EXPECT_TRUE(result.valid);
+    EXPECT_NEAR(result.offsetMs, 35.0, 1e-9);
+    EXPECT_NEAR(result.jitterMs, 4.0, 1e-9);
+    EXPECT_EQ(result.taps, 16u);
+    EXPECT_EQ(result.rejected, 0u);
+}
+
+// Test that early taps pair with the click they anticipate, not the previous one
+TEST(CalibrationTest, EarlyTapsMatchNextClick) {
+    Calibration calibration = clickTrack(16);
+    for (int i = 4; i < 16; ++i) {
+        calibration.addTap(1000.0 + i * 600.0 - 20.0);
+    }
+
+    CalibrationResult result = calibration.compute();
+    EXPECT_TRUE(result.valid);
+    EXPECT_NEAR(result.offsetMs, -20.0, 1e-9);
+    EXPECT_NEAR(result.jitterMs, 0.0, 1e-6);
+}
+
+// Test that a stray tap and a double tap do not move the estimate
+TEST(CalibrationTest, RejectsOutliersAndRepeats) {
+    Calibration calibration = clickTrack(20);
+    for (int i = 4; i < 20; ++i) {
+        if (i != 10) {
+            calibration.addTap(1000.0 + i * 600.0 + 30.0 + (i % 3));
+        }
+    }
+    calibration.addTap(1000.0 + 10 * 600.0 + 250.0); // Stray tap, still nearest click 10
+    calibration.addTap(1000.0 + 12 * 600.0 + 40.0);  // Second tap on click 12
+
+    CalibrationResult result = calibration.compute();
+    EXPECT_TRUE(result.valid);
+    EXPECT_NEAR(result.offsetMs, 31.0, 1e-9);
+    EXPECT_LT(result.jitterMs, 1.0);
+    EXPECT_EQ(result.taps, 17u);
+    EXPECT_EQ(result.rejected, 2u);
+}
+
+// Test that lead-in taps are ignored and too few taps are not a valid result
+TEST(CalibrationTest, NeedsEnoughScoredTaps) {
+    Calibration calibration = clickTrack(10);
+    for (int i = 0; i < 10; ++i) {
+        calibration.addTap(1000.0 + i * 600.0 + 25.0);
+    }
+
+    CalibrationResult result = calibration.compute();
+    EXPECT_EQ(result.taps, 6u); // Clicks 4-9
+    EXPECT_FALSE(result.valid);
+    EXPECT_NEAR(result.offsetMs, 25.0, 1e-9);
+
+    calibration.reset();
+    EXPECT_EQ(calibration.getClickCount(), 0u);
+    EXPECT_FALSE(calibration.compute().valid);
+}
+
+// Test the robust statistics directly, including an even number of samples
+TEST(CalibrationTest, AnalyzeUsesMedianAbsoluteDeviation) {
+    CalibrationResult result = Calibration::analyze({ 10.0, 12.0, 14.0, 16.0, 90.0, -60.0 }, 4, 3.0);
+    EXPECT_TRUE(result.valid);
+    EXPECT_EQ(result.rejected, 2u);
+    EXPECT_NEAR(result.offsetMs, 13.0, 1e-9);
+
+    EXPECT_FALSE(Calibration::analyze({}, 1, 3.0).valid);
+}
+
+// Test that the saved offset moves taps back onto the beat before judging
+TEST(CalibrationTest, AudioLogicAppliesOffset) {
+    AudioLogic logic;
+    EXPECT_EQ(logic.checkHit(1000.0, 1100.0), 1); // 100 ms late: good
+
+    logic.setInputOffsetMs(80.0);
+    EXPECT_DOUBLE_EQ(logic.getInputOffsetMs(), 80.0);
+    EXPECT_DOUBLE_EQ(logic.applyInputOffset(1100.0), 1020.0);
+    EXPECT_EQ(logic.checkHit(1000.0, logic.applyInputOffset(1100.0)), 2); // Perfect once corrected
+    EXPECT_EQ(logic.checkHit(1000.0, logic.applyInputOffset(1000.0)), 1); // An uncorrected on-beat tap is now early
+    EXPECT_EQ(logic.checkHit(1000.0, 1100.0), 1); // checkHit never applies the offset itself
+}
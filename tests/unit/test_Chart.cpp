@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+#include "Chart.hpp"
+
+#include <sstream>
+
+namespace {
+
+bool loadText(Chart& chart, const std::string& text) {
+    std::istringstream input(text);
+    return chart.load(input, "test.chart");
+}
+
+} // namespace
+
+// Test that header values and notes are parsed
+TEST(ChartTest, ParsesHeaderAndNotes) {
+    Chart chart;
+    ASSERT_TRUE(loadText(chart,
+        "version 1\n"
+        "title Test Song\n"
+        "music ./assets/audio/test.mp3\n"
+        "bpm 120.5\n"
+        "scroll 0.35\n"
+        "count 3\n"
+        "\n"
+        "[notes]\n"
+        "# time_ms lane type\n"
+        "1000 0 tap\n"
+        "1500.5 2 hold   # trailing comment\n"
+        "\n"
+        "2000 1 tap\n"));
+
+    EXPECT_TRUE(chart.isLoaded());
+    EXPECT_EQ(chart.getTitle(), "Test Song");
+    EXPECT_EQ(chart.getMusicPath(), "./assets/audio/test.mp3");
+    EXPECT_DOUBLE_EQ(chart.getBpm(), 120.5);
+    EXPECT_DOUBLE_EQ(chart.getScrollSpeed(), 0.35);
+
+    ASSERT_EQ(chart.getNoteCount(), 3u);
+    const ChartNote& hold = chart.getNotes()[1];
+    EXPECT_DOUBLE_EQ(hold.timeMs, 1500.5);
+    EXPECT_EQ(hold.lane, 2);
+    EXPECT_EQ(hold.type, NoteType::Hold);
+}
+
+// Test that the offset is applied to note times but not to the stored notes
+TEST(ChartTest, AppliesOffset) {
+    Chart chart;
+    ASSERT_TRUE(loadText(chart, "version 1\nbpm 100\noffset -25\n[notes]\n1000 0 tap\n2000 0 tap\n"));
+
+    EXPECT_DOUBLE_EQ(chart.getNotes()[0].timeMs, 1000.0);
+    EXPECT_DOUBLE_EQ(chart.getNoteTimeMs(0), 975.0);
+    EXPECT_EQ(chart.getNoteTimes(), std::vector<double>({975.0, 1975.0}));
+    EXPECT_DOUBLE_EQ(chart.getScrollSpeed(), 0.0); // Not set
+}
+
+// Test that out-of-order notes are sorted, keeping file order for equal times
+TEST(ChartTest, SortsNotesByTime) {
+    Chart chart;
+    ASSERT_TRUE(loadText(chart, "version 1\nbpm 100\n[notes]\n3000 0 tap\n1000 1 tap\n3000 2 tap\n2000 3 tap\n"));
+
+    ASSERT_EQ(chart.getNoteCount(), 4u);
+    EXPECT_EQ(chart.getNotes()[0].lane, 1);
+    EXPECT_EQ(chart.getNotes()[1].lane, 3);
+    EXPECT_EQ(chart.getNotes()[2].lane, 0);
+    EXPECT_EQ(chart.getNotes()[3].lane, 2);
+}
+
+// Test that malformed charts are rejected and leave the chart empty
+TEST(ChartTest, RejectsMalformedCharts) {
+    Chart chart;
+    ASSERT_TRUE(loadText(chart, "version 1\nbpm 100\n[notes]\n1000 0 tap\n"));
+
+    EXPECT_FALSE(loadText(chart, "version 1\nbpm 100\n[notes]\n1000 0 slide\n"));  // Unknown type
+    EXPECT_FALSE(chart.isLoaded());
+    EXPECT_EQ(chart.getNoteCount(), 0u);
+
+    EXPECT_FALSE(loadText(chart, "version 1\nbpm 100\n[notes]\n1000 tap\n"));      // Missing lane
+    EXPECT_FALSE(loadText(chart, "version 1\nbpm 100\n[notes]\n1000 300 tap\n"));  // Lane out of range
+    EXPECT_FALSE(loadText(chart, "version 1\nbpm fast\n[notes]\n"));              // Bad number
+    EXPECT_FALSE(loadText(chart, "version 1\n[notes]\n1000 0 tap\n"));            // No bpm
+    EXPECT_FALSE(loadText(chart, "version 2\nbpm 100\n[notes]\n"));               // Newer format
+    EXPECT_FALSE(loadText(chart, "version 1\nbpm 100\nscroll -0.2\n[notes]\n"));  // Negative scroll
+}
+
+// Test that the count line is only a hint, so an absurd value cannot fail the load
+TEST(ChartTest, CountIsOnlyAHint) {
+    Chart chart;
+    ASSERT_TRUE(loadText(chart, "version 1\nbpm 100\ncount 1e12\n[notes]\n1000 0 tap\n2000 1 tap\n"));
+    EXPECT_EQ(chart.getNoteCount(), 2u);
+
+    ASSERT_TRUE(loadText(chart, "version 1\nbpm 100\ncount -5\n[notes]\n1000 0 tap\n"));
+    EXPECT_EQ(chart.getNoteCount(), 1u);
+}
+
+// Test that a missing file fails cleanly
+TEST(ChartTest, MissingFile) {
+    Chart chart;
+    EXPECT_FALSE(chart.loadFromFile("./does_not_exist.chart"));
+    EXPECT_FALSE(chart.isLoaded());
+}
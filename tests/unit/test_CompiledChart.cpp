@@ -0,0 +1,152 @@
+#include <gtest/gtest.h>
+#include "CompiledChart.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <sstream>
+
+// Test fixture for CompiledChart tests - charts are written to the working directory and removed after
+class CompiledChartTest : public ::testing::Test {
+protected:
+    void TearDown() override {
+        std::remove(chartPath.c_str());
+    }
+
+    // Notes every 100 ms on lanes 0-3, every fifth one a hold
+    static Chart makeChart(int noteCount) {
+        std::ostringstream text;
+        text << "version 1\ntitle Compiled\nmusic ./song.mp3\nbpm 150\noffset 12.5\nscroll 0.3\n[notes]\n";
+        for (int i = 0; i < noteCount; ++i) {
+            text << 1000 + i * 100 << ".25 " << i % 4 << (i % 5 == 0 ? " hold\n" : " tap\n");
+        }
+        Chart chart;
+        std::istringstream input(text.str());
+        chart.load(input, "generated");
+        return chart;
+    }
+
+    const std::string chartPath = "test_chart.mwch";
+};
+
+// Test that header values and every note survive a round trip through the file
+TEST_F(CompiledChartTest, WriteAndMapRoundTrip) {
+    Chart source = makeChart(100);
+    ASSERT_EQ(source.getNoteCount(), 100u);
+    ASSERT_TRUE(CompiledChartWriter(16).write(source, chartPath));
+
+    CompiledChart compiled;
+    ASSERT_TRUE(compiled.open(chartPath));
+    EXPECT_EQ(compiled.getTitle(), "Compiled");
+    EXPECT_EQ(compiled.getMusicPath(), "./song.mp3");
+    EXPECT_DOUBLE_EQ(compiled.getBpm(), 150.0);
+    EXPECT_DOUBLE_EQ(compiled.getOffsetMs(), 12.5);
+    EXPECT_DOUBLE_EQ(compiled.getScrollSpeed(), 0.3);
+    EXPECT_EQ(compiled.getNoteCount(), 100u);
+    EXPECT_EQ(compiled.getSectionCount(), 7u);
+
+    std::vector<ChartNote> notes;
+    ASSERT_TRUE(compiled.decodeNotes(0, compiled.getNoteCount(), notes));
+    ASSERT_EQ(notes.size(), 100u);
+    for (size_t i = 0; i < notes.size(); ++i) {
+        EXPECT_DOUBLE_EQ(notes[i].timeMs, source.getNotes()[i].timeMs);
+        EXPECT_EQ(notes[i].lane, source.getNotes()[i].lane);
+        EXPECT_EQ(notes[i].type, source.getNotes()[i].type);
+    }
+    EXPECT_EQ(compiled.getNoteTimes(), source.getNoteTimes());
+}
+
+// Test that Chart::loadFromFile recognises a compiled chart
+TEST_F(CompiledChartTest, ChartLoadsCompiledFile) {
+    Chart source = makeChart(40);
+    ASSERT_TRUE(CompiledChartWriter().write(source, chartPath));
+    EXPECT_TRUE(CompiledChart::isCompiledChart(chartPath));
+
+    Chart loaded;
+    ASSERT_TRUE(loaded.loadFromFile(chartPath));
+    EXPECT_EQ(loaded.getNoteCount(), 40u);
+    EXPECT_EQ(loaded.getTitle(), "Compiled");
+    EXPECT_EQ(loaded.getNoteTimes(), source.getNoteTimes());
+}
+
+// Test seeking by song time and decoding a range that spans sections
+TEST_F(CompiledChartTest, SeeksAndDecodesAcrossSections) {
+    ASSERT_TRUE(CompiledChartWriter(8).write(makeChart(64), chartPath));
+    CompiledChart compiled;
+    ASSERT_TRUE(compiled.open(chartPath));
+
+    // Note i is at 1000.25 + i * 100, plus the 12.5 ms offset
+    EXPECT_EQ(compiled.findNote(0.0), 0u);
+    EXPECT_EQ(compiled.findNote(1012.75), 0u);
+    EXPECT_EQ(compiled.findNote(1012.76), 1u);
+    EXPECT_EQ(compiled.findNote(3000.0), 20u);
+    EXPECT_EQ(compiled.findNote(100000.0), 64u);
+    EXPECT_EQ(compiled.findSection(3000.0), 2u);
+
+    std::vector<ChartNote> notes;
+    ASSERT_TRUE(compiled.decodeNotes(6, 4, notes));
+    ASSERT_EQ(notes.size(), 4u);
+    EXPECT_DOUBLE_EQ(notes[0].timeMs, 1600.25);
+    EXPECT_DOUBLE_EQ(notes[3].timeMs, 1900.25);
+    EXPECT_EQ(notes[3].lane, 1);
+
+    EXPECT_FALSE(compiled.decodeNotes(60, 5, notes));
+}
+
+// Test that notes the format cannot hold are rejected by the writer
+TEST_F(CompiledChartTest, WriterRejectsUnsupportedNotes) {
+    Chart chart;
+    std::istringstream wideLane("version 1\nbpm 100\n[notes]\n1000 16 tap\n");
+    ASSERT_TRUE(chart.load(wideLane, "wide"));
+    std::vector<std::uint8_t> bytes;
+    EXPECT_FALSE(CompiledChartWriter().build(chart, bytes));
+
+    std::istringstream negative("version 1\nbpm 100\n[notes]\n-5 0 tap\n");
+    ASSERT_TRUE(chart.load(negative, "negative"));
+    EXPECT_FALSE(CompiledChartWriter().build(chart, bytes));
+}
+
+// Test that truncated and non-chart files fail to open
+TEST_F(CompiledChartTest, RejectsCorruptFiles) {
+    std::vector<std::uint8_t> bytes;
+    ASSERT_TRUE(CompiledChartWriter(4).build(makeChart(20), bytes));
+
+    // Cut off inside the section index
+    {
+        std::ofstream out(chartPath, std::ios::binary | std::ios::trunc);
+        out.write(reinterpret_cast<const char*>(bytes.data()), 120);
+    }
+    CompiledChart compiled;
+    EXPECT_FALSE(compiled.open(chartPath));
+    EXPECT_FALSE(compiled.isOpen());
+
+    {
+        std::ofstream out(chartPath, std::ios::trunc);
+        out << "version 1\nbpm 100\n";
+    }
+    EXPECT_FALSE(CompiledChart::isCompiledChart(chartPath));
+    EXPECT_FALSE(compiled.open(chartPath));
+}
+
+// Test that header numbers the text parser would refuse also fail to open
+TEST_F(CompiledChartTest, RejectsInvalidHeaderNumbers) {
+    std::vector<std::uint8_t> bytes;
+    ASSERT_TRUE(CompiledChartWriter().build(makeChart(8), bytes));
+
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    const std::pair<size_t, double> patches[] = {
+        {24, 0.0}, {24, -120.0}, {24, nan}, {32, nan}, {40, nan}, {40, -1.0}
+    };
+    for (const auto& patch : patches) {
+        std::vector<std::uint8_t> patched = bytes;
+        std::memcpy(patched.data() + patch.first, &patch.second, sizeof(double));
+        {
+            std::ofstream out(chartPath, std::ios::binary | std::ios::trunc);
+            out.write(reinterpret_cast<const char*>(patched.data()), static_cast<std::streamsize>(patched.size()));
+        }
+        CompiledChart compiled;
+        EXPECT_FALSE(compiled.open(chartPath)) << "offset " << patch.first << " value " << patch.second;
+        EXPECT_FALSE(compiled.isOpen());
+    }
+}
@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+#include <SDL.h>
+#include "FramePacer.hpp"
+
+// Test fixture for FramePacer tests - only the SDL timer is needed
+class FramePacerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        ASSERT_EQ(SDL_Init(SDL_INIT_TIMER), 0) << "SDL_Init failed: " << SDL_GetError();
+    }
+
+    void TearDown() override {
+        SDL_Quit();
+    }
+
+    static double elapsedMs(Uint64 start) {
+        return (SDL_GetPerformanceCounter() - start) * 1000.0 / SDL_GetPerformanceFrequency();
+    }
+};
+
+// Test that a capped loop runs at the target rate without rounding frames to whole milliseconds
+TEST_F(FramePacerTest, HoldsTargetRate) {
+    FramePacer pacer(120.0); // 8.33 ms, not a whole number of milliseconds
+    pacer.reset();
+
+    Uint64 start = SDL_GetPerformanceCounter();
+    for (int i = 0; i < 60; ++i) {
+        pacer.endFrame();
+    }
+    double totalMs = elapsedMs(start);
+
+    // Deadlines advance by whole frames, so the total tracks 60 frames closely
+    EXPECT_GE(totalMs, 60 * 1000.0 / 120.0 - 1.0);
+    EXPECT_LT(totalMs, 60 * 1000.0 / 120.0 + 25.0);
+
+    FrameTimeStats stats = pacer.getStats();
+    EXPECT_EQ(stats.frames, 60u);
+    EXPECT_NEAR(stats.avgMs, 1000.0 / 120.0, 0.5);
+    EXPECT_LE(stats.minMs, stats.avgMs);
+    EXPECT_LE(stats.avgMs, stats.p99Ms);
+    EXPECT_LE(stats.p99Ms, stats.maxMs);
+}
+
+// Test that uncapped and VSync modes only measure
+TEST_F(FramePacerTest, UncappedAndVSyncDoNotWait) {
+    FramePacer uncapped(0.0);
+    FramePacer vsync(10.0, true);
+    uncapped.reset();
+    vsync.reset();
+
+    Uint64 start = SDL_GetPerformanceCounter();
+    for (int i = 0; i < 10; ++i) {
+        uncapped.endFrame();
+        vsync.endFrame();
+    }
+    EXPECT_LT(elapsedMs(start), 50.0); // A 10 FPS cap would take a second
+
+    EXPECT_EQ(uncapped.getStats().frames, 10u);
+    EXPECT_EQ(vsync.getStats().frames, 10u);
+}
+
+// Test that a stall does not make the pacer rush through catch-up frames
+TEST_F(FramePacerTest, ResyncsAfterStall) {
+    FramePacer pacer(100.0);
+    pacer.reset();
+    pacer.endFrame();
+
+    SDL_Delay(100); // Ten frames late
+    pacer.endFrame();
+
+    Uint64 start = SDL_GetPerformanceCounter();
+    pacer.endFrame();
+    EXPECT_GE(elapsedMs(start), 9.0); // Next frame is still a full frame away
+}
+
+// Test that history is bounded and cleared by reset
+TEST_F(FramePacerTest, HistoryIsBounded) {
+    FramePacer pacer(0.0);
+    for (size_t i = 0; i < FramePacer::kHistorySize + 10; ++i) {
+        pacer.endFrame();
+    }
+    EXPECT_EQ(pacer.getStats().frames, FramePacer::kHistorySize);
+
+    pacer.reset();
+    EXPECT_EQ(pacer.getStats().frames, 0u);
+    EXPECT_DOUBLE_EQ(pacer.getLastFrameMs(), 0.0);
+}
+
+// Test that the idle task runs repeatedly while waiting without stretching the frame
+TEST_F(FramePacerTest, RunsIdleTaskWhileWaiting) {
+    FramePacer pacer(50.0); // 20 ms frames
+    int calls = 0;
+    pacer.setIdleTask([&calls]() { ++calls; }, 1.0);
+    pacer.reset();
+
+    for (int i = 0; i < 5; ++i) {
+        pacer.endFrame();
+    }
+    EXPECT_GE(calls, 5 * 10); // Roughly every millisecond of the ~100 ms waited
+    EXPECT_NEAR(pacer.getStats().avgMs, 20.0, 2.0);
+
+    pacer.setIdleTask(nullptr);
+    calls = 0;
+    pacer.endFrame();
+    EXPECT_EQ(calls, 0);
+}
+
+// Test that the idle task still runs once per frame when the pacer does not wait
+TEST_F(FramePacerTest, RunsIdleTaskWithoutWaiting) {
+    FramePacer uncapped(0.0);
+    FramePacer vsync(60.0, true);
+    int calls = 0;
+    uncapped.setIdleTask([&calls]() { ++calls; });
+    vsync.setIdleTask([&calls]() { ++calls; });
+
+    for (int i = 0; i < 3; ++i) {
+        uncapped.endFrame();
+        vsync.endFrame();
+    }
+    EXPECT_EQ(calls, 6);
+
+    vsync.runIdleTask();
+    EXPECT_EQ(calls, 7);
+}
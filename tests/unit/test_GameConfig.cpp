@@ -1,5 +1,8 @@
 #include <gtest/gtest.h>
 #include "GameConfig.hpp"
+#include "support/TestAssets.hpp"
+
+#include <cstdio>
 
 // Test fixture for GameConfig tests
 class GameConfigTest : public ::testing::Test {
@@ -7,9 +10,25 @@ protected:
     void SetUp() override {
         // Get reference to the singleton instance
         config = &GameConfig::getInstance();
+        playerSettingsPath = config->getCalibrationConfig().settingsPath;
+    }
+    
+    void TearDown() override {
+        config->setSettingsPath(playerSettingsPath);
+    }
+    
+    // Loads the chart from wherever findAsset locates it when the configured path does not resolve
+    bool initializeBeatTimings() {
+        const std::string& configuredPath = config->getAssetPaths().chartPath;
+        const std::string chartPath = findAsset(configuredPath);
+        if (chartPath != configuredPath && config->getGameplayConfig().noteBeats.empty()) {
+            return config->loadChart(chartPath);
+        }
+        return config->initializeBeatTimings();
     }
     
     GameConfig* config;
+    std::string playerSettingsPath; // The game's own settings file, which tests must not touch
 };
 
 // Test singleton pattern - should return same instance
@@ -39,6 +58,39 @@ TEST_F(GameConfigTest, AudioConfigDefaults) {
     EXPECT_EQ(audioConfig.bpm, 147);
     EXPECT_DOUBLE_EQ(audioConfig.travelDuration, 2000.0);
     EXPECT_EQ(audioConfig.backgroundMusicPath, "./assets/audio/meowstro_short_ver.mp3");
+    EXPECT_DOUBLE_EQ(audioConfig.inputOffsetMs, 0.0);
+    EXPECT_EQ(audioConfig.sampleRate, 44100);
+    EXPECT_EQ(audioConfig.bufferSamples, 512);
+    EXPECT_EQ(audioConfig.channels, 2);
+    EXPECT_TRUE(audioConfig.deviceName.empty());
+    EXPECT_FALSE(audioConfig.predecodeMusic);
+    EXPECT_GE(audioConfig.maxBufferSamples, audioConfig.bufferSamples);
+}
+
+// Test that the calibrated input offset survives a save and load
+TEST_F(GameConfigTest, SettingsRoundTrip) {
+    const std::string settingsPath = "test_settings.cfg";
+    config->setSettingsPath(settingsPath);
+    EXPECT_EQ(playerSettingsPath, "./meowstro_settings.cfg");
+    EXPECT_GT(config->getCalibrationConfig().minTaps, 0);
+    
+    const int defaultBuffer = config->getAudioConfig().bufferSamples;
+    
+    config->setInputOffsetMs(42.5);
+    config->setAudioBufferSamples(1024);
+    ASSERT_TRUE(config->saveSettings());
+    config->setInputOffsetMs(0.0);
+    config->setAudioBufferSamples(defaultBuffer);
+    ASSERT_TRUE(config->loadSettings());
+    EXPECT_DOUBLE_EQ(config->getAudioConfig().inputOffsetMs, 42.5);
+    EXPECT_EQ(config->getAudioConfig().bufferSamples, 1024);
+    
+    // Leave the defaults behind for other tests
+    std::remove(settingsPath.c_str());
+    config->setInputOffsetMs(0.0);
+    config->setAudioBufferSamples(defaultBuffer);
+    EXPECT_FALSE(config->loadSettings());
+    EXPECT_DOUBLE_EQ(config->getAudioConfig().inputOffsetMs, 0.0);
 }
 
 // Test VisualConfig default values
@@ -62,6 +114,9 @@ TEST_F(GameConfigTest, VisualConfigDefaults) {
     EXPECT_EQ(visualConfig.RED.a, 255);
     
     EXPECT_EQ(visualConfig.frameDelay, 75);
+    EXPECT_EQ(visualConfig.cullMargin, 128);
+    EXPECT_EQ(visualConfig.targetFps, 60);
+    EXPECT_FALSE(visualConfig.vsync);
 }
 
 // Test AssetPaths default values
@@ -89,29 +144,17 @@ TEST_F(GameConfigTest, AssetPathsDefaults) {
 TEST_F(GameConfigTest, GameplayConfigDefaults) {
     const auto& gameplayConfig = config->getGameplayConfig();
     
-    EXPECT_EQ(gameplayConfig.numBeats, 25);
     EXPECT_EQ(gameplayConfig.numFishTextures, 3);
     EXPECT_EQ(gameplayConfig.throwDuration, 200);
     EXPECT_EQ(gameplayConfig.hookTargetX, 650);
     EXPECT_EQ(gameplayConfig.hookTargetY, 625);
     EXPECT_EQ(gameplayConfig.fishTargetX, 660);
-    
-    // Test fish start locations
-    const auto& fishLocations = gameplayConfig.fishStartXLocations;
-    EXPECT_EQ(fishLocations.size(), 25);
-    
-    // Test some specific locations
-    EXPECT_EQ(fishLocations[0], 1352);
-    EXPECT_EQ(fishLocations[1], 2350);
-    EXPECT_EQ(fishLocations[24], 10160); // Last element
-    
-    // Test that all values are positive
-    for (int location : fishLocations) {
-        EXPECT_GT(location, 0);
-    }
-    
-    // Test that locations are generally increasing (rough check)
-    EXPECT_LT(fishLocations[0], fishLocations[24]);
+    EXPECT_DOUBLE_EQ(gameplayConfig.fishSpeed, 0.2);
+    EXPECT_GT(gameplayConfig.simulationStepMs, 0.0);
+    EXPECT_GT(gameplayConfig.maxSimulationSteps, 0);
+    EXPECT_TRUE(gameplayConfig.inputSampling);
+    EXPECT_GT(gameplayConfig.inputPumpIntervalMs, 0.0);
+    EXPECT_TRUE(gameplayConfig.replayPath.empty()); // Recording is opt-in
 }
 
 // Test FontSizes default values
@@ -136,13 +179,21 @@ TEST_F(GameConfigTest, FontSizesDefaults) {
     EXPECT_GT(fontSizes.hitFeedback, 0);
 }
 
+// Test ResourceConfig default values
+TEST_F(GameConfigTest, ResourceConfigDefaults) {
+    const auto& resourceConfig = config->getResourceConfig();
+    
+    EXPECT_EQ(resourceConfig.textureCacheBudgetBytes, 64u * 1024u * 1024u);
+    EXPECT_GT(resourceConfig.textureCacheBudgetBytes, 0u);
+}
+
 // Test beat timing initialization
 TEST_F(GameConfigTest, BeatTimingInitialization) {
     // Before initialization, noteBeats should be empty
     const auto& gameplayConfig = config->getGameplayConfig();
     
     // Initialize beat timings
-    config->initializeBeatTimings();
+    ASSERT_TRUE(initializeBeatTimings());
     
     // After initialization, should have 25 beats
     const auto& noteBeats = gameplayConfig.noteBeats;
@@ -161,7 +212,7 @@ TEST_F(GameConfigTest, BeatTimingInitialization) {
 
 // Test multiple calls to initializeBeatTimings doesn't reinitialize
 TEST_F(GameConfigTest, BeatTimingInitializationIdempotent) {
-    config->initializeBeatTimings();
+    ASSERT_TRUE(initializeBeatTimings());
     
     const auto& gameplayConfig = config->getGameplayConfig();
     const auto& noteBeats = gameplayConfig.noteBeats;
@@ -170,22 +221,24 @@ TEST_F(GameConfigTest, BeatTimingInitializationIdempotent) {
     double firstBeat = noteBeats[0];
     
     // Call initialization again
-    config->initializeBeatTimings();
+    EXPECT_TRUE(config->initializeBeatTimings());
     
     // Should still have same values
     EXPECT_EQ(noteBeats.size(), 25);
     EXPECT_DOUBLE_EQ(noteBeats[0], firstBeat);
 }
 
-// Test consistency between numBeats and fish locations
-TEST_F(GameConfigTest, ConsistencyBetweenBeatsAndFishLocations) {
+// Test that note timings come from the shipped chart
+TEST_F(GameConfigTest, BeatTimingsMatchChart) {
+    ASSERT_TRUE(initializeBeatTimings());
     const auto& gameplayConfig = config->getGameplayConfig();
+    const Chart& chart = config->getChart();
     
-    EXPECT_EQ(gameplayConfig.numBeats, gameplayConfig.fishStartXLocations.size());
-    
-    config->initializeBeatTimings();
-    EXPECT_EQ(gameplayConfig.numBeats, gameplayConfig.noteBeats.size());
-    EXPECT_EQ(gameplayConfig.fishStartXLocations.size(), gameplayConfig.noteBeats.size());
+    ASSERT_TRUE(chart.isLoaded());
+    EXPECT_EQ(chart.getNoteCount(), gameplayConfig.noteBeats.size());
+    EXPECT_DOUBLE_EQ(chart.getBpm(), config->getAudioConfig().bpm);
+    EXPECT_DOUBLE_EQ(gameplayConfig.noteBeats[0], 3460.0);
+    EXPECT_DOUBLE_EQ(gameplayConfig.noteBeats[24], 48570.0);
 }
 
 // Test that configuration values are reasonable for a game
@@ -213,8 +266,7 @@ TEST_F(GameConfigTest, ReasonableConfigurationValues) {
     EXPECT_LE(visualConfig.frameDelay, 1000);
     
     // Game mechanics should be reasonable
-    EXPECT_GT(gameplayConfig.numBeats, 0);
-    EXPECT_LE(gameplayConfig.numBeats, 100);
+    EXPECT_GT(gameplayConfig.fishSpeed, 0.0);
     EXPECT_GT(gameplayConfig.numFishTextures, 0);
     EXPECT_GT(gameplayConfig.throwDuration, 0);
 }
@@ -234,6 +286,7 @@ TEST_F(GameConfigTest, PathsNotEmpty) {
     EXPECT_FALSE(assetPaths.blueFishTexture.empty());
     EXPECT_FALSE(assetPaths.greenFishTexture.empty());
     EXPECT_FALSE(assetPaths.goldFishTexture.empty());
+    EXPECT_FALSE(assetPaths.chartPath.empty());
     EXPECT_FALSE(audioConfig.backgroundMusicPath.empty());
 }
 
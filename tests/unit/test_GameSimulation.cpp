@@ -0,0 +1,181 @@
+#include <gtest/gtest.h>
+#include "GameSimulation.hpp"
+
+#include <vector>
+
+namespace {
+
+// 16 notes, 500 ms apart, on a 1920x1080 viewport
+SimulationConfig makeConfig() {
+    SimulationConfig config;
+    for (int i = 0; i < 16; ++i) {
+        config.noteTimesMs.push_back(2000.0 + i * 500.0);
+    }
+    config.seed = 42u;
+    config.fishFrameSizes.assign(3, {128, 128});
+    config.culler = ViewportCuller(1920, 1080, 128);
+    return config;
+}
+
+// Press every other note on time and play to the end at the given frame length
+GameStats playSong(GameSimulation& simulation, double frameMs) {
+    const SimulationConfig& config = simulation.getConfig();
+    std::vector<double> presses;
+    for (size_t i = 0; i < config.noteTimesMs.size(); i += 2) {
+        presses.push_back(config.noteTimesMs[i] + 10.0);
+    }
+
+    ManualClock clock;
+    FixedLengthMusic music(clock, config.noteTimesMs.back() + 1000.0);
+    simulation.setClock(&clock);
+    simulation.setMusicState(&music);
+
+    size_t nextPress = 0;
+    std::vector<double> framePresses;
+    while (!simulation.isFinished()) {
+        clock.advanceMs(frameMs);
+        framePresses.clear();
+        while (nextPress < presses.size() && presses[nextPress] <= clock.getTimeMs()) {
+            framePresses.push_back(presses[nextPress++]);
+        }
+        simulation.update(framePresses);
+    }
+    return simulation.getStats();
+}
+
+// The snapshot entry for a note's fish, or nullptr when it is not drawn
+const FishSnapshot* findFish(const RenderSnapshot& snapshot, int noteIndex) {
+    for (const FishSnapshot& fish : snapshot.fish) {
+        if (fish.noteIndex == noteIndex) {
+            return &fish;
+        }
+    }
+    return nullptr;
+}
+
+} // namespace
+
+// Test that a song plays to the end without a window, audio device or wall clock
+TEST(GameSimulationTest, PlaysHeadless) {
+    GameSimulation simulation;
+    simulation.reset(makeConfig());
+
+    GameStats stats = playSong(simulation, 1000.0 / 60.0);
+    EXPECT_EQ(stats.getHits(), 8);
+    EXPECT_EQ(stats.getMisses(), 8);
+    EXPECT_EQ(stats.getScore(), 8 * judgementScore(Judgement::Perfect));
+    EXPECT_TRUE(simulation.getJudgement().isFinished());
+    EXPECT_EQ(simulation.getSnapshot().score, stats.getScore());
+}
+
+// Test that the result does not depend on the frame rate the simulation is stepped at
+TEST(GameSimulationTest, FrameRateIndependent) {
+    GameSimulation slow;
+    GameSimulation fast;
+    slow.reset(makeConfig());
+    fast.reset(makeConfig());
+
+    GameStats slowStats = playSong(slow, 1000.0 / 30.0);
+    GameStats fastStats = playSong(fast, 1000.0 / 240.0);
+    EXPECT_EQ(slowStats.getScore(), fastStats.getScore());
+    EXPECT_EQ(slowStats.getHits(), fastStats.getHits());
+    EXPECT_EQ(slowStats.getMisses(), fastStats.getMisses());
+}
+
+// Test that a hit is reported once, turns its fish into a popup and throws the hook
+TEST(GameSimulationTest, HitShowsPopup) {
+    GameSimulation simulation;
+    simulation.reset(makeConfig());
+
+    const RenderSnapshot& before = simulation.step(1990.0, {});
+    ASSERT_NE(findFish(before, 0), nullptr);
+    EXPECT_EQ(findFish(before, 0)->view, FishView::Swimming);
+    EXPECT_TRUE(before.hits.empty());
+
+    const RenderSnapshot& hit = simulation.step(2000.0, {2000.0});
+    ASSERT_EQ(hit.hits.size(), 1u);
+    EXPECT_EQ(hit.hits[0].noteIndex, 0);
+    ASSERT_NE(findFish(hit, 0), nullptr);
+    EXPECT_EQ(findFish(hit, 0)->view, FishView::HitPopup);
+    EXPECT_EQ(findFish(hit, 0)->judgement, Judgement::Perfect);
+    EXPECT_EQ(hit.score, judgementScore(Judgement::Perfect));
+
+    const RenderSnapshot& thrown = simulation.step(2100.0, {});
+    EXPECT_TRUE(thrown.hits.empty());
+    EXPECT_GT(thrown.hook.y, 400.0f); // On its way down to the water
+
+    // The popup goes away after hitPopupMs
+    const RenderSnapshot& later = simulation.step(3100.0, {});
+    EXPECT_EQ(findFish(later, 0), nullptr);
+}
+
+// Test that fish far off screen are culled and scroll in as their note approaches
+TEST(GameSimulationTest, CullsOffscreenFish) {
+    GameSimulation simulation;
+    simulation.reset(makeConfig());
+
+    const RenderSnapshot& start = simulation.getSnapshot();
+    EXPECT_GT(start.fishCull.culled, 0);
+    EXPECT_EQ(start.fishCull.visible + start.fishCull.culled, 16);
+    EXPECT_EQ(static_cast<int>(start.fish.size()), start.fishCull.visible);
+    EXPECT_EQ(findFish(start, 15), nullptr);
+
+    simulation.step(8900.0, {});
+    const RenderSnapshot& later = simulation.step(9000.0, {});
+    const FishSnapshot* last = findFish(later, 15);
+    ASSERT_NE(last, nullptr);
+    EXPECT_EQ(last->view, FishView::Swimming);
+    EXPECT_GT(last->x, -128.0f);
+    EXPECT_LT(last->x, 1920.0f + 128.0f);
+
+    // Fish that scrolled off the left are gone from the snapshot
+    EXPECT_EQ(findFish(later, 0), nullptr);
+}
+
+// Test that only fish near the screen are drawn, however long the chart is
+TEST(GameSimulationTest, SnapshotHoldsOnlyVisibleFish) {
+    SimulationConfig config = makeConfig();
+    config.noteTimesMs.clear();
+    for (int i = 0; i < 10000; ++i) {
+        config.noteTimesMs.push_back(2000.0 + i * 100.0);
+    }
+
+    GameSimulation simulation;
+    simulation.reset(config);
+    for (double timeMs = 0.0; timeMs < 60000.0; timeMs += 1000.0 / 60.0) {
+        const RenderSnapshot& snapshot = simulation.step(timeMs, {});
+        // A fish scrolls 20 px per 100 ms note gap, so about 2300 px of screen and margin hold ~115
+        ASSERT_LE(snapshot.fish.size(), 120u);
+        EXPECT_EQ(static_cast<int>(snapshot.fish.size()), snapshot.fishCull.visible);
+        EXPECT_EQ(snapshot.fishCull.visible + snapshot.fishCull.culled, 10000);
+    }
+}
+
+// Test that a fish entering the screen starts where it is instead of sliding in from the origin
+TEST(GameSimulationTest, EnteringFishIsSnapped) {
+    GameSimulation simulation;
+    simulation.reset(makeConfig());
+
+    // Fish 15 (note at 9500 ms) crosses the right bound, 1920 + 128 px, at 2560 ms
+    for (double timeMs = 0.0; timeMs < 2550.0; timeMs += 1000.0 / 60.0) {
+        EXPECT_EQ(findFish(simulation.step(timeMs, {}), 15), nullptr);
+    }
+    const RenderSnapshot& snapshot = simulation.step(2570.0, {});
+    const FishSnapshot* fish = findFish(snapshot, 15);
+    ASSERT_NE(fish, nullptr);
+    EXPECT_GT(fish->x, 1920.0f);
+    EXPECT_LT(fish->x, 1920.0f + 128.0f + 2.0f);
+}
+
+// Test that the recorded replay plays back to the same stats
+TEST(GameSimulationTest, RecordsReplay) {
+    GameSimulation simulation;
+    simulation.reset(makeConfig());
+    GameStats stats = playSong(simulation, 1000.0 / 60.0);
+    simulation.finishReplay();
+
+    ReplayResult result = simulation.getReplay().play(simulation.getConfig().noteTimesMs, simulation.getConfig().stepMs);
+    EXPECT_TRUE(result.valid);
+    EXPECT_TRUE(result.matches);
+    EXPECT_EQ(result.stats.getScore(), stats.getScore());
+}
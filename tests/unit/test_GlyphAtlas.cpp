@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+#include <SDL.h>
+#include <SDL_image.h>
+#include <SDL_ttf.h>
+#include "GlyphAtlas.hpp"
+#include "RenderWindow.hpp"
+#include "ResourceManager.hpp"
+#include "GameConfig.hpp"
+#include "support/TestAssets.hpp"
+
+#include <memory>
+
+// Test fixture for GlyphAtlas tests - needs the game font from assets/
+class GlyphAtlasTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        ASSERT_EQ(SDL_Init(SDL_INIT_VIDEO), 0) << "SDL_Init failed: " << SDL_GetError();
+        ASSERT_NE(IMG_Init(IMG_INIT_PNG) & IMG_INIT_PNG, 0) << "IMG_Init failed: " << IMG_GetError();
+        ASSERT_EQ(TTF_Init(), 0) << "TTF_Init failed: " << TTF_GetError();
+
+        window = std::make_unique<RenderWindow>("Glyph Test", 200, 100, SDL_WINDOW_HIDDEN);
+        ASSERT_TRUE(window->isValid()) << "Failed to create test render window";
+
+        resourceManager = std::make_unique<ResourceManager>(window->getRenderer());
+        ASSERT_TRUE(resourceManager->isValid());
+
+        fontPath = findAsset(GameConfig::getInstance().getAssetPaths().fontPath);
+    }
+
+    void TearDown() override {
+        resourceManager.reset();
+        window.reset();
+        TTF_Quit();
+        IMG_Quit();
+        SDL_Quit();
+    }
+
+    std::unique_ptr<RenderWindow> window;
+    std::unique_ptr<ResourceManager> resourceManager;
+    std::string fontPath;
+};
+
+// Test that the atlas builds into a single page and is cached per (font, size)
+TEST_F(GlyphAtlasTest, BuildAndCache) {
+    if (fontPath.empty()) {
+        GTEST_SKIP() << "Font asset not available - test requires game assets";
+    }
+
+    GlyphAtlas* glyphs = resourceManager->getGlyphAtlas(fontPath, 35);
+    ASSERT_NE(glyphs, nullptr);
+    EXPECT_TRUE(glyphs->isValid());
+    EXPECT_GT(glyphs->getLineHeight(), 0);
+
+    EXPECT_EQ(resourceManager->getGlyphAtlas(fontPath, 35), glyphs);
+    EXPECT_NE(resourceManager->getGlyphAtlas(fontPath, 40), glyphs);
+}
+
+// Test that measured width tracks SDL_ttf's own layout for digit strings
+TEST_F(GlyphAtlasTest, MeasureMatchesFontLayout) {
+    if (fontPath.empty()) {
+        GTEST_SKIP() << "Font asset not available - test requires game assets";
+    }
+
+    GlyphAtlas* glyphs = resourceManager->getGlyphAtlas(fontPath, 35);
+    ASSERT_NE(glyphs, nullptr);
+
+    TTF_Font* font = TTF_OpenFont(fontPath.c_str(), 35);
+    ASSERT_NE(font, nullptr);
+    int expectedW = 0;
+    int expectedH = 0;
+    TTF_SizeText(font, "001250", &expectedW, &expectedH);
+    TTF_CloseFont(font);
+
+    EXPECT_NEAR(glyphs->measureText("001250"), expectedW, 4);
+    EXPECT_EQ(glyphs->measureText(""), 0);
+}
+
+// Test quad generation: 4 vertices and 6 indices per visible glyph, none for spaces
+TEST_F(GlyphAtlasTest, AppendQuadsPerGlyph) {
+    if (fontPath.empty()) {
+        GTEST_SKIP() << "Font asset not available - test requires game assets";
+    }
+
+    GlyphAtlas* glyphs = resourceManager->getGlyphAtlas(fontPath, 35);
+    ASSERT_NE(glyphs, nullptr);
+
+    std::vector<SDL_Vertex> vertices;
+    std::vector<int> indices;
+    SDL_Color red = {255, 0, 0, 255};
+    glyphs->appendQuads("12 3", 10.0f, 20.0f, red, vertices, indices);
+
+    EXPECT_EQ(vertices.size(), 12u);
+    EXPECT_EQ(indices.size(), 18u);
+    for (const auto& vertex : vertices) {
+        EXPECT_EQ(vertex.color.r, 255);
+        EXPECT_EQ(vertex.color.g, 0);
+        EXPECT_GE(vertex.tex_coord.x, 0.0f);
+        EXPECT_LE(vertex.tex_coord.x, 1.0f);
+        EXPECT_GE(vertex.tex_coord.y, 0.0f);
+        EXPECT_LE(vertex.tex_coord.y, 1.0f);
+    }
+    EXPECT_FLOAT_EQ(vertices[0].position.y, 20.0f);
+}
+
+// Test that drawing changing numbers costs one draw call each and no new textures
+TEST_F(GlyphAtlasTest, RenderTextIsOneDrawCall) {
+    if (fontPath.empty()) {
+        GTEST_SKIP() << "Font asset not available - test requires game assets";
+    }
+
+    GlyphAtlas* glyphs = resourceManager->getGlyphAtlas(fontPath, 35);
+    ASSERT_NE(glyphs, nullptr);
+    SDL_Color black = {0, 0, 0, 255};
+
+    window->clear();
+    for (int score = 0; score < 5000; score += 500) {
+        window->renderText(*glyphs, std::to_string(score), 0, 0, black);
+    }
+    window->display();
+
+    EXPECT_EQ(window->getFrameStats().drawCalls, 10);
+    EXPECT_EQ(window->getFrameStats().textureBinds, 1);
+}
@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 #include <SDL.h>
 #include "InputHandler.hpp"
+#include "SongClock.hpp"
 
 // Test fixture for InputHandler tests that handles SDL initialization
 class InputHandlerTest : public ::testing::Test {
@@ -75,6 +76,22 @@ TEST_F(InputHandlerTest, QuitEventUniversal) {
     EXPECT_EQ(inputHandler->processInput(quitEvent, GameState::EndScreen), InputAction::Quit);
 }
 
+// Test that F3 toggles the performance overlay in every state, without touching the space key state
+TEST_F(InputHandlerTest, PerfOverlayToggleUniversal) {
+    SDL_Event f3 = createKeyDownEvent(SDLK_F3);
+    EXPECT_TRUE(InputHandler::isPerfOverlayToggle(f3));
+    
+    EXPECT_EQ(inputHandler->processInput(f3, GameState::MainMenu), InputAction::TogglePerfOverlay);
+    EXPECT_EQ(inputHandler->processInput(f3, GameState::Playing), InputAction::TogglePerfOverlay);
+    EXPECT_EQ(inputHandler->processInput(f3, GameState::EndScreen), InputAction::TogglePerfOverlay);
+    EXPECT_FALSE(inputHandler->isSpaceHeld());
+    
+    // Holding the key does not flicker the overlay
+    f3.key.repeat = 1;
+    EXPECT_FALSE(InputHandler::isPerfOverlayToggle(f3));
+    EXPECT_FALSE(InputHandler::isPerfOverlayToggle(createKeyUpEvent(SDLK_F3)));
+}
+
 // Test MainMenu input handling
 TEST_F(InputHandlerTest, MainMenuInputHandling) {
     // Test ESCAPE key
@@ -287,6 +304,23 @@ TEST_F(InputHandlerTest, RhythmGameTimingScenario) {
     EXPECT_FALSE(inputHandler->isSpaceHeld());
 }
 
+// Test that processEvent keeps when the key went down, not when the event was handled
+TEST_F(InputHandlerTest, ProcessEventCarriesTimestamp) {
+    SDL_Event spaceDown = createKeyDownEvent(SDLK_SPACE);
+    spaceDown.key.timestamp = SDL_GetTicks() - 30; // Queued 30 ms ago
+    
+    InputEvent input = inputHandler->processEvent(spaceDown, GameState::Playing);
+    EXPECT_EQ(input.action, InputAction::Select);
+    EXPECT_NEAR(input.timestampMs, SongClock::hostTimeMs() - 30.0, 5.0);
+    
+    // Events that map to no action carry no time
+    SDL_Event spaceUp = createKeyUpEvent(SDLK_SPACE);
+    spaceUp.key.timestamp = SDL_GetTicks();
+    InputEvent release = inputHandler->processEvent(spaceUp, GameState::Playing);
+    EXPECT_EQ(release.action, InputAction::None);
+    EXPECT_LT(release.timestampMs, 0.0);
+}
+
 // Test all InputAction enum values
 TEST_F(InputHandlerTest, InputActionEnumValues) {
     // Test that all enum values are distinct
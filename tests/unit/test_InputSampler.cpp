@@ -0,0 +1,136 @@
+#include <gtest/gtest.h>
+#include <SDL.h>
+#include "InputSampler.hpp"
+#include "SongClock.hpp"
+
+#include <thread>
+
+namespace {
+
+SDL_Event makeKeyEvent(Uint32 type, SDL_Keycode key, Uint8 repeat = 0) {
+    SDL_Event event = {};
+    event.type = type;
+    event.key.keysym.sym = key;
+    event.key.repeat = repeat;
+    return event;
+}
+
+} // namespace
+
+// Test that the ring keeps order, reports full/empty and wraps around
+TEST(SpscRingTest, FifoAndCapacity) {
+    SpscRing<int, 8> ring;
+    EXPECT_TRUE(ring.empty());
+    EXPECT_EQ(ring.capacity(), 7u);
+
+    for (int i = 0; i < 7; ++i) {
+        EXPECT_TRUE(ring.push(i));
+    }
+    EXPECT_FALSE(ring.push(99)); // Full
+
+    int value = -1;
+    for (int round = 0; round < 3; ++round) {
+        // Pop a few and refill across the wrap point
+        for (int i = 0; i < 4; ++i) {
+            ASSERT_TRUE(ring.pop(value));
+        }
+        for (int i = 0; i < 4; ++i) {
+            EXPECT_TRUE(ring.push(100 + i));
+        }
+    }
+
+    ring.clear();
+    EXPECT_TRUE(ring.empty());
+    EXPECT_FALSE(ring.pop(value));
+}
+
+// Test one producer and one consumer thread passing every value through in order
+TEST(SpscRingTest, TwoThreadsKeepOrder) {
+    constexpr int kCount = 200000;
+    SpscRing<int, 64> ring;
+
+    std::thread producer([&ring]() {
+        for (int i = 0; i < kCount; ++i) {
+            while (!ring.push(i)) {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    int expected = 0;
+    int value = 0;
+    while (expected < kCount) {
+        if (ring.pop(value)) {
+            ASSERT_EQ(value, expected);
+            ++expected;
+        }
+    }
+    producer.join();
+    EXPECT_TRUE(ring.empty());
+}
+
+// Test which key events become gameplay records
+TEST(InputSamplerTest, TranslatesGameplayKeys) {
+    InputRecord record;
+    EXPECT_TRUE(InputSampler::translate(makeKeyEvent(SDL_KEYDOWN, SDLK_SPACE), 123.5, record));
+    EXPECT_EQ(record.action, InputAction::Select);
+    EXPECT_EQ(record.lane, 0);
+    EXPECT_TRUE(record.pressed);
+    EXPECT_DOUBLE_EQ(record.timestampMs, 123.5);
+
+    EXPECT_TRUE(InputSampler::translate(makeKeyEvent(SDL_KEYUP, SDLK_SPACE), 200.0, record));
+    EXPECT_FALSE(record.pressed);
+
+    EXPECT_TRUE(InputSampler::translate(makeKeyEvent(SDL_KEYDOWN, SDLK_ESCAPE), 0.0, record));
+    EXPECT_EQ(record.action, InputAction::Quit);
+
+    EXPECT_FALSE(InputSampler::translate(makeKeyEvent(SDL_KEYDOWN, SDLK_SPACE, 1), 0.0, record)); // Key repeat
+    EXPECT_FALSE(InputSampler::translate(makeKeyEvent(SDL_KEYDOWN, SDLK_UP), 0.0, record));
+}
+
+// Test that InputHandler applies the held-key rule to sampled records
+TEST(InputSamplerTest, HandlerConsumesRecords) {
+    ASSERT_EQ(SDL_Init(SDL_INIT_VIDEO), 0) << "SDL_Init failed: " << SDL_GetError();
+    {
+        InputHandler handler;
+        InputRecord press{InputAction::Select, 0, true, 50.0};
+        InputRecord release{InputAction::Select, 0, false, 90.0};
+
+        InputEvent first = handler.processGameInput(press);
+        EXPECT_EQ(first.action, InputAction::Select);
+        EXPECT_DOUBLE_EQ(first.timestampMs, 50.0);
+        EXPECT_EQ(handler.processGameInput(press).action, InputAction::None); // Still held
+        EXPECT_EQ(handler.processGameInput(release).action, InputAction::None);
+        EXPECT_FALSE(handler.isSpaceHeld());
+        EXPECT_EQ(handler.processGameInput(press).action, InputAction::Select);
+    }
+    SDL_Quit();
+}
+
+// Test that events reaching SDL's queue are captured and timestamped by the event watch
+TEST(InputSamplerTest, CapturesQueuedEvents) {
+    ASSERT_EQ(SDL_Init(SDL_INIT_VIDEO), 0) << "SDL_Init failed: " << SDL_GetError();
+    {
+        InputSampler sampler;
+        sampler.start();
+
+        double before = SongClock::hostTimeMs();
+        SDL_Event space = makeKeyEvent(SDL_KEYDOWN, SDLK_SPACE);
+        SDL_PushEvent(&space);
+        SDL_Event other = makeKeyEvent(SDL_KEYDOWN, SDLK_a);
+        SDL_PushEvent(&other);
+
+        InputRecord record;
+        ASSERT_TRUE(sampler.poll(record));
+        EXPECT_EQ(record.action, InputAction::Select);
+        EXPECT_GE(record.timestampMs, before);
+        EXPECT_LE(record.timestampMs, SongClock::hostTimeMs());
+        EXPECT_FALSE(sampler.poll(record));
+
+        sampler.stop();
+        SDL_PushEvent(&space);
+        EXPECT_FALSE(sampler.poll(record));
+        EXPECT_EQ(sampler.getDroppedCount(), 0u);
+    }
+    SDL_Quit();
+}
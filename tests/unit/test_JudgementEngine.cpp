@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+#include "JudgementEngine.hpp"
+#include "AudioLogic.hpp"
+
+#include <vector>
+
+// Test that presses are graded with the same windows as AudioLogic::checkHit
+TEST(JudgementEngineTest, GradesLikeAudioLogic) {
+    AudioLogic audioLogic;
+    JudgementEngine engine(audioLogic.getPERFECT(), audioLogic.getGOOD());
+    ASSERT_TRUE(engine.load({1000.0, 2000.0, 3000.0}));
+
+    JudgementResult perfect = engine.judgeHit(1040.0);
+    EXPECT_EQ(perfect.noteIndex, 0);
+    EXPECT_EQ(perfect.judgement, Judgement::Perfect);
+    EXPECT_DOUBLE_EQ(perfect.deltaMs, 40.0);
+    EXPECT_EQ(static_cast<short int>(perfect.judgement), audioLogic.checkHit(1000.0, 1040.0));
+
+    JudgementResult good = engine.judgeHit(1900.0);
+    EXPECT_EQ(good.noteIndex, 1);
+    EXPECT_EQ(good.judgement, Judgement::Good);
+
+    // Outside every window
+    JudgementResult none = engine.judgeHit(2500.0);
+    EXPECT_FALSE(none.isHit());
+    EXPECT_FALSE(engine.isResolved(2));
+}
+
+// Test that a note can only be hit once and the next press takes the following note
+TEST(JudgementEngineTest, EachNoteResolvesOnce) {
+    JudgementEngine engine;
+    ASSERT_TRUE(engine.load({1000.0, 1100.0}));
+
+    EXPECT_EQ(engine.judgeHit(1050.0).noteIndex, 0);
+    EXPECT_EQ(engine.judgeHit(1050.0).noteIndex, 1);
+    EXPECT_FALSE(engine.judgeHit(1050.0).isHit());
+    EXPECT_TRUE(engine.isFinished());
+}
+
+// Test that misses are resolved once their window closes and never counted twice
+TEST(JudgementEngineTest, ResolvesMissesAtCursor) {
+    JudgementEngine engine(60.0, 120.0);
+    ASSERT_TRUE(engine.load({1000.0, 1500.0, 2000.0, 2500.0}));
+
+    EXPECT_EQ(engine.resolveMisses(1120.0), 0); // Window closes after 1120
+    std::vector<int> missed;
+    EXPECT_EQ(engine.resolveMisses(1121.0, &missed), 1);
+    EXPECT_EQ(missed, std::vector<int>({0}));
+
+    EXPECT_EQ(engine.judgeHit(2000.0).noteIndex, 2); // Hit out of order - note 1 is still open
+    EXPECT_EQ(engine.getCursor(), 1u);
+
+    missed.clear();
+    EXPECT_EQ(engine.resolveMisses(2200.0, &missed), 1); // Note 1 missed, note 2 already hit
+    EXPECT_EQ(missed, std::vector<int>({1}));
+    EXPECT_EQ(engine.getCursor(), 3u);
+    EXPECT_EQ(engine.resolveMisses(2200.0), 0);
+}
+
+// Test that a late press skips notes whose window has closed but are not yet marked missed
+TEST(JudgementEngineTest, LatePressSkipsClosedNotes) {
+    JudgementEngine engine;
+    ASSERT_TRUE(engine.load({1000.0, 5000.0}));
+
+    JudgementResult result = engine.judgeHit(4950.0);
+    EXPECT_EQ(result.noteIndex, 1);
+    EXPECT_FALSE(engine.isResolved(0));
+    EXPECT_EQ(engine.resolveMisses(4950.0), 1);
+}
+
+// Test that seeking skips earlier notes without counting them as misses
+TEST(JudgementEngineTest, SeekSkipsPastNotes) {
+    std::vector<double> notes;
+    for (int i = 0; i < 100; ++i) {
+        notes.push_back(i * 100.0);
+    }
+    JudgementEngine engine(60.0, 120.0);
+    ASSERT_TRUE(engine.load(notes));
+
+    engine.seek(5000.0);
+    EXPECT_EQ(engine.getCursor(), 49u); // 4900 is still inside the window at 5000
+    EXPECT_TRUE(engine.isResolved(48));
+    EXPECT_EQ(engine.resolveMisses(5000.0), 0);
+    EXPECT_EQ(engine.judgeHit(5000.0).noteIndex, 49);
+
+    engine.reset();
+    EXPECT_EQ(engine.getCursor(), 0u);
+    EXPECT_FALSE(engine.isResolved(48));
+}
+
+// Test that unsorted charts are rejected
+TEST(JudgementEngineTest, RejectsUnsortedNotes) {
+    JudgementEngine engine;
+    EXPECT_FALSE(engine.load({2000.0, 1000.0}));
+    EXPECT_EQ(engine.getNoteCount(), 0u);
+    EXPECT_FALSE(engine.judgeHit(1000.0).isHit());
+}
@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+#include <SDL.h>
+#include <SDL_mixer.h>
+#include "PcmMusic.hpp"
+#include "Audio.hpp"
+#include "GameConfig.hpp"
+#include "SongClock.hpp"
+#include "support/AudioDeviceTest.hpp"
+
+#include <cstdio>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+const char* kWavPath = "test_pcm_music.wav";
+constexpr int kRate = AudioDeviceTest::kDeviceRate;
+constexpr int kChannels = AudioDeviceTest::kDeviceChannels;
+
+// Writes a 16-bit stereo WAV of the given length in the device's rate, so no conversion changes its size
+void writeWav(const char* path, double seconds) {
+    const uint32_t frames = static_cast<uint32_t>(kRate * seconds);
+    const uint32_t dataBytes = frames * kChannels * 2;
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    auto u32 = [&file](uint32_t value) { file.write(reinterpret_cast<const char*>(&value), 4); };
+    auto u16 = [&file](uint16_t value) { file.write(reinterpret_cast<const char*>(&value), 2); };
+
+    file.write("RIFF", 4);
+    u32(36 + dataBytes);
+    file.write("WAVEfmt ", 8);
+    u32(16);
+    u16(1); // PCM
+    u16(kChannels);
+    u32(kRate);
+    u32(kRate * kChannels * 2);
+    u16(kChannels * 2);
+    u16(16);
+    file.write("data", 4);
+    u32(dataBytes);
+    std::vector<int16_t> samples(static_cast<size_t>(frames) * kChannels, 1000);
+    file.write(reinterpret_cast<const char*>(samples.data()), dataBytes);
+}
+
+} // namespace
+
+class PcmMusicTest : public AudioDeviceTest {
+protected:
+    void TearDown() override {
+        AudioDeviceTest::TearDown();
+        GameConfig::getInstance().setPredecodeMusic(false);
+        std::remove(kWavPath);
+    }
+};
+
+// Test that a file decodes on the worker into a buffer of the expected size
+TEST_F(PcmMusicTest, DecodesOnWorker) {
+    writeWav(kWavPath, 1.0);
+
+    PcmMusic music;
+    music.startDecode(kWavPath);
+    ASSERT_TRUE(music.waitForDecode());
+    EXPECT_FALSE(music.isDecoding());
+    EXPECT_EQ(music.getPath(), kWavPath);
+    EXPECT_EQ(music.getStats().bytes, static_cast<size_t>(kRate * kChannels * 2));
+    EXPECT_NEAR(music.getStats().durationMs, 1000.0, 0.1);
+    EXPECT_GE(music.getStats().decodeMs, 0.0);
+
+    music.startDecode(kWavPath); // Same file: kept
+    EXPECT_FALSE(music.isDecoding());
+
+    PcmMusic missing;
+    missing.startDecode("does_not_exist.wav");
+    EXPECT_FALSE(missing.waitForDecode());
+    EXPECT_FALSE(missing.play());
+}
+
+// Test that the play cursor only moves forward, in whole frames, and playback ends with the buffer
+TEST_F(PcmMusicTest, CursorAdvancesToTheEnd) {
+    writeWav(kWavPath, 0.3);
+
+    PcmMusic music;
+    music.startDecode(kWavPath);
+    ASSERT_TRUE(music.play());
+    EXPECT_TRUE(music.isPlaying());
+
+    double previous = 0.0;
+    const double startMs = SongClock::hostTimeMs();
+    while (music.isPlaying() && SongClock::hostTimeMs() - startMs < 3000.0) {
+        double position = music.getPosition().positionMs;
+        EXPECT_GE(position, previous);
+        EXPECT_LE(position, 300.0 + 1e-9);
+        previous = position;
+        SDL_Delay(1);
+    }
+
+    EXPECT_FALSE(music.isPlaying());
+    EXPECT_NEAR(music.getPosition().positionMs, 300.0, 1e-9);
+    EXPECT_GT(music.getPosition().hostMs, startMs);
+
+    music.stop();
+    ASSERT_TRUE(music.play()); // Replays from memory
+    EXPECT_LT(music.getPosition().positionMs, 300.0);
+    music.release();
+    EXPECT_TRUE(music.getPath().empty());
+}
+
+// Test that Audio reports a pre-decoded song as playing until it ends. The song is hooked into the
+// mixer rather than played as Mix_Music, so Mix_PlayingMusic() stays 0 the whole time and must not
+// be what decides that the song is over.
+TEST_F(PcmMusicTest, AudioReportsHookedSongPlaying) {
+    writeWav(kWavPath, 0.3);
+    GameConfig::getInstance().setPredecodeMusic(true);
+
+    Audio audio;
+    ASSERT_TRUE(audio.isValid());
+    audio.playBackgroundMusic(kWavPath);
+    EXPECT_EQ(Mix_PlayingMusic(), 0);
+    EXPECT_TRUE(audio.isMusicPlaying());
+
+    const double startMs = SongClock::hostTimeMs();
+    while (audio.isMusicPlaying() && SongClock::hostTimeMs() - startMs < 3000.0) {
+        SDL_Delay(1);
+    }
+    EXPECT_FALSE(audio.isMusicPlaying());
+    EXPECT_GE(SongClock::hostTimeMs() - startMs, 250.0); // Played for about the song's length
+    audio.stopBackgroundMusic();
+}
@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+#include <SDL.h>
+#include <SDL_image.h>
+#include <SDL_ttf.h>
+#include "PerfOverlay.hpp"
+#include "RenderWindow.hpp"
+#include "Entity.hpp"
+#include "ResourceManager.hpp"
+#include "GameConfig.hpp"
+#include "support/TestAssets.hpp"
+
+// Test that frame rate and percentiles come from the recorded frame times
+TEST(PerfOverlayTest, ComputesFrameStats) {
+    PerfOverlay overlay;
+    EXPECT_EQ(overlay.getStats().frames, 0u);
+
+    // 98 frames at 60 FPS and two long ones
+    for (int i = 0; i < 98; ++i) {
+        overlay.recordFrame(1000.0 / 60.0);
+    }
+    overlay.recordFrame(50.0);
+    overlay.recordFrame(40.0);
+
+    PerfOverlayStats stats = overlay.getStats();
+    EXPECT_EQ(stats.frames, 100u);
+    EXPECT_DOUBLE_EQ(stats.lastMs, 40.0);
+    EXPECT_NEAR(stats.p50Ms, 1000.0 / 60.0, 0.001);
+    EXPECT_NEAR(stats.p99Ms, 40.0, 0.001);
+    EXPECT_NEAR(stats.fps, 100.0 * 1000.0 / (98.0 * 1000.0 / 60.0 + 90.0), 0.01);
+}
+
+// Test that only the most recent frames are kept
+TEST(PerfOverlayTest, HistoryIsBounded) {
+    PerfOverlay overlay;
+    for (size_t i = 0; i < PerfOverlay::kHistorySize; ++i) {
+        overlay.recordFrame(100.0);
+    }
+    for (size_t i = 0; i < PerfOverlay::kHistorySize; ++i) {
+        overlay.recordFrame(10.0);
+    }
+
+    PerfOverlayStats stats = overlay.getStats();
+    EXPECT_EQ(stats.frames, PerfOverlay::kHistorySize);
+    EXPECT_NEAR(stats.p99Ms, 10.0, 0.001);
+    EXPECT_NEAR(stats.fps, 100.0, 0.01);
+}
+
+// Test that a shown overlay, text included, leaves the frame's counters and the renderer draw color alone
+TEST(PerfOverlayTest, DrawsOutsideFrameStats) {
+    const std::string fontPath = findAsset(GameConfig::getInstance().getAssetPaths().fontPath);
+    if (fontPath.empty()) {
+        GTEST_SKIP() << "Font asset not available - test requires game assets";
+    }
+
+    ASSERT_EQ(SDL_Init(SDL_INIT_VIDEO), 0) << "SDL_Init failed: " << SDL_GetError();
+    ASSERT_NE(IMG_Init(IMG_INIT_PNG) & IMG_INIT_PNG, 0) << "IMG_Init failed: " << IMG_GetError();
+    ASSERT_EQ(TTF_Init(), 0) << "TTF_Init failed: " << TTF_GetError();
+    {
+        RenderWindow window("Overlay Test", 400, 200, SDL_WINDOW_HIDDEN);
+        ASSERT_TRUE(window.isValid()) << "Failed to create test render window";
+        ResourceManager resourceManager(window.getRenderer());
+        ASSERT_TRUE(resourceManager.isValid());
+
+        // The overlay draws its text from the same glyph atlas the game gives it
+        GlyphAtlas* glyphs = resourceManager.getGlyphAtlas(fontPath, GameConfig::getInstance().getFontSizes().perfOverlay);
+        ASSERT_NE(glyphs, nullptr);
+        window.getPerfOverlay().setGlyphs(glyphs);
+
+        SDL_Texture* texture = SDL_CreateTexture(window.getRenderer(), SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_STATIC, 16, 16);
+        ASSERT_NE(texture, nullptr);
+        Entity entity(0.0f, 0.0f, texture);
+
+        Uint8 before[4];
+        SDL_GetRenderDrawColor(window.getRenderer(), &before[0], &before[1], &before[2], &before[3]);
+
+        window.getPerfOverlay().setEnabled(true);
+        for (int frame = 0; frame < 3; ++frame) {
+            window.clear();
+            window.getPerfOverlay().setClockDriftMs(1.5);
+            window.render(entity);
+            window.display();
+
+            EXPECT_EQ(window.getFrameStats().drawCalls, 1);
+            EXPECT_EQ(window.getFrameStats().textureBinds, 1);
+        }
+        EXPECT_EQ(window.getPerfOverlay().getStats().frames, 2u); // Present to present
+
+        Uint8 after[4];
+        SDL_GetRenderDrawColor(window.getRenderer(), &after[0], &after[1], &after[2], &after[3]);
+        for (int i = 0; i < 4; ++i) {
+            EXPECT_EQ(before[i], after[i]);
+        }
+        window.getPerfOverlay().setGlyphs(nullptr);
+        SDL_DestroyTexture(texture);
+    }
+    TTF_Quit();
+    IMG_Quit();
+    SDL_Quit();
+}
@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+#include "Profiler.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+// Test fixture for Profiler tests - traces are written to the working directory and removed after
+class ProfilerTest : public ::testing::Test {
+protected:
+    void TearDown() override {
+        Profiler::endSession();
+        std::remove(tracePath.c_str());
+    }
+
+    std::string readTrace() const {
+        std::ifstream file(tracePath);
+        std::ostringstream text;
+        text << file.rdbuf();
+        return text.str();
+    }
+
+    static size_t countOccurrences(const std::string& text, const std::string& pattern) {
+        size_t count = 0;
+        for (size_t pos = text.find(pattern); pos != std::string::npos; pos = text.find(pattern, pos + 1)) {
+            count++;
+        }
+        return count;
+    }
+
+    const std::string tracePath = "test_trace.json";
+};
+
+// Test that nested zones from several threads end up in the trace with their thread names
+TEST_F(ProfilerTest, WritesChromeTrace) {
+    ASSERT_TRUE(Profiler::beginSession(tracePath));
+    {
+        ProfileZone outer("Outer");
+        ProfileZone inner("Inner");
+    }
+    std::thread worker([]() {
+        Profiler::setThreadName("Test worker");
+        ProfileZone zone("Worker zone");
+    });
+    worker.join();
+    EXPECT_EQ(Profiler::getRecordedCount(), 3u);
+    ASSERT_TRUE(Profiler::endSession());
+
+    std::string trace = readTrace();
+    EXPECT_EQ(trace.find("{\"displayTimeUnit\":\"ms\",\"traceEvents\":["), 0u);
+    EXPECT_EQ(countOccurrences(trace, "\"ph\":\"X\""), 3u);
+    EXPECT_NE(trace.find("\"name\":\"Outer\""), std::string::npos);
+    EXPECT_NE(trace.find("\"name\":\"Inner\""), std::string::npos);
+    EXPECT_NE(trace.find("\"name\":\"Worker zone\""), std::string::npos);
+    EXPECT_NE(trace.find("\"args\":{\"name\":\"Test worker\"}"), std::string::npos);
+}
+
+// Test that zones outside a session are not recorded and each session only holds its own zones
+TEST_F(ProfilerTest, RecordsOnlyDuringSession) {
+    {
+        ProfileZone before("Before");
+    }
+    ASSERT_TRUE(Profiler::beginSession(tracePath));
+    EXPECT_TRUE(Profiler::isRecording());
+    EXPECT_FALSE(Profiler::beginSession(tracePath)); // Already running
+    {
+        ProfileZone first("First session");
+    }
+    ASSERT_TRUE(Profiler::endSession());
+    EXPECT_FALSE(Profiler::isRecording());
+    EXPECT_FALSE(Profiler::endSession());
+    {
+        ProfileZone after("After");
+    }
+
+    ASSERT_TRUE(Profiler::beginSession(tracePath));
+    {
+        ProfileZone second("Second session");
+    }
+    ASSERT_TRUE(Profiler::endSession());
+
+    std::string trace = readTrace();
+    EXPECT_EQ(countOccurrences(trace, "\"ph\":\"X\""), 1u);
+    EXPECT_NE(trace.find("Second session"), std::string::npos);
+    EXPECT_EQ(trace.find("First session"), std::string::npos);
+    EXPECT_EQ(trace.find("Before"), std::string::npos);
+    EXPECT_EQ(trace.find("After"), std::string::npos);
+}
+
+// Test that zones spanning several buffer chunks are all exported
+TEST_F(ProfilerTest, GrowsAcrossChunks) {
+    const size_t zoneCount = Profiler::kChunkEvents * 2 + 10;
+    ASSERT_TRUE(Profiler::beginSession(tracePath));
+    for (size_t i = 0; i < zoneCount; ++i) {
+        ProfileZone zone("Loop");
+    }
+    EXPECT_EQ(Profiler::getRecordedCount(), zoneCount);
+    EXPECT_EQ(Profiler::getDroppedCount(), 0u);
+    ASSERT_TRUE(Profiler::endSession());
+
+    EXPECT_EQ(countOccurrences(readTrace(), "\"name\":\"Loop\""), zoneCount);
+}
+
+// Test that a session that filled its buffer does not make the next one drop zones
+TEST_F(ProfilerTest, CapIsPerSession) {
+    // Zones that started before the session count against the cap but are not written out
+    ASSERT_TRUE(Profiler::beginSession(tracePath));
+    for (size_t i = 0; i <= Profiler::kMaxEventsPerThread; ++i) {
+        Profiler::record("Old", 0, 0);
+    }
+    EXPECT_EQ(Profiler::getDroppedCount(), 1u);
+    ASSERT_TRUE(Profiler::endSession());
+
+    ASSERT_TRUE(Profiler::beginSession(tracePath));
+    {
+        ProfileZone zone("Next session");
+    }
+    EXPECT_EQ(Profiler::getRecordedCount(), 1u);
+    EXPECT_EQ(Profiler::getDroppedCount(), 0u);
+    ASSERT_TRUE(Profiler::endSession());
+
+    EXPECT_NE(readTrace().find("Next session"), std::string::npos);
+}
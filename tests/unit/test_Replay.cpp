@@ -0,0 +1,159 @@
+#include <gtest/gtest.h>
+#include "Replay.hpp"
+#include "JudgementEngine.hpp"
+
+#include <sstream>
+
+namespace {
+
+// 32 notes, 500 ms apart
+std::vector<double> makeNotes() {
+    std::vector<double> notes;
+    for (int i = 0; i < 32; ++i) {
+        notes.push_back(1000.0 + i * 500.0);
+    }
+    return notes;
+}
+
+// Plays a song the way RhythmGame does - presses and per-frame miss sweeps against a live
+// JudgementEngine - recording into replay and scoring into stats
+void playSong(const std::vector<double>& notes, double offsetMs, Replay& replay, GameStats& stats) {
+    JudgementEngine judgement(60.0, 120.0);
+    ASSERT_TRUE(judgement.load(notes));
+    replay.begin(1234u, notes, offsetMs, 60.0, 120.0);
+
+    // Presses land at varying errors; every fourth note is skipped, plus a few stray presses
+    std::vector<double> presses;
+    for (size_t i = 0; i < notes.size(); ++i) {
+        if (i % 4 == 3) {
+            continue;
+        }
+        presses.push_back(notes[i] + offsetMs + static_cast<double>(i % 7) * 25.0 - 60.0);
+    }
+    presses.push_back(700.0);
+    presses.push_back(notes[10] + 250.0);
+
+    // Frames every 16.7 ms; presses are judged at their own (earlier) time when the frame handles them
+    size_t nextPress = 0;
+    double frameMs = 0.0;
+    for (; frameMs < notes.back() + 1000.0; frameMs += 16.7) {
+        while (nextPress < presses.size() && presses[nextPress] <= frameMs) {
+            const double pressMs = presses[nextPress++];
+            replay.recordPress(pressMs);
+            JudgementResult result = judgement.judgeHit(pressMs - offsetMs);
+            if (result.isHit()) {
+                stats++;
+                stats.increaseScore(judgementScore(result.judgement));
+            }
+        }
+        int misses = judgement.resolveMisses(frameMs - offsetMs);
+        if (misses > 0) {
+            replay.recordMissSweep(frameMs);
+        }
+        for (int i = 0; i < misses; ++i) {
+            stats--;
+        }
+    }
+    replay.finish(frameMs, stats);
+}
+
+} // namespace
+
+// Test that playback reproduces the recorded stats without a window or audio
+TEST(ReplayTest, PlaybackMatchesRecording) {
+    const std::vector<double> notes = makeNotes();
+    Replay replay;
+    GameStats stats;
+    playSong(notes, 15.0, replay, stats);
+    ASSERT_GT(stats.getHits(), 0);
+    ASSERT_GT(stats.getMisses(), 0);
+
+    ReplayResult result = replay.play(notes, 1000.0 / 120.0);
+    EXPECT_TRUE(result.valid);
+    EXPECT_TRUE(result.matches);
+    EXPECT_EQ(result.stats.getScore(), stats.getScore());
+    EXPECT_EQ(result.stats.getHits(), stats.getHits());
+    EXPECT_EQ(result.stats.getMisses(), stats.getMisses());
+    EXPECT_GT(result.steps, 0u);
+}
+
+// Test that a saved replay loads back bit-exact and still matches
+TEST(ReplayTest, SaveLoadRoundTrip) {
+    const std::vector<double> notes = makeNotes();
+    Replay recorded;
+    GameStats stats;
+    playSong(notes, -7.3, recorded, stats);
+
+    std::stringstream file;
+    ASSERT_TRUE(recorded.save(file));
+
+    Replay loaded;
+    ASSERT_TRUE(loaded.load(file, "memory"));
+    EXPECT_EQ(loaded.getSeed(), 1234u);
+    EXPECT_EQ(loaded.getNoteCount(), notes.size());
+    EXPECT_EQ(loaded.getNoteHash(), Replay::hashNotes(notes));
+    EXPECT_DOUBLE_EQ(loaded.getInputOffsetMs(), -7.3);
+    ASSERT_EQ(loaded.getEvents().size(), recorded.getEvents().size());
+    for (size_t i = 0; i < loaded.getEvents().size(); ++i) {
+        EXPECT_EQ(loaded.getEvents()[i].type, recorded.getEvents()[i].type);
+        EXPECT_EQ(loaded.getEvents()[i].songTimeMs, recorded.getEvents()[i].songTimeMs);
+    }
+
+    ReplayResult result = loaded.play(notes, 1000.0 / 120.0);
+    EXPECT_TRUE(result.matches);
+}
+
+// Test that a different chart is refused and changed rules are reported as a mismatch
+TEST(ReplayTest, DetectsChartAndResultChanges) {
+    std::vector<double> notes = makeNotes();
+    Replay replay;
+    GameStats stats;
+    playSong(notes, 0.0, replay, stats);
+
+    std::vector<double> otherChart = notes;
+    otherChart[5] += 1.0;
+    EXPECT_FALSE(replay.play(otherChart, 1000.0 / 120.0).valid);
+
+    std::stringstream file;
+    ASSERT_TRUE(replay.save(file));
+    std::string text = file.str();
+    const std::string result = "result " + std::to_string(stats.getScore());
+    const size_t at = text.find(result);
+    ASSERT_NE(at, std::string::npos);
+    text.replace(at, result.size(), "result " + std::to_string(stats.getScore() + 500));
+
+    std::istringstream tampered(text);
+    Replay loaded;
+    ASSERT_TRUE(loaded.load(tampered, "memory"));
+    ReplayResult played = loaded.play(notes, 1000.0 / 120.0);
+    EXPECT_TRUE(played.valid);
+    EXPECT_FALSE(played.matches);
+}
+
+// Test that malformed files are rejected
+TEST(ReplayTest, RejectsMalformedFiles) {
+    Replay replay;
+    std::istringstream noVersion("seed 1\nresult 0 0 0\n");
+    EXPECT_FALSE(replay.load(noVersion, "memory"));
+
+    std::istringstream badEvent("version 1\nresult 0 0 0\np soon\n");
+    EXPECT_FALSE(replay.load(badEvent, "memory"));
+
+    std::istringstream noResult("version 1\np 100\n");
+    EXPECT_FALSE(replay.load(noResult, "memory"));
+    EXPECT_FALSE(replay.isLoaded());
+
+    // Event times outside the song: one far in the future must not make playback spin
+    std::istringstream farEvent("version 1\nend 5000\nresult 0 0 0\np 1e13\n");
+    EXPECT_FALSE(replay.load(farEvent, "memory"));
+    std::istringstream negativeEvent("version 1\nend 5000\nresult 0 0 0\np -20\n");
+    EXPECT_FALSE(replay.load(negativeEvent, "memory"));
+    std::istringstream badEnd("version 1\nend -1\nresult 0 0 0\n");
+    EXPECT_FALSE(replay.load(badEnd, "memory"));
+    std::istringstream inside("version 1\nend 5000\nresult 0 0 0\np 0\nm 5000\n");
+    EXPECT_TRUE(replay.load(inside, "memory"));
+
+    Replay unfinished;
+    std::ostringstream output;
+    EXPECT_FALSE(unfinished.save(output));
+}
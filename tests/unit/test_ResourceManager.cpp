@@ -365,4 +365,212 @@ TEST_F(ResourceManagerTest, TextTextureCaching) {
     EXPECT_EQ(tex2, nullptr);
     EXPECT_EQ(tex3, nullptr);
     EXPECT_EQ(tex4, nullptr);
-}
\ No newline at end of file
+}
+// Test cache counters for hits and misses
+TEST_F(ResourceManagerTest, TextureCacheHitMissCounters) {
+    ResourceManager resourceManager(renderer);
+    EXPECT_TRUE(resourceManager.isValid());
+    
+    std::string testFile = "test_counters.png";
+    ASSERT_TRUE(createTestImage(testFile, 16, 16));
+    
+    resourceManager.loadTexture(testFile);
+    resourceManager.loadTexture(testFile);
+    resourceManager.loadTexture(testFile);
+    
+    TextureCacheStats stats = resourceManager.getTextureCacheStats();
+    EXPECT_EQ(stats.misses, 1u);
+    EXPECT_EQ(stats.hits, 2u);
+    EXPECT_EQ(stats.liveTextures, 1u);
+    EXPECT_EQ(stats.liveBytes, 16u * 16u * 4u);
+    
+    std::remove(testFile.c_str());
+}
+
+// Test that going over budget evicts the least recently used texture
+TEST_F(ResourceManagerTest, TextureCacheEvictsLeastRecentlyUsed) {
+    ResourceManager resourceManager(renderer);
+    EXPECT_TRUE(resourceManager.isValid());
+    
+    // Each 32x32 RGBA texture is 4096 bytes - budget fits two
+    resourceManager.setTextureBudget(2 * 32 * 32 * 4);
+    
+    std::string fileA = "test_lru_a.png";
+    std::string fileB = "test_lru_b.png";
+    std::string fileC = "test_lru_c.png";
+    ASSERT_TRUE(createTestImage(fileA));
+    ASSERT_TRUE(createTestImage(fileB));
+    ASSERT_TRUE(createTestImage(fileC));
+    
+    resourceManager.loadTexture(fileA);
+    resourceManager.loadTexture(fileB);
+    resourceManager.loadTexture(fileA); // A is now more recent than B
+    resourceManager.loadTexture(fileC); // Evicts B
+    
+    TextureCacheStats stats = resourceManager.getTextureCacheStats();
+    EXPECT_EQ(stats.evictions, 1u);
+    EXPECT_EQ(stats.liveTextures, 2u);
+    EXPECT_LE(stats.liveBytes, stats.budgetBytes);
+    
+    // A is still cached (hit), B has to be reloaded (miss)
+    size_t missesBefore = stats.misses;
+    resourceManager.loadTexture(fileA);
+    EXPECT_EQ(resourceManager.getTextureCacheStats().misses, missesBefore);
+    resourceManager.loadTexture(fileB);
+    EXPECT_EQ(resourceManager.getTextureCacheStats().misses, missesBefore + 1);
+    
+    std::remove(fileA.c_str());
+    std::remove(fileB.c_str());
+    std::remove(fileC.c_str());
+}
+
+// Test that pinned textures survive eviction
+TEST_F(ResourceManagerTest, PinnedTexturesAreNotEvicted) {
+    ResourceManager resourceManager(renderer);
+    EXPECT_TRUE(resourceManager.isValid());
+    
+    resourceManager.setTextureBudget(32 * 32 * 4);
+    
+    std::string fileA = "test_pin_a.png";
+    std::string fileB = "test_pin_b.png";
+    ASSERT_TRUE(createTestImage(fileA));
+    ASSERT_TRUE(createTestImage(fileB));
+    
+    TextureHandle pinnedHandle = resourceManager.acquireTexture(fileA);
+    SDL_Texture* pinned = resourceManager.getTexture(pinnedHandle);
+    ASSERT_NE(pinned, nullptr);
+    {
+        ScopedTexturePins pins(resourceManager, { pinnedHandle });
+        EXPECT_TRUE(resourceManager.isTexturePinned(pinnedHandle));
+        
+        resourceManager.loadTexture(fileB);
+        
+        // Over budget, but nothing unpinned other than the new texture to evict
+        TextureCacheStats stats = resourceManager.getTextureCacheStats();
+        EXPECT_EQ(stats.evictions, 0u);
+        EXPECT_EQ(stats.liveTextures, 2u);
+        EXPECT_EQ(resourceManager.loadTexture(fileA), pinned);
+    }
+    EXPECT_FALSE(resourceManager.isTexturePinned(pinnedHandle));
+    
+    // Once unpinned, shrinking the budget evicts it
+    resourceManager.setTextureBudget(0);
+    EXPECT_EQ(resourceManager.getTextureCacheStats().liveTextures, 0u);
+    EXPECT_EQ(resourceManager.getTextureCacheStats().liveBytes, 0u);
+    
+    std::remove(fileA.c_str());
+    std::remove(fileB.c_str());
+}
+
+// Test that unpinning through a stale handle leaves the pin of the texture that reused its slot
+TEST_F(ResourceManagerTest, StaleHandleCannotUnpinReusedSlot) {
+    ResourceManager resourceManager(renderer);
+    EXPECT_TRUE(resourceManager.isValid());
+    
+    std::string fileA = "test_stale_pin_a.png";
+    std::string fileB = "test_stale_pin_b.png";
+    ASSERT_TRUE(createTestImage(fileA));
+    ASSERT_TRUE(createTestImage(fileB));
+    
+    TextureHandle oldHandle = resourceManager.acquireTexture(fileA);
+    ASSERT_TRUE(resourceManager.isHandleValid(oldHandle));
+    resourceManager.pinTexture(oldHandle);
+    resourceManager.releaseTexture(oldHandle);
+    
+    TextureHandle newHandle = resourceManager.acquireTexture(fileB);
+    EXPECT_EQ(newHandle.index, oldHandle.index); // Slot reused
+    resourceManager.pinTexture(newHandle);
+    
+    resourceManager.unpinTexture(oldHandle);
+    EXPECT_FALSE(resourceManager.isTexturePinned(oldHandle));
+    EXPECT_TRUE(resourceManager.isTexturePinned(newHandle));
+    
+    // Still pinned, so a zero budget cannot evict it
+    resourceManager.setTextureBudget(0);
+    EXPECT_EQ(resourceManager.getTextureCacheStats().liveTextures, 1u);
+    
+    std::remove(fileA.c_str());
+    std::remove(fileB.c_str());
+}
+
+// Test that a handle outlives eviction: resolving it reloads the texture
+TEST_F(ResourceManagerTest, TextureHandleReloadsAfterEviction) {
+    ResourceManager resourceManager(renderer);
+    EXPECT_TRUE(resourceManager.isValid());
+    
+    std::string fileA = "test_handle_a.png";
+    std::string fileB = "test_handle_b.png";
+    ASSERT_TRUE(createTestImage(fileA));
+    ASSERT_TRUE(createTestImage(fileB));
+    
+    TextureHandle handleA = resourceManager.acquireTexture(fileA);
+    ASSERT_TRUE(handleA.isValid());
+    EXPECT_EQ(resourceManager.acquireTexture(fileA), handleA); // Interned - same handle
+    
+    // Budget fits one texture - loading B evicts A
+    resourceManager.setTextureBudget(32 * 32 * 4);
+    TextureHandle handleB = resourceManager.acquireTexture(fileB);
+    ASSERT_TRUE(handleB.isValid());
+    EXPECT_EQ(resourceManager.getTextureCacheStats().evictions, 1u);
+    EXPECT_TRUE(resourceManager.isHandleValid(handleA));
+    
+    size_t missesBefore = resourceManager.getTextureCacheStats().misses;
+    SDL_Texture* reloaded = resourceManager.getTexture(handleA);
+    EXPECT_NE(reloaded, nullptr);
+    EXPECT_EQ(resourceManager.getTextureCacheStats().misses, missesBefore + 1);
+    EXPECT_EQ(resourceManager.getTexture(handleA), reloaded);
+    
+    std::remove(fileA.c_str());
+    std::remove(fileB.c_str());
+}
+
+// Test that released handles go stale even when their slot is reused
+TEST_F(ResourceManagerTest, ReleasedTextureHandleIsStale) {
+    ResourceManager resourceManager(renderer);
+    EXPECT_TRUE(resourceManager.isValid());
+    
+    std::string fileA = "test_stale_a.png";
+    std::string fileB = "test_stale_b.png";
+    ASSERT_TRUE(createTestImage(fileA));
+    ASSERT_TRUE(createTestImage(fileB));
+    
+    TextureHandle handleA = resourceManager.acquireTexture(fileA);
+    ASSERT_TRUE(handleA.isValid());
+    resourceManager.releaseTexture(handleA);
+    
+    EXPECT_FALSE(resourceManager.isHandleValid(handleA));
+    EXPECT_EQ(resourceManager.getTexture(handleA), nullptr);
+    EXPECT_EQ(resourceManager.getTextureCacheStats().liveTextures, 0u);
+    
+    // The slot is recycled for B with a new generation
+    TextureHandle handleB = resourceManager.acquireTexture(fileB);
+    EXPECT_EQ(handleB.index, handleA.index);
+    EXPECT_NE(handleB.generation, handleA.generation);
+    EXPECT_EQ(resourceManager.getTexture(handleA), nullptr);
+    EXPECT_NE(resourceManager.getTexture(handleB), nullptr);
+    
+    // cleanup() releases everything
+    resourceManager.cleanup();
+    EXPECT_FALSE(resourceManager.isHandleValid(handleB));
+    
+    std::remove(fileA.c_str());
+    std::remove(fileB.c_str());
+}
+
+// Test that invalid input never produces a usable handle
+TEST_F(ResourceManagerTest, InvalidHandles) {
+    ResourceManager resourceManager(renderer);
+    EXPECT_TRUE(resourceManager.isValid());
+    
+    EXPECT_FALSE(resourceManager.acquireTexture("").isValid());
+    EXPECT_FALSE(resourceManager.acquireTexture("nonexistent_handle.png").isValid());
+    EXPECT_FALSE(resourceManager.acquireFont("nonexistent_font.ttf", 20).isValid());
+    EXPECT_FALSE(resourceManager.acquireTextTexture(FontHandle(), "Hello", {255, 255, 255, 255}).isValid());
+    
+    EXPECT_EQ(resourceManager.getTexture(TextureHandle()), nullptr);
+    EXPECT_EQ(resourceManager.getFont(FontHandle()), nullptr);
+    EXPECT_FALSE(resourceManager.getRegion(TextureHandle()).isValid());
+    
+    ResourceManager invalidRM(nullptr);
+    EXPECT_FALSE(invalidRM.acquireTexture("any_file.png").isValid());
+}
@@ -0,0 +1,146 @@
+#include <gtest/gtest.h>
+#include "SongClock.hpp"
+
+#include <cmath>
+
+namespace {
+
+// Audio position as SDL_mixer reports it: advances only once per 2048-frame buffer at 44.1 kHz
+constexpr double kBufferMs = 2048.0 * 1000.0 / 44100.0;
+
+double steppedAudio(double trueAudioMs) {
+    return std::floor(trueAudioMs / kBufferMs) * kBufferMs;
+}
+
+} // namespace
+
+// Test that the fused clock follows the true position between audio steps and never goes back
+TEST(SongClockTest, SmoothsSteppedAudio) {
+    SongClock clock;
+    clock.start(5000.0);
+
+    double previous = 0.0;
+    double worstError = 0.0;
+    for (double host = 5000.0; host < 15000.0; host += 1.0) {
+        double trueAudio = host - 5000.0;
+        double time = clock.update(host, steppedAudio(trueAudio));
+        EXPECT_GE(time, previous);
+        previous = time;
+        if (host > 6000.0) {
+            worstError = std::max(worstError, std::fabs(time - trueAudio));
+        }
+    }
+
+    // The raw staircase is up to a whole buffer (~46 ms) behind
+    EXPECT_LT(worstError, 5.0);
+    EXPECT_NEAR(clock.getStats().rate, 1.0, 0.01);
+    EXPECT_EQ(clock.getStats().resyncs, 0u);
+    EXPECT_GT(clock.getStats().samples, 200u);
+}
+
+// Test that a sound card running slightly fast is tracked through the fitted rate
+TEST(SongClockTest, TracksAudioDrift) {
+    SongClock clock;
+    clock.start(0.0);
+
+    double time = 0.0;
+    for (double host = 0.0; host < 20000.0; host += 2.0) {
+        time = clock.update(host, steppedAudio(host * 1.002));
+    }
+    EXPECT_NEAR(clock.getStats().rate, 1.002, 0.001);
+    EXPECT_NEAR(time, 20000.0 * 1.002, 5.0);
+}
+
+// Test that the clock runs on host time when no audio position is available
+TEST(SongClockTest, FallsBackToHostTime) {
+    SongClock clock;
+    clock.start(100.0);
+
+    EXPECT_DOUBLE_EQ(clock.update(100.0, -1.0), 0.0);
+    EXPECT_DOUBLE_EQ(clock.update(112.25, -1.0), 12.25); // Sub-millisecond precision is kept
+    EXPECT_DOUBLE_EQ(clock.getTimeMs(), 12.25);
+}
+
+// Test that a jump in the audio position restarts the fit without moving the clock backwards
+TEST(SongClockTest, ResyncsAfterJump) {
+    SongClock clock;
+    clock.start(0.0);
+    for (double host = 0.0; host < 2000.0; host += 1.0) {
+        clock.update(host, steppedAudio(host));
+    }
+    double beforeJump = clock.getTimeMs();
+
+    // Audio stalled for half a second and comes back behind
+    double time = clock.update(2000.0, 1500.0);
+    EXPECT_EQ(clock.getStats().resyncs, 1u);
+    EXPECT_GE(time, beforeJump);
+
+    // Then catches up with the new position
+    for (double host = 2001.0; host < 3000.0; host += 1.0) {
+        time = clock.update(host, steppedAudio(host - 500.0));
+    }
+    EXPECT_NEAR(time, 2500.0, 5.0);
+}
+
+// Test that the output latency moves song time back to what is being heard
+TEST(SongClockTest, SubtractsOutputLatency) {
+    SongClock clock;
+    clock.setOutputLatencyMs(11.6);
+    clock.start(0.0);
+    EXPECT_DOUBLE_EQ(clock.getOutputLatencyMs(), 11.6); // Kept across start()
+
+    double time = 0.0;
+    for (double host = 0.0; host < 3000.0; host += 1.0) {
+        time = clock.update(host, steppedAudio(host));
+    }
+    EXPECT_NEAR(time, 3000.0 - 11.6, 5.0);
+    EXPECT_EQ(clock.getStats().resyncs, 0u);
+
+    // No audio position: host time alone, nothing to correct
+    clock.start(0.0);
+    EXPECT_DOUBLE_EQ(clock.update(20.0, -1.0), 20.0);
+}
+
+// Test that positions stamped when the mixer produced them are placed at that time, not when read
+TEST(SongClockTest, UsesAudioSampleTimes) {
+    SongClock clock;
+    clock.start(0.0);
+
+    // Read once per 16 ms frame, up to a frame after the mixer callback that set the position
+    double time = 0.0;
+    double host = 0.0;
+    for (; host < 3000.0; host += 16.0) {
+        double callbackHost = std::floor(host / kBufferMs) * kBufferMs;
+        time = clock.update(host, callbackHost, callbackHost);
+    }
+    EXPECT_NEAR(time, host - 16.0, 1.0);
+    EXPECT_LT(clock.getStats().maxErrorMs, 0.5);
+}
+
+// Test that past host times map onto the song timeline for judging input events
+TEST(SongClockTest, MapsEarlierHostTimes) {
+    SongClock clock;
+    clock.start(1000.0);
+    EXPECT_DOUBLE_EQ(clock.toSongTime(1250.5), 250.5); // Host time only before any audio
+
+    for (double host = 1000.0; host < 4000.0; host += 1.0) {
+        clock.update(host, steppedAudio(host - 1000.0));
+    }
+    EXPECT_NEAR(clock.toSongTime(3970.0), 2970.0, 5.0);
+    EXPECT_LT(clock.toSongTime(3970.0), clock.getTimeMs());
+}
+
+// Test that drift against host time stays flat on a matching sound card and grows on a fast one
+TEST(SongClockTest, ReportsDriftAgainstHostTime) {
+    SongClock matching;
+    SongClock fast;
+    matching.start(0.0);
+    fast.start(0.0);
+
+    for (double host = 0.0; host < 20000.0; host += 2.0) {
+        matching.update(host, steppedAudio(host));
+        fast.update(host, steppedAudio(host * 1.002));
+    }
+    EXPECT_NEAR(matching.getDriftMs(), 0.0, 5.0);
+    EXPECT_NEAR(fast.getDriftMs(), 20000.0 * 0.002, 5.0);
+}
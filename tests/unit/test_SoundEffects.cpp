@@ -0,0 +1,53 @@
+#include <gtest/gtest.h>
+#include <SDL.h>
+#include <SDL_mixer.h>
+#include "SoundEffects.hpp"
+#include "support/AudioDeviceTest.hpp"
+
+#include <vector>
+
+class SoundEffectsTest : public AudioDeviceTest {};
+
+// Test that the pool is reserved, so automatic channel picks never take a hit sound's voice
+TEST_F(SoundEffectsTest, ReservesChannelPool) {
+    const int channelsBefore = Mix_AllocateChannels(-1);
+    {
+        SoundEffects sfx;
+        ASSERT_TRUE(sfx.initialize(8));
+        EXPECT_TRUE(sfx.isReady());
+        EXPECT_EQ(sfx.getVoiceCount(), 8);
+        EXPECT_EQ(Mix_AllocateChannels(-1), channelsBefore + 8);
+
+        int channel = sfx.play(SoundId::HitPerfect);
+        EXPECT_GE(channel, 0);
+        EXPECT_LT(channel, 8);
+
+        std::vector<Uint8> pcm;
+        ASSERT_TRUE(SoundEffects::synthesizeTone(ToneSpec(), pcm));
+        Mix_Chunk* other = Mix_QuickLoad_RAW(pcm.data(), static_cast<Uint32>(pcm.size()));
+        ASSERT_NE(other, nullptr);
+        EXPECT_GE(Mix_PlayChannel(-1, other, 0), 8);
+        Mix_HaltChannel(-1);
+        Mix_FreeChunk(other);
+
+        sfx.shutdown();
+        EXPECT_FALSE(sfx.isReady());
+        EXPECT_EQ(sfx.play(SoundId::HitGood), -1);
+    }
+    EXPECT_EQ(Mix_AllocateChannels(-1), channelsBefore);
+}
+
+// Test that synthesized tones match the device format and length
+TEST_F(SoundEffectsTest, SynthesizesInDeviceFormat) {
+    int frequency = 0;
+    Uint16 format = 0;
+    int channels = 0;
+    ASSERT_NE(Mix_QuerySpec(&frequency, &format, &channels), 0);
+
+    ToneSpec tone;
+    tone.durationMs = 100.0;
+    std::vector<Uint8> pcm;
+    ASSERT_TRUE(SoundEffects::synthesizeTone(tone, pcm));
+    const size_t frames = static_cast<size_t>(frequency * 0.1);
+    EXPECT_EQ(pcm.size(), frames * channels * (SDL_AUDIO_BITSIZE(format) / 8));
+}
@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+#include <SDL.h>
+#include "SpriteBatch.hpp"
+#include "RenderWindow.hpp"
+#include "Entity.hpp"
+
+#include <memory>
+
+// Test fixture for SpriteBatch tests - a hidden window and two small textures
+class SpriteBatchTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        ASSERT_EQ(SDL_Init(SDL_INIT_VIDEO), 0) << "SDL_Init failed: " << SDL_GetError();
+
+        window = std::make_unique<RenderWindow>("Batch Test", 200, 200, SDL_WINDOW_HIDDEN);
+        ASSERT_TRUE(window->isValid()) << "Failed to create test render window";
+
+        textureA = createTexture(32, 32);
+        textureB = createTexture(64, 16);
+        ASSERT_NE(textureA, nullptr);
+        ASSERT_NE(textureB, nullptr);
+    }
+
+    void TearDown() override {
+        SDL_DestroyTexture(textureA);
+        SDL_DestroyTexture(textureB);
+        window.reset();
+        SDL_Quit();
+    }
+
+    SDL_Texture* createTexture(int width, int height) {
+        return SDL_CreateTexture(window->getRenderer(), SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_STATIC, width, height);
+    }
+
+    std::unique_ptr<RenderWindow> window;
+    SDL_Texture* textureA = nullptr;
+    SDL_Texture* textureB = nullptr;
+};
+
+// Test that interleaved submissions collapse into one draw per texture
+TEST_F(SpriteBatchTest, GroupsByTexture) {
+    SpriteBatch batch;
+    const SDL_Rect src = {0, 0, 16, 16};
+    for (int i = 0; i < 100; ++i) {
+        SDL_FRect dst = {static_cast<float>(i), 0.0f, 16.0f, 16.0f};
+        batch.submit(i % 2 ? textureA : textureB, src, dst, {255, 255, 255, 255});
+    }
+    EXPECT_EQ(batch.size(), 100u);
+
+    SpriteBatch::FlushResult result = batch.flush(window->getRenderer());
+    EXPECT_EQ(result.drawCalls, 2);
+    EXPECT_EQ(result.textureBinds, 2);
+    EXPECT_EQ(result.sprites, 100);
+    EXPECT_TRUE(batch.empty());
+}
+
+// Test that layers split groups and a texture continuing across layers is not rebound
+TEST_F(SpriteBatchTest, LayersDrawInOrder) {
+    SpriteBatch batch;
+    const SDL_Rect src = {0, 0, 8, 8};
+    const SDL_FRect dst = {0.0f, 0.0f, 8.0f, 8.0f};
+    batch.submit(textureA, src, dst, {255, 255, 255, 255}, 2);
+    batch.submit(textureB, src, dst, {255, 255, 255, 255}, 0);
+    batch.submit(textureA, src, dst, {255, 255, 255, 255}, 1);
+
+    SpriteBatch::FlushResult result = batch.flush(window->getRenderer());
+    EXPECT_EQ(result.drawCalls, 3);
+    EXPECT_EQ(result.textureBinds, 2); // B, then A for layers 1 and 2
+    EXPECT_EQ(result.lastTexture, textureA);
+}
+
+// Test that unusable quads are dropped at submit time
+TEST_F(SpriteBatchTest, IgnoresInvalidQuads) {
+    SpriteBatch batch;
+    batch.submit(nullptr, {0, 0, 8, 8}, {0.0f, 0.0f, 8.0f, 8.0f}, {255, 255, 255, 255});
+    batch.submit(textureA, {0, 0, 0, 8}, {0.0f, 0.0f, 8.0f, 8.0f}, {255, 255, 255, 255});
+    batch.submit(textureA, {0, 0, 8, 8}, {0.0f, 0.0f, 0.0f, 8.0f}, {255, 255, 255, 255});
+    EXPECT_TRUE(batch.empty());
+
+    SpriteBatch::FlushResult result = batch.flush(window->getRenderer());
+    EXPECT_EQ(result.drawCalls, 0);
+}
+
+// Test that RenderWindow draws submitted entities on display() and counts them in frame stats
+TEST_F(SpriteBatchTest, RenderWindowFlushesOnDisplay) {
+    std::vector<Entity> entities;
+    for (int i = 0; i < 50; ++i) {
+        entities.emplace_back(static_cast<float>(i * 2), 0.0f, i % 2 ? textureA : textureB);
+    }
+
+    window->clear();
+    for (auto& entity : entities) {
+        window->submit(entity);
+    }
+    window->display();
+
+    const RenderStats& stats = window->getFrameStats();
+    EXPECT_EQ(stats.drawCalls, 2);
+    EXPECT_EQ(stats.batchedSprites, 50);
+}
+
+// Test that an immediate draw flushes pending quads so it still lands on top
+TEST_F(SpriteBatchTest, ImmediateRenderFlushesBatch) {
+    Entity background(0, 0, textureA);
+    Entity overlay(0, 0, textureB);
+
+    window->clear();
+    window->submit(background);
+    window->render(overlay);
+    window->display();
+
+    const RenderStats& stats = window->getFrameStats();
+    EXPECT_EQ(stats.drawCalls, 2);
+    EXPECT_EQ(stats.batchedSprites, 1);
+    EXPECT_EQ(stats.textureBinds, 2);
+}
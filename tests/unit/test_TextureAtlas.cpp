@@ -0,0 +1,211 @@
+#include <gtest/gtest.h>
+#include <SDL.h>
+#include <SDL_image.h>
+#include "TextureAtlas.hpp"
+#include "RenderWindow.hpp"
+#include "Sprite.hpp"
+
+#include <memory>
+
+// Test fixture for TextureAtlas tests that handles SDL initialization
+class TextureAtlasTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        ASSERT_EQ(SDL_Init(SDL_INIT_VIDEO), 0) << "SDL_Init failed: " << SDL_GetError();
+        ASSERT_NE(IMG_Init(IMG_INIT_PNG) & IMG_INIT_PNG, 0) << "IMG_Init failed: " << IMG_GetError();
+
+        window = std::make_unique<RenderWindow>("Atlas Test", 100, 100, SDL_WINDOW_HIDDEN);
+        ASSERT_TRUE(window->isValid()) << "Failed to create test render window";
+    }
+
+    void TearDown() override {
+        for (SDL_Surface* surface : surfaces) {
+            SDL_FreeSurface(surface);
+        }
+        window.reset();
+        IMG_Quit();
+        SDL_Quit();
+    }
+
+    // Helper to create a solid colored surface that the test owns
+    SDL_Surface* createSurface(int width, int height, Uint8 r, Uint8 g, Uint8 b) {
+        SDL_Surface* surface = SDL_CreateRGBSurfaceWithFormat(0, width, height, 32, SDL_PIXELFORMAT_RGBA32);
+        if (surface) {
+            SDL_FillRect(surface, nullptr, SDL_MapRGBA(surface->format, r, g, b, 255));
+            surfaces.push_back(surface);
+        }
+        return surface;
+    }
+
+    static bool overlaps(const AtlasPacker::Placement& a, std::pair<int, int> sizeA,
+                         const AtlasPacker::Placement& b, std::pair<int, int> sizeB) {
+        if (a.page != b.page) return false;
+        return a.x < b.x + sizeB.first && b.x < a.x + sizeA.first &&
+               a.y < b.y + sizeB.second && b.y < a.y + sizeA.second;
+    }
+
+    std::unique_ptr<RenderWindow> window;
+    std::vector<SDL_Surface*> surfaces;
+};
+
+// Test that the packer keeps every item on the page and never overlaps two items
+TEST_F(TextureAtlasTest, PackerPlacementsFitWithoutOverlap) {
+    std::vector<std::pair<int, int>> sizes = {
+        {1920, 1080}, {768, 128}, {768, 128}, {768, 128}, {512, 256},
+        {384, 256}, {106, 200}, {584, 349}, {400, 147}
+    };
+
+    AtlasPacker packer(2048, 2048);
+    auto placements = packer.pack(sizes);
+    ASSERT_EQ(placements.size(), sizes.size());
+    EXPECT_EQ(packer.getPageCount(), 1);
+
+    for (size_t i = 0; i < placements.size(); ++i) {
+        EXPECT_EQ(placements[i].page, 0);
+        EXPECT_GE(placements[i].x, 0);
+        EXPECT_GE(placements[i].y, 0);
+        EXPECT_LE(placements[i].x + sizes[i].first, 2048);
+        EXPECT_LE(placements[i].y + sizes[i].second, 2048);
+
+        for (size_t j = i + 1; j < placements.size(); ++j) {
+            EXPECT_FALSE(overlaps(placements[i], sizes[i], placements[j], sizes[j]))
+                << "Items " << i << " and " << j << " overlap";
+        }
+    }
+}
+
+// Test that the packer opens new pages when one is full
+TEST_F(TextureAtlasTest, PackerSpillsToAdditionalPages) {
+    std::vector<std::pair<int, int>> sizes(5, {100, 100});
+
+    AtlasPacker packer(128, 128);
+    auto placements = packer.pack(sizes);
+
+    EXPECT_EQ(packer.getPageCount(), 5);
+    for (size_t i = 0; i < placements.size(); ++i) {
+        EXPECT_EQ(placements[i].page, static_cast<int>(i));
+    }
+}
+
+// Test that items larger than a page are reported rather than packed
+TEST_F(TextureAtlasTest, PackerRejectsOversizedItems) {
+    AtlasPacker packer(256, 256);
+    auto placements = packer.pack({{512, 64}, {64, 64}});
+
+    EXPECT_EQ(placements[0].page, -1);
+    EXPECT_EQ(placements[1].page, 0);
+    EXPECT_EQ(packer.getPageCount(), 1);
+}
+
+// Test building an atlas from surfaces and looking up regions
+TEST_F(TextureAtlasTest, BuildFromSurfaces) {
+    std::vector<std::pair<std::string, SDL_Surface*>> images = {
+        {"red", createSurface(64, 32, 255, 0, 0)},
+        {"green", createSurface(48, 48, 0, 255, 0)},
+        {"blue", createSurface(16, 80, 0, 0, 255)}
+    };
+
+    TextureAtlas atlas;
+    ASSERT_TRUE(atlas.build(window->getRenderer(), images, 512));
+    EXPECT_EQ(atlas.getPageCount(), 1);
+    EXPECT_EQ(atlas.getRegionCount(), 3);
+
+    TextureRegion red = atlas.find("red");
+    TextureRegion green = atlas.find("green");
+    TextureRegion blue = atlas.find("blue");
+    ASSERT_TRUE(red.isValid());
+    ASSERT_TRUE(green.isValid());
+    ASSERT_TRUE(blue.isValid());
+
+    // All regions share the single page texture
+    EXPECT_EQ(red.texture, atlas.getPage(0));
+    EXPECT_EQ(green.texture, red.texture);
+    EXPECT_EQ(blue.texture, red.texture);
+
+    EXPECT_EQ(red.rect.w, 64);
+    EXPECT_EQ(red.rect.h, 32);
+    EXPECT_EQ(blue.rect.w, 16);
+    EXPECT_EQ(blue.rect.h, 80);
+
+    EXPECT_FALSE(atlas.find("missing").isValid());
+    EXPECT_FALSE(atlas.contains("missing"));
+}
+
+// Test that images too large for a page still get a usable region
+TEST_F(TextureAtlasTest, OversizedImageGetsOwnTexture) {
+    std::vector<std::pair<std::string, SDL_Surface*>> images = {
+        {"big", createSurface(300, 20, 255, 255, 255)},
+        {"small", createSurface(20, 20, 0, 0, 0)}
+    };
+
+    TextureAtlas atlas;
+    ASSERT_TRUE(atlas.build(window->getRenderer(), images, 128));
+    EXPECT_EQ(atlas.getPageCount(), 2);
+
+    TextureRegion big = atlas.find("big");
+    ASSERT_TRUE(big.isValid());
+    EXPECT_EQ(big.rect.x, 0);
+    EXPECT_EQ(big.rect.y, 0);
+    EXPECT_EQ(big.rect.w, 300);
+    EXPECT_NE(big.texture, atlas.find("small").texture);
+}
+
+// Test that sprite frames are offset by the region's position in the page
+TEST_F(TextureAtlasTest, SpriteFramesStayInsideRegion) {
+    TextureRegion region;
+    region.texture = reinterpret_cast<SDL_Texture*>(0x1); // Never dereferenced by Sprite
+    region.rect = {200, 100, 120, 40};
+
+    Sprite sprite(0.0f, 0.0f, region, 1, 3);
+    SDL_Rect frame = sprite.getCurrentFrame();
+    EXPECT_EQ(frame.x, 200);
+    EXPECT_EQ(frame.y, 100);
+    EXPECT_EQ(frame.w, 40);
+    EXPECT_EQ(frame.h, 40);
+
+    sprite.setFrame(1, 3);
+    frame = sprite.getCurrentFrame();
+    EXPECT_EQ(frame.x, 280);
+    EXPECT_EQ(frame.y, 100);
+}
+
+// Test that drawing atlas-backed entities binds the page once per frame
+TEST_F(TextureAtlasTest, AtlasReducesTextureBinds) {
+    std::vector<std::pair<std::string, SDL_Surface*>> images = {
+        {"a", createSurface(10, 10, 255, 0, 0)},
+        {"b", createSurface(10, 10, 0, 255, 0)},
+        {"c", createSurface(10, 10, 0, 0, 255)}
+    };
+
+    TextureAtlas atlas;
+    ASSERT_TRUE(atlas.build(window->getRenderer(), images, 64));
+
+    std::vector<SDL_Texture*> separate;
+    for (const auto& image : images) {
+        separate.push_back(SDL_CreateTextureFromSurface(window->getRenderer(), image.second));
+        ASSERT_NE(separate.back(), nullptr);
+    }
+
+    // Interleave the three images the way fish colours are interleaved in game
+    window->clear();
+    for (int i = 0; i < 12; ++i) {
+        Entity entity(0.0f, 0.0f, separate[i % 3]);
+        window->render(entity);
+    }
+    window->display();
+    EXPECT_EQ(window->getFrameStats().drawCalls, 12);
+    EXPECT_EQ(window->getFrameStats().textureBinds, 12);
+
+    window->clear();
+    for (int i = 0; i < 12; ++i) {
+        Entity entity(0.0f, 0.0f, atlas.find(images[i % 3].first));
+        window->render(entity);
+    }
+    window->display();
+    EXPECT_EQ(window->getFrameStats().drawCalls, 12);
+    EXPECT_EQ(window->getFrameStats().textureBinds, 1);
+
+    for (SDL_Texture* texture : separate) {
+        SDL_DestroyTexture(texture);
+    }
+}
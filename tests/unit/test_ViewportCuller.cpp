@@ -0,0 +1,67 @@
+#include <gtest/gtest.h>
+#include <SDL.h>
+#include "ViewportCuller.hpp"
+#include "RenderWindow.hpp"
+#include "Entity.hpp"
+
+#include <memory>
+#include <vector>
+
+// Test the rect test against the viewport and its margin
+TEST(ViewportCullerTest, MarginExtendsViewport) {
+    ViewportCuller culler(1920, 1080, 100);
+
+    EXPECT_TRUE(culler.isVisible(0.0f, 0.0f, 50.0f, 50.0f));
+    EXPECT_TRUE(culler.isVisible(1900.0f, 720.0f, 128.0f, 128.0f));   // Straddles the right edge
+    EXPECT_TRUE(culler.isVisible(2000.0f, 720.0f, 128.0f, 128.0f));   // Inside the margin
+    EXPECT_FALSE(culler.isVisible(2020.0f, 720.0f, 128.0f, 128.0f));  // Starts past the margin
+    EXPECT_FALSE(culler.isVisible(10160.0f, 720.0f, 128.0f, 128.0f));
+    EXPECT_FALSE(culler.isVisible(-300.0f, 720.0f, 128.0f, 128.0f));  // Scrolled off the left
+    EXPECT_FALSE(culler.isVisible(0.0f, 1200.0f, 50.0f, 50.0f));
+
+    EXPECT_FLOAT_EQ(culler.getLeftBound(), -100.0f);
+    EXPECT_FLOAT_EQ(culler.getRightBound(), 2020.0f);
+}
+
+// Test that an unset viewport never culls
+TEST(ViewportCullerTest, ZeroViewportDisablesCulling) {
+    ViewportCuller culler;
+    EXPECT_TRUE(culler.isVisible(100000.0f, -100000.0f, 1.0f, 1.0f));
+    EXPECT_FALSE(culler.isEnabled());
+    EXPECT_LT(culler.getLeftBound(), -100000.0f);
+    EXPECT_GT(culler.getRightBound(), 100000.0f);
+}
+
+// Test that RenderWindow drops off-screen submissions and counts them
+TEST(ViewportCullerTest, RenderWindowCullsSubmissions) {
+    ASSERT_EQ(SDL_Init(SDL_INIT_VIDEO), 0) << "SDL_Init failed: " << SDL_GetError();
+    {
+        RenderWindow window("Cull Test", 200, 100, SDL_WINDOW_HIDDEN);
+        ASSERT_TRUE(window.isValid()) << "Failed to create test render window";
+        window.setCullMargin(20);
+
+        SDL_Texture* texture = SDL_CreateTexture(window.getRenderer(), SDL_PIXELFORMAT_RGBA32,
+                                                 SDL_TEXTUREACCESS_STATIC, 16, 16);
+        ASSERT_NE(texture, nullptr);
+
+        // Fish laid out like a chart: a few on screen, most far to the right
+        std::vector<Entity> fish;
+        for (int i = 0; i < 100; ++i) {
+            fish.emplace_back(static_cast<float>(i * 50), 40.0f, texture);
+        }
+
+        window.clear();
+        for (auto& entity : fish) {
+            window.submit(entity);
+        }
+        window.display();
+
+        const RenderStats& stats = window.getFrameStats();
+        EXPECT_EQ(stats.visibleSprites, 5); // x = 0..200 fit in 200 + 20 margin
+        EXPECT_EQ(stats.culledSprites, 95);
+        EXPECT_EQ(stats.batchedSprites, 5);
+
+        SDL_DestroyTexture(texture);
+    }
+    SDL_Quit();
+}
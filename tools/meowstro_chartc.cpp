@@ -0,0 +1,43 @@
+// meowstro_chartc - compiles a text .chart into the binary layout read by CompiledChart.
+//
+// Usage: meowstro_chartc <input.chart> <output.mwch> [notes_per_section]
+//
+// The text chart is parsed and validated here once, so the game only maps the result
+// and decodes varint note times instead of parsing text at song start.
+
+#include "Chart.hpp"
+#include "CompiledChart.hpp"
+#include "Logger.hpp"
+
+#include <cstdlib>
+#include <string>
+
+int main(int argc, char** argv) {
+    if (argc != 3 && argc != 4) {
+        Logger::error("Usage: meowstro_chartc <input.chart> <output.mwch> [notes_per_section]");
+        return EXIT_FAILURE;
+    }
+
+    std::uint32_t notesPerSection = CompiledChart::kDefaultNotesPerSection;
+    if (argc == 4) {
+        long value = std::strtol(argv[3], nullptr, 10);
+        if (value <= 0) {
+            Logger::error(std::string("Invalid notes per section: ") + argv[3]);
+            return EXIT_FAILURE;
+        }
+        notesPerSection = static_cast<std::uint32_t>(value);
+    }
+
+    Chart chart;
+    if (!chart.loadFromFile(argv[1])) {
+        return EXIT_FAILURE;
+    }
+
+    CompiledChartWriter writer(notesPerSection);
+    if (!writer.write(chart, argv[2])) {
+        return EXIT_FAILURE;
+    }
+
+    Logger::info("Compiled " + std::to_string(chart.getNoteCount()) + " notes from " + argv[1] + " to " + argv[2]);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,124 @@
+// meowstro_pack - bakes the assets/ tree into a single pack file.
+//
+// Usage: meowstro_pack <assets_dir> <output.mwpk>
+//
+// PNGs are decoded once here into RGBA32 so the game can upload them straight
+// from the mapped file; fonts are stored as their raw bytes. Other files
+// (audio) are skipped and still load from disk.
+
+#include "AssetPack.hpp"
+#include "Logger.hpp"
+
+#include <SDL.h>
+#include <SDL_image.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+std::string lowercaseExtension(const fs::path& path) {
+    std::string ext = path.extension().string();
+    std::transform(ext.begin(), ext.end(), ext.begin(), [](unsigned char ch) { return static_cast<char>(std::tolower(ch)); });
+    return ext;
+}
+
+bool addImage(AssetPackWriter& writer, const fs::path& file, const std::string& name) {
+    SDL_Surface* loaded = IMG_Load(file.string().c_str());
+    if (!loaded) {
+        Logger::logSDLImageError(LogLevel::ERROR, "Failed to decode " + file.string());
+        return false;
+    }
+
+    SDL_Surface* rgba = SDL_ConvertSurfaceFormat(loaded, SDL_PIXELFORMAT_RGBA32, 0);
+    SDL_FreeSurface(loaded);
+    if (!rgba) {
+        Logger::logSDLError(LogLevel::ERROR, "Failed to convert " + file.string());
+        return false;
+    }
+
+    // Drop row padding so the pack holds exactly width * 4 bytes per row
+    std::vector<Uint8> pixels(static_cast<size_t>(rgba->w) * rgba->h * 4);
+    const Uint8* src = static_cast<const Uint8*>(rgba->pixels);
+    for (int row = 0; row < rgba->h; ++row) {
+        std::copy(src + row * rgba->pitch, src + row * rgba->pitch + rgba->w * 4, pixels.begin() + row * rgba->w * 4);
+    }
+
+    writer.addImage(name, rgba->w, rgba->h, pixels.data());
+    Logger::info("  image " + name + " (" + std::to_string(rgba->w) + "x" + std::to_string(rgba->h) + ")");
+    SDL_FreeSurface(rgba);
+    return true;
+}
+
+bool addFont(AssetPackWriter& writer, const fs::path& file, const std::string& name) {
+    std::ifstream in(file, std::ios::binary);
+    if (!in) {
+        Logger::error("Failed to read " + file.string());
+        return false;
+    }
+    std::vector<std::uint8_t> bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    Logger::info("  font  " + name + " (" + std::to_string(bytes.size()) + " bytes)");
+    writer.addFont(name, std::move(bytes));
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    if (argc != 3) {
+        Logger::error("Usage: meowstro_pack <assets_dir> <output.mwpk>");
+        return EXIT_FAILURE;
+    }
+
+    fs::path root = fs::absolute(argv[1]).lexically_normal();
+    if (root.filename().empty()) {
+        root = root.parent_path();
+    }
+    if (!fs::is_directory(root)) {
+        Logger::error("Not a directory: " + root.string());
+        return EXIT_FAILURE;
+    }
+
+    if (!(IMG_Init(IMG_INIT_PNG) & IMG_INIT_PNG)) {
+        Logger::logSDLImageError(LogLevel::ERROR, "IMG_Init(PNG) failed");
+        return EXIT_FAILURE;
+    }
+
+    // Sorted so the pack is byte-identical across runs and platforms
+    std::vector<fs::path> files;
+    for (const auto& item : fs::recursive_directory_iterator(root)) {
+        if (item.is_regular_file()) {
+            files.push_back(item.path());
+        }
+    }
+    std::sort(files.begin(), files.end());
+
+    AssetPackWriter writer;
+    bool ok = true;
+    for (const fs::path& file : files) {
+        // Keys look like the config paths: "assets/images/boat.png"
+        const std::string name = (root.filename() / fs::relative(file, root)).generic_string();
+        const std::string ext = lowercaseExtension(file);
+        if (ext == ".png") {
+            ok = addImage(writer, file, name) && ok;
+        } else if (ext == ".ttf") {
+            ok = addFont(writer, file, name) && ok;
+        }
+    }
+
+    IMG_Quit();
+
+    if (!ok || !writer.write(argv[2])) {
+        return EXIT_FAILURE;
+    }
+    Logger::info("Wrote " + std::to_string(writer.getEntryCount()) + " entries to " + argv[2]);
+    return EXIT_SUCCESS;
+}